@@ -0,0 +1,95 @@
+/*
+ * Filename: bench-inline.c
+ * Purpose : Measure the cost per operation of the interval API in a tight
+ *           loop. The file is built twice: once against the out-of-line
+ *           interval.o and once with INTERVAL_INLINE defined, so that the
+ *           two outputs can be compared.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.0 (26/10/16)
+ *           Initial version.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "interval.h"
+
+#define NVALS  4096
+#define NREPS  2000
+
+#ifdef INTERVAL_INLINE
+#define BENCH_MODE "inline"
+#else
+#define BENCH_MODE "extern"
+#endif
+
+static Interval xv[NVALS], yv[NVALS];
+volatile int sink;
+
+/* now_ns:
+ * Return a monotonic timestamp in nanoseconds.
+ */
+static double now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (ts.tv_sec * 1e9 + ts.tv_nsec);
+}
+
+/* BENCH_LOOP:
+ * Time NREPS passes of expression expr over all NVALS operand pairs and
+ * print the average cost per operation.
+ */
+#define BENCH_LOOP(name, expr)                                   \
+  do {                                                           \
+    double t0, t1;                                               \
+    int r, i, acc = 0;                                           \
+    Interval z;                                                  \
+    t0 = now_ns();                                               \
+    for (r = 0; r < NREPS; r++)                                  \
+    {                                                            \
+      for (i = 0; i < NVALS; i++)                                \
+      {                                                          \
+        z = (expr);                                              \
+        acc += z.infm ^ z.supr;                                  \
+      }                                                          \
+    }                                                            \
+    t1 = now_ns();                                               \
+    sink = acc;                                                  \
+    printf("%s,%s,%.3f\n", BENCH_MODE, name,                     \
+      (t1 - t0) / ((double)NREPS * NVALS));                      \
+  } while (0)
+
+/* main:
+ */
+int main(void)
+{
+  int i;
+
+  srand(1);
+  for (i = 0; i < NVALS; i++)
+  {
+    xv[i].infm = rand() % 2001 - 1000;
+    xv[i].supr = xv[i].infm + rand() % 1000;
+    yv[i].infm = rand() % 1000 + 1;
+    yv[i].supr = yv[i].infm + rand() % 1000;
+  }
+
+  printf("mode,operation,ns_per_op\n");
+  BENCH_LOOP("IntervalAdd", IntervalAdd(xv[i], yv[i]));
+  BENCH_LOOP("IntervalSub", IntervalSub(xv[i], yv[i]));
+  BENCH_LOOP("IntervalNeg", IntervalNeg(xv[i]));
+  BENCH_LOOP("IntervalMul", IntervalMul(xv[i], yv[i], SIGNED_ARITH, SIGNED_ARITH));
+  BENCH_LOOP("IntervalDiv", IntervalDiv(xv[i], yv[i], SIGNED_ARITH, SIGNED_ARITH));
+  BENCH_LOOP("IntervalAbs", IntervalAbs(xv[i]));
+  BENCH_LOOP("IntervalMax", IntervalMax(xv[i], yv[i]));
+  BENCH_LOOP("IntervalMin", IntervalMin(xv[i], yv[i]));
+  BENCH_LOOP("IntervalUnion", IntervalUnion(xv[i], yv[i]));
+  BENCH_LOOP("IntervalIntersection", IntervalIntersection(xv[i], yv[i]));
+  BENCH_LOOP("IntervalToIntegerBitwidth",
+    ValueToInterval(IntervalToIntegerBitwidth(xv[i], SIGNED_ARITH)));
+
+  return 0;
+}
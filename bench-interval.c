@@ -0,0 +1,956 @@
+/*
+ * Filename: bench-interval.c
+ * Purpose : Micro-benchmark suite for the interval ADT API. Every scalar entry
+ *           point and every batch kernel (for each instruction set supported
+ *           by the host) is timed over randomized input distributions.
+ *           Throughput, latency percentiles and cycles per operation are
+ *           reported in CSV (default) or JSON format.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.17 (26/10/16)
+ *           Added the IntervalExpIntegerChecked benchmark.
+ *           0.3.16 (26/10/16)
+ *           Added the remaining shift and bit-field benchmarks.
+ *           0.3.15 (26/10/16)
+ *           Added the IntervalUniverseChecked and log2ceilChecked benchmarks.
+ *           0.3.14 (26/10/16)
+ *           Added the polynomial range benchmarks.
+ *           0.3.13 (26/10/16)
+ *           Added the IntervalExpIntegerBatch benchmark.
+ *           0.3.12 (26/10/16)
+ *           Added the shift and bit-field batch benchmarks.
+ *           0.3.11 (26/10/16)
+ *           Added the known-bits benchmarks.
+ *           0.3.10 (26/10/16)
+ *           Added the bitwise batch benchmarks.
+ *           0.3.9 (26/10/16)
+ *           Added the wide interval benchmarks.
+ *           0.3.8 (26/10/16)
+ *           Added the INTERVAL_PROBE benchmark.
+ *           0.3.7 (26/10/16)
+ *           Added the atomic accumulator benchmarks.
+ *           0.3.6 (26/10/16)
+ *           Added the bulk containment benchmarks.
+ *           0.3.5 (26/10/16)
+ *           Added the stabbing-query index benchmarks.
+ *           0.3.4 (26/10/16)
+ *           Added the multi-interval benchmarks.
+ *           0.3.3 (26/10/16)
+ *           Added the arena allocation benchmarks.
+ *           0.3.2 (26/10/16)
+ *           Added the cached operation benchmarks.
+ *           0.3.1 (26/10/16)
+ *           Added the IntervalDagEval benchmark.
+ *           0.3.0 (26/10/16)
+ *           Initial version.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "interval.h"
+#include "interval-batch.h"
+#include "interval-dag.h"
+#include "interval-cache.h"
+#include "interval-arena.h"
+#include "interval-multi.h"
+#include "interval-index.h"
+#include "interval-atomic.h"
+#include "interval-probe.h"
+#include "interval-wide.h"
+#include "interval-bits.h"
+#include "interval-poly.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define READ_CYCLES() ((unsigned long long)__rdtsc())
+#else
+#define READ_CYCLES() 0ULL
+#endif
+
+#define BLOCK       1024     /* Operations per timed sample */
+#define NSAMPLES    200      /* Default number of samples per benchmark */
+#define NWARMUP     5        /* Untimed samples before measuring */
+
+/* BenchData holds the operand arrays of one input distribution. x and y are
+ * drawn from the distribution; p is a strictly positive interval of similar
+ * magnitude (used as divisor and as input to sqrt, balance, etc.); k is a
+ * shift amount within [0,7], constant in half of the elements.
+ */
+typedef struct {
+  const char *name;
+  int xi[BLOCK], xs[BLOCK];
+  int yi[BLOCK], ys[BLOCK];
+  int pi[BLOCK], ps[BLOCK];
+  int ki[BLOCK], ks[BLOCK];
+  int zi[BLOCK], zs[BLOCK];
+  int err[BLOCK];
+  IntervalDag *dag;          /* Random DAG of BLOCK nodes, built on demand */
+  IntervalIndex *index;      /* Index of the y intervals, built on demand */
+} BenchData;
+
+typedef void (*BenchFn)(int n, BenchData *d, IntervalOpcode op);
+
+/* BenchKind tells how a benchmark is run. */
+typedef enum {
+  BENCH_SCALAR = 0,          /* Scalar API, run once */
+  BENCH_BATCH                /* Batch API, run once per instruction set */
+} BenchKind;
+
+typedef struct {
+  const char *name;
+  BenchKind kind;
+  BenchFn fn;
+  IntervalOpcode op;
+} BenchEntry;
+
+volatile int bench_sink;
+IntervalCache *bench_cache;
+IntervalArena *bench_arena;
+
+/* Coefficients of x**2 - 3x + 2, for the polynomial benchmarks. */
+static const int bench_poly[3] = { 2, -3, 1 };
+
+/* now_ns:
+ * Return a monotonic timestamp in nanoseconds.
+ */
+static double now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (ts.tv_sec * 1e9 + ts.tv_nsec);
+}
+
+/* rand_interval:
+ * Draw a random interval with bounds in [lo,hi].
+ */
+static void rand_interval(int lo, int hi, int *infm, int *supr)
+{
+  int a = lo + (int)(((double)rand() / ((double)RAND_MAX + 1.0)) * (hi - lo + 1.0));
+  int b = lo + (int)(((double)rand() / ((double)RAND_MAX + 1.0)) * (hi - lo + 1.0));
+  *infm = MIN(a, b);
+  *supr = MAX(a, b);
+}
+
+/* bench_fill:
+ * Fill d with intervals drawn uniformly from [lo,hi].
+ */
+static void bench_fill(BenchData *d, const char *name, int lo, int hi)
+{
+  int i;
+
+  d->name = name;
+  for (i = 0; i < BLOCK; i++)
+  {
+    rand_interval(lo, hi, &d->xi[i], &d->xs[i]);
+    rand_interval(lo, hi, &d->yi[i], &d->ys[i]);
+    rand_interval(1, MAX(hi, 2), &d->pi[i], &d->ps[i]);
+    d->ki[i] = i % 8;
+    d->ks[i] = MIN(i % 8 + (i / 8) % 2, 7);
+  }
+}
+
+/* Scalar benchmarks: each one evaluates expr for all n operand pairs. */
+#define BENCH_SCALAR_FN(fname, expr)                                \
+  static void fname(int n, BenchData *d, IntervalOpcode op)         \
+  {                                                                 \
+    int i, acc = 0;                                                 \
+    Interval z;                                                     \
+    Interval x, y, p;                                               \
+    (void)op;                                                       \
+    for (i = 0; i < n; i++)                                         \
+    {                                                               \
+      x = INTERVAL(d->xi[i], d->xs[i]);                             \
+      y = INTERVAL(d->yi[i], d->ys[i]);                             \
+      p = INTERVAL(d->pi[i], d->ps[i]);                             \
+      (void)x; (void)y; (void)p;                                    \
+      z = (expr);                                                   \
+      acc += z.infm ^ z.supr;                                       \
+    }                                                               \
+    bench_sink += acc;                                              \
+  }
+
+/* Same as BENCH_SCALAR_FN, for functions returning an int. */
+#define BENCH_SCALAR_INT_FN(fname, expr)                            \
+  BENCH_SCALAR_FN(fname, ValueToInterval(expr))
+
+BENCH_SCALAR_FN(b_interval,       INTERVAL(d->xi[i], d->xs[i]))
+BENCH_SCALAR_FN(b_copy,           IntervalCopy(x))
+BENCH_SCALAR_FN(b_empty,          IntervalEmpty())
+BENCH_SCALAR_FN(b_universe,       IntervalUniverse(1 + (i & 31), SIGNED_ARITH))
+BENCH_SCALAR_FN(b_clamp,          IntervalClamp(x, y.infm, y.supr))
+BENCH_SCALAR_FN(b_add,            IntervalAdd(x, y))
+BENCH_SCALAR_FN(b_sub,            IntervalSub(x, y))
+BENCH_SCALAR_FN(b_neg,            IntervalNeg(x))
+BENCH_SCALAR_FN(b_mul,            IntervalMul(x, y, SIGNED_ARITH, SIGNED_ARITH))
+BENCH_SCALAR_FN(b_div,            IntervalDiv(x, p, SIGNED_ARITH, SIGNED_ARITH))
+BENCH_SCALAR_FN(b_mod,            IntervalMod(x, y, SIGNED_ARITH))
+BENCH_SCALAR_FN(b_mux,            IntervalMux(x, y))
+BENCH_SCALAR_FN(b_set,            IntervalSet(x, x))
+BENCH_SCALAR_FN(b_and,            IntervalAnd(x, y))
+BENCH_SCALAR_FN(b_ior,            IntervalIor(x, y))
+BENCH_SCALAR_FN(b_xor,            IntervalXor(x, y))
+BENCH_SCALAR_FN(b_not,            IntervalNot(x))
+BENCH_SCALAR_FN(b_shl,            IntervalShl(x, INTERVAL(d->ki[i], d->ks[i])))
+BENCH_SCALAR_FN(b_shr,            IntervalShr(x, INTERVAL(d->ki[i], d->ks[i]), SIGNED_ARITH))
+BENCH_SCALAR_FN(b_sra,            IntervalSra(x, INTERVAL(d->ki[i], d->ks[i])))
+BENCH_SCALAR_FN(b_trunc,          IntervalTrunc(x, 8, SIGNED_ARITH))
+BENCH_SCALAR_FN(b_sext,           IntervalSext(x, 8))
+BENCH_SCALAR_FN(b_zext,           IntervalZext(x, 8))
+BENCH_SCALAR_FN(b_slice,          IntervalSlice(x, 11, 4))
+BENCH_SCALAR_FN(b_concat,         IntervalConcat(x, y, 8))
+BENCH_SCALAR_FN(b_exp,            IntervalExpInteger(x, 2))
+BENCH_SCALAR_FN(b_sqrt,           IntervalSqrt(p))
+BENCH_SCALAR_FN(b_poly,           IntervalPoly(x, bench_poly, 2, 0))
+BENCH_SCALAR_FN(b_polysplit,      IntervalPoly(x, bench_poly, 2, INTERVAL_POLY_SEGMENTS))
+BENCH_SCALAR_FN(b_abs,            IntervalAbs(x))
+BENCH_SCALAR_FN(b_max,            IntervalMax(x, y))
+BENCH_SCALAR_FN(b_min,            IntervalMin(x, y))
+BENCH_SCALAR_FN(b_union,          IntervalUnion(x, y))
+BENCH_SCALAR_FN(b_intersection,   IntervalIntersection(x, y))
+BENCH_SCALAR_INT_FN(b_isin,       ValueIsInInterval(x, y.infm))
+BENCH_SCALAR_INT_FN(b_isempty,    IntervalIsEmpty(x))
+BENCH_SCALAR_INT_FN(b_ispositive, IntervalIsPositive(x))
+BENCH_SCALAR_INT_FN(b_isnegative, IntervalIsNegative(x))
+BENCH_SCALAR_FN(b_valuetoint,     ValueToInterval(d->xi[i]))
+BENCH_SCALAR_FN(b_balanced,       IntervalBalanced(p, SIGNED_ARITH))
+BENCH_SCALAR_INT_FN(b_isbalanced, IntervalIsBalanced(x, SIGNED_ARITH))
+BENCH_SCALAR_INT_FN(b_issymmetric, IntervalIsSymmetric(x))
+BENCH_SCALAR_FN(b_bw2int,         IntegerBitwidthToInterval(1 + (i & 31), SIGNED_ARITH))
+BENCH_SCALAR_INT_FN(b_int2bw,     IntervalToIntegerBitwidth(x, SIGNED_ARITH))
+BENCH_SCALAR_INT_FN(b_log2ceil,   log2ceil(p.supr))
+BENCH_SCALAR_INT_FN(b_ipow,       ipow(3, i & 15))
+BENCH_SCALAR_FN(b_addwide,        IntervalAddWide(x, y, NULL))
+BENCH_SCALAR_FN(b_subwide,        IntervalSubWide(x, y, NULL))
+BENCH_SCALAR_FN(b_negwide,        IntervalNegWide(x, NULL))
+BENCH_SCALAR_FN(b_mulwide,        IntervalMulWide(x, y, SIGNED_ARITH, SIGNED_ARITH, NULL))
+BENCH_SCALAR_FN(b_mulcached,      IntervalMulCached(bench_cache, x, y, SIGNED_ARITH, SIGNED_ARITH))
+BENCH_SCALAR_FN(b_divcached,      IntervalDivCached(bench_cache, x, p, SIGNED_ARITH, SIGNED_ARITH))
+BENCH_SCALAR_FN(b_modcached,      IntervalModCached(bench_cache, x, y, SIGNED_ARITH))
+BENCH_SCALAR_FN(b_expcached,      IntervalExpIntegerCached(bench_cache, x, 2))
+BENCH_SCALAR_FN(b_balcached,      IntervalBalancedCached(bench_cache, p, SIGNED_ARITH))
+
+/* Checked scalar benchmarks return the status through acc as well; z is 
+ * initialized for the functions that only set z.infm.
+ */
+#define BENCH_CHECKED_FN(fname, call)                               \
+  static void fname(int n, BenchData *d, IntervalOpcode op)         \
+  {                                                                 \
+    int i, acc = 0;                                                 \
+    Interval z = IntervalEmpty();                                   \
+    Interval x, y, p;                                               \
+    (void)op;                                                       \
+    for (i = 0; i < n; i++)                                         \
+    {                                                               \
+      x = INTERVAL(d->xi[i], d->xs[i]);                             \
+      y = INTERVAL(d->yi[i], d->ys[i]);                             \
+      p = INTERVAL(d->pi[i], d->ps[i]);                             \
+      (void)x; (void)y; (void)p;                                    \
+      acc += (call);                                                \
+      acc += z.infm ^ z.supr;                                       \
+    }                                                               \
+    bench_sink += acc;                                              \
+  }
+
+BENCH_CHECKED_FN(b_universechecked, IntervalUniverseChecked(&z, 1 + (i & 31), SIGNED_ARITH))
+BENCH_CHECKED_FN(b_mulchecked,    IntervalMulChecked(&z, x, y, SIGNED_ARITH, SIGNED_ARITH))
+BENCH_CHECKED_FN(b_divchecked,    IntervalDivChecked(&z, x, y, SIGNED_ARITH, SIGNED_ARITH))
+BENCH_CHECKED_FN(b_modchecked,    IntervalModChecked(&z, x, y, SIGNED_ARITH))
+BENCH_CHECKED_FN(b_setchecked,    IntervalSetChecked(&z, x, y))
+BENCH_CHECKED_FN(b_expchecked,    IntervalExpIntegerChecked(&z, x, 2))
+BENCH_CHECKED_FN(b_sqrtchecked,   IntervalSqrtChecked(&z, x))
+BENCH_CHECKED_FN(b_shlchecked,    IntervalShlChecked(&z, x, INTERVAL(d->ki[i], d->ks[i])))
+BENCH_CHECKED_FN(b_shrchecked,    IntervalShrChecked(&z, x, INTERVAL(d->ki[i], d->ks[i]), SIGNED_ARITH))
+BENCH_CHECKED_FN(b_srachecked,    IntervalSraChecked(&z, x, INTERVAL(d->ki[i], d->ks[i])))
+BENCH_CHECKED_FN(b_truncchecked,  IntervalTruncChecked(&z, x, 8, SIGNED_ARITH))
+BENCH_CHECKED_FN(b_slicechecked,  IntervalSliceChecked(&z, x, 11, 4))
+BENCH_CHECKED_FN(b_concatchecked, IntervalConcatChecked(&z, x, y, 8))
+BENCH_CHECKED_FN(b_balchecked,    IntervalBalancedChecked(&z, x, SIGNED_ARITH))
+BENCH_CHECKED_FN(b_int2bwchecked, IntervalToIntegerBitwidthChecked(&z.infm, x, SIGNED_ARITH))
+BENCH_CHECKED_FN(b_log2ceilchecked, log2ceilChecked(&z.infm, p.supr))
+
+/* b_batch:
+ * Batch benchmark of opcode op; divisors and sqrt inputs use the positive
+ * intervals, so that the whole batch is valid.
+ */
+static void b_batch(int n, BenchData *d, IntervalOpcode op)
+{
+  const int *xi = d->xi, *xs = d->xs, *yi = d->yi, *ys = d->ys;
+
+  if (op == INTERVAL_OP_DIV)
+  {
+    yi = d->pi;
+    ys = d->ps;
+  }
+  else if (op == INTERVAL_OP_SQRT)
+  {
+    xi = d->pi;
+    xs = d->ps;
+  }
+  else if (op == INTERVAL_OP_SHL || op == INTERVAL_OP_SHR || op == INTERVAL_OP_SRA)
+  {
+    yi = d->ki;
+    ys = d->ks;
+  }
+  bench_sink += IntervalBatchEvalChecked(op, n, xi, xs, yi, ys, d->zi, d->zs,
+                  SIGNED_ARITH, SIGNED_ARITH, NULL);
+  bench_sink += d->zi[n - 1];
+}
+
+/* b_batch_bitwidth:
+ * Benchmark of IntervalToIntegerBitwidthBatch.
+ */
+static void b_batch_bitwidth(int n, BenchData *d, IntervalOpcode op)
+{
+  (void)op;
+  IntervalToIntegerBitwidthBatch(n, d->xi, d->xs, SIGNED_ARITH, d->zi);
+  bench_sink += d->zi[n - 1];
+}
+
+/* b_batch_field:
+ * Benchmark of IntervalTruncBatch to 8 signed bits (op 0), IntervalSliceBatch 
+ * of bits [11:4] (op 1), IntervalConcatBatch with 8-bit y (op 2) and 
+ * IntervalExpIntegerBatch squaring x (op 3).
+ */
+static void b_batch_field(int n, BenchData *d, IntervalOpcode op)
+{
+  switch (op)
+  {
+    case 0:
+      bench_sink += IntervalTruncBatch(n, d->xi, d->xs, 8, SIGNED_ARITH, 
+                      d->zi, d->zs, NULL);
+      break;
+    case 1:
+      bench_sink += IntervalSliceBatch(n, d->xi, d->xs, 11, 4, d->zi, d->zs, NULL);
+      break;
+    case 2:
+      bench_sink += IntervalConcatBatch(n, d->xi, d->xs, d->yi, d->ys, 8, 
+                      d->zi, d->zs, NULL);
+      break;
+    default:
+      bench_sink += IntervalExpIntegerBatch(n, d->xi, d->xs, 2, d->zi, d->zs, NULL);
+      break;
+  }
+  bench_sink += d->zi[n - 1];
+}
+
+/* b_batch_poly:
+ * Benchmark of IntervalPolyBatch on x**2 - 3x + 2, in Horner form (op 0) and
+ * with the monotonic split (op 1).
+ */
+static void b_batch_poly(int n, BenchData *d, IntervalOpcode op)
+{
+  bench_sink += IntervalPolyBatch(n, d->xi, d->xs, bench_poly, 2,
+                  (op == 0) ? 0 : INTERVAL_POLY_SEGMENTS, d->zi, d->zs, NULL);
+  bench_sink += d->zi[n - 1];
+}
+
+/* b_violations:
+ * Benchmark of IntervalViolationsBatch (op 0), IntervalViolationsMinMaxBatch
+ * (op 1) and ValueIsInIntervalBatch (op 2), checking the lower bounds of the
+ * x intervals against the first y interval.
+ */
+static void b_violations(int n, BenchData *d, IntervalOpcode op)
+{
+  Interval x = INTERVAL(d->yi[0], d->ys[0]), r;
+  int first;
+
+  switch (op)
+  {
+    case 0:
+      bench_sink += IntervalViolationsBatch(x, n, d->xi, &first);
+      break;
+    case 1:
+      bench_sink += IntervalViolationsMinMaxBatch(x, n, d->xi, &first, &r);
+      bench_sink += r.supr;
+      break;
+    default:
+      bench_sink += ValueIsInIntervalBatch(x, n, d->xi, d->zi);
+      break;
+  }
+  bench_sink += first;
+}
+
+/* b_dag:
+ * Benchmark of IntervalDagEval over a random DAG of BLOCK nodes, whose first
+ * 64 nodes are inputs taken from the distribution.
+ */
+static void b_dag(int n, BenchData *d, IntervalOpcode op)
+{
+  static const IntervalOpcode ops[] = {
+    INTERVAL_OP_ADD, INTERVAL_OP_SUB, INTERVAL_OP_MAX, INTERVAL_OP_MIN,
+    INTERVAL_OP_MUX, INTERVAL_OP_UNION, INTERVAL_OP_MUL, INTERVAL_OP_ABS
+  };
+  int i;
+
+  (void)op;
+  if (d->dag == NULL)
+  {
+    d->dag = IntervalDagCreate(n);
+    for (i = 0; i < n; i++)
+    {
+      if (i < 64)
+      {
+        IntervalDagAddInput(d->dag, INTERVAL(d->xi[i], d->xs[i]), SIGNED_ARITH);
+      }
+      else
+      {
+        IntervalDagAddNode(d->dag, ops[rand() % 8], rand() % i, rand() % i,
+          SIGNED_ARITH, SIGNED_ARITH);
+      }
+    }
+  }
+  bench_sink += IntervalDagEval(d->dag);
+}
+
+/* b_arena:
+ * Benchmark of IntervalArenaNewInterval; the arena is reset once per block.
+ */
+static void b_arena(int n, BenchData *d, IntervalOpcode op)
+{
+  int i;
+
+  (void)op;
+  IntervalArenaReset(bench_arena);
+  for (i = 0; i < n; i++)
+  {
+    bench_sink += IntervalArenaNewInterval(bench_arena,
+                    INTERVAL(d->xi[i], d->xs[i]))->supr;
+  }
+}
+
+/* b_arena_array:
+ * Benchmark of IntervalArenaAllocIntervals on arrays of 1 to 16 intervals;
+ * the arena is reset once per block.
+ */
+static void b_arena_array(int n, BenchData *d, IntervalOpcode op)
+{
+  Interval *z;
+  int i;
+
+  (void)op;
+  IntervalArenaReset(bench_arena);
+  for (i = 0; i < n; i++)
+  {
+    z = IntervalArenaAllocIntervals(bench_arena, 1 + (i & 15));
+    z[0] = INTERVAL(d->xi[i], d->xs[i]);
+    bench_sink += z[0].supr;
+  }
+}
+
+/* b_multi:
+ * Benchmark of IntervalMultiEval of op on sets of two members each, formed
+ * from neighbouring intervals of the distribution.
+ */
+static void b_multi(int n, BenchData *d, IntervalOpcode op)
+{
+  IntervalMulti x, y, z;
+  const int *yi = d->yi, *ys = d->ys;
+  int i, j;
+
+  if (op == INTERVAL_OP_DIV)
+  {
+    yi = d->pi;
+    ys = d->ps;
+  }
+  IntervalMultiInit(&x, 0);
+  IntervalMultiInit(&y, 0);
+  IntervalMultiInit(&z, 0);
+  for (i = 0; i < n; i++)
+  {
+    j = (i + 1) % n;
+    IntervalMultiFromInterval(&x, INTERVAL(d->xi[i], d->xs[i]));
+    IntervalMultiInsert(&x, INTERVAL(d->xi[j], d->xs[j]));
+    IntervalMultiFromInterval(&y, INTERVAL(yi[i], ys[i]));
+    IntervalMultiInsert(&y, INTERVAL(yi[j], ys[j]));
+    bench_sink += IntervalMultiEval(op, &z, &x, &y, SIGNED_ARITH, SIGNED_ARITH);
+  }
+  IntervalMultiFree(&x);
+  IntervalMultiFree(&y);
+  IntervalMultiFree(&z);
+}
+
+/* bench_index:
+ * Return the index of the y intervals of d, building it on first use.
+ */
+static IntervalIndex *bench_index(BenchData *d)
+{
+  Interval y[BLOCK];
+  int i;
+
+  if (d->index == NULL)
+  {
+    for (i = 0; i < BLOCK; i++)
+    {
+      y[i] = INTERVAL(d->yi[i], d->ys[i]);
+    }
+    d->index = IntervalIndexCreate(y, BLOCK);
+  }
+  return (d->index);
+}
+
+/* b_index_any:
+ * Benchmark of IntervalIndexAny over the index of the y intervals.
+ */
+static void b_index_any(int n, BenchData *d, IntervalOpcode op)
+{
+  IntervalIndex *ix = bench_index(d);
+  int i, acc = 0;
+
+  (void)op;
+  for (i = 0; i < n; i++)
+  {
+    acc += IntervalIndexAny(ix, d->xi[i]);
+  }
+  bench_sink += acc;
+}
+
+/* b_index_stab:
+ * Benchmark of IntervalIndexStab (counting only) over the index of the y
+ * intervals.
+ */
+static void b_index_stab(int n, BenchData *d, IntervalOpcode op)
+{
+  IntervalIndex *ix = bench_index(d);
+  int i, acc = 0;
+
+  (void)op;
+  for (i = 0; i < n; i++)
+  {
+    acc += IntervalIndexStab(ix, d->xi[i], NULL, 0);
+  }
+  bench_sink += acc;
+}
+
+/* b_index_batch:
+ * Benchmark of IntervalIndexAnyBatch over the index of the y intervals.
+ */
+static void b_index_batch(int n, BenchData *d, IntervalOpcode op)
+{
+  (void)op;
+  IntervalIndexAnyBatch(bench_index(d), n, d->xi, d->zi);
+  bench_sink += d->zi[n - 1];
+}
+
+/* b_atomic:
+ * Benchmark of IntervalAtomicJoinValue (uncontended) on the x infima.
+ */
+static void b_atomic(int n, BenchData *d, IntervalOpcode op)
+{
+  IntervalAtomic a;
+  int i;
+
+  (void)op;
+  IntervalAtomicInit(&a, IntervalEmpty());
+  for (i = 0; i < n; i++)
+  {
+    IntervalAtomicJoinValue(&a, d->xi[i]);
+  }
+  bench_sink += IntervalAtomicLoad(&a).supr;
+}
+
+/* b_atomic_split:
+ * Benchmark of IntervalAtomicSplitJoinValue (uncontended) on the x infima.
+ */
+static void b_atomic_split(int n, BenchData *d, IntervalOpcode op)
+{
+  IntervalAtomicSplit a;
+  int i;
+
+  (void)op;
+  IntervalAtomicSplitInit(&a, IntervalEmpty());
+  for (i = 0; i < n; i++)
+  {
+    IntervalAtomicSplitJoinValue(&a, d->xi[i]);
+  }
+  bench_sink += IntervalAtomicSplitLoad(&a).supr;
+}
+
+/* b_probe:
+ * Benchmark of INTERVAL_PROBE on the x infima, over 16 probes.
+ */
+static void b_probe(int n, BenchData *d, IntervalOpcode op)
+{
+  int i;
+
+  (void)op;
+  for (i = 0; i < n; i++)
+  {
+    INTERVAL_PROBE(i & 15, d->xi[i]);
+  }
+  bench_sink += interval_probe_tls[n & 15].supr;
+}
+
+/* b_mul64:
+ * Interval64Mul on the operands widened to 64 bits.
+ */
+static void b_mul64(int n, BenchData *d, IntervalOpcode op)
+{
+  Interval64 z;
+  int64_t acc = 0;
+  int i;
+
+  (void)op;
+  for (i = 0; i < n; i++)
+  {
+    Interval64Mul(&z, INTERVAL64(d->xi[i], d->xs[i]), INTERVAL64(d->yi[i], d->ys[i]));
+    acc += z.infm ^ z.supr;
+  }
+  bench_sink += (int)acc;
+}
+
+#ifdef INTERVAL_HAVE_INT128
+/* b_mul128:
+ * Interval128Mul on the operands widened to 128 bits.
+ */
+static void b_mul128(int n, BenchData *d, IntervalOpcode op)
+{
+  Interval128 z;
+  IntervalInt128 acc = 0;
+  int i;
+
+  (void)op;
+  for (i = 0; i < n; i++)
+  {
+    Interval128Mul(&z, INTERVAL128(d->xi[i], d->xs[i]), INTERVAL128(d->yi[i], d->ys[i]));
+    acc += z.infm ^ z.supr;
+  }
+  bench_sink += (int)acc;
+}
+#endif
+
+/* b_mulbig:
+ * IntervalBigMul on operands that fit in machine words (the native path).
+ */
+static void b_mulbig(int n, BenchData *d, IntervalOpcode op)
+{
+  IntervalBig x, y, z;
+  int64_t acc = 0;
+  int i;
+
+  (void)op;
+  IntervalBigInit(&x);
+  IntervalBigInit(&y);
+  IntervalBigInit(&z);
+  for (i = 0; i < n; i++)
+  {
+    IntervalBigSet(&x, d->xi[i], d->xs[i]);
+    IntervalBigSet(&y, d->yi[i], d->ys[i]);
+    IntervalBigMul(&z, &x, &y);
+    acc += z.infm.v ^ z.supr.v;
+  }
+  IntervalBigFree(&x);
+  IntervalBigFree(&y);
+  IntervalBigFree(&z);
+  bench_sink += (int)acc;
+}
+
+/* bench_bits:
+ * Return the IntervalBits of range x with bits 4 to 7 known, as in m.
+ */
+static inline IntervalBits bench_bits(Interval x, int m)
+{
+  IntervalBits z;
+  z.r = x;
+  z.zeros = ~(unsigned int)m & 0xF0U;
+  z.ones = (unsigned int)m & 0xF0U;
+  return (z);
+}
+
+BENCH_SCALAR_FN(b_bitsfrom,       IntervalBitsFromInterval(x).r)
+BENCH_SCALAR_FN(b_bitsrefine,     IntervalBitsRefine(bench_bits(x, y.infm)).r)
+BENCH_SCALAR_FN(b_bitsadd,        IntervalBitsAdd(bench_bits(x, y.infm), bench_bits(y, x.infm)).r)
+BENCH_SCALAR_FN(b_bitsand,        IntervalBitsAnd(bench_bits(x, y.infm), bench_bits(y, x.infm)).r)
+
+static const BenchEntry bench_entries[] = {
+  { "INTERVAL",                  BENCH_SCALAR, b_interval,       0 },
+  { "IntervalCopy",              BENCH_SCALAR, b_copy,           0 },
+  { "IntervalEmpty",             BENCH_SCALAR, b_empty,          0 },
+  { "IntervalUniverse",          BENCH_SCALAR, b_universe,       0 },
+  { "IntervalClamp",             BENCH_SCALAR, b_clamp,          0 },
+  { "IntervalAdd",               BENCH_SCALAR, b_add,            0 },
+  { "IntervalSub",               BENCH_SCALAR, b_sub,            0 },
+  { "IntervalNeg",               BENCH_SCALAR, b_neg,            0 },
+  { "IntervalMul",               BENCH_SCALAR, b_mul,            0 },
+  { "IntervalDiv",               BENCH_SCALAR, b_div,            0 },
+  { "IntervalMod",               BENCH_SCALAR, b_mod,            0 },
+  { "IntervalMux",               BENCH_SCALAR, b_mux,            0 },
+  { "IntervalSet",               BENCH_SCALAR, b_set,            0 },
+  { "IntervalAnd",               BENCH_SCALAR, b_and,            0 },
+  { "IntervalIor",               BENCH_SCALAR, b_ior,            0 },
+  { "IntervalXor",               BENCH_SCALAR, b_xor,            0 },
+  { "IntervalNot",               BENCH_SCALAR, b_not,            0 },
+  { "IntervalShl",               BENCH_SCALAR, b_shl,            0 },
+  { "IntervalShr",               BENCH_SCALAR, b_shr,            0 },
+  { "IntervalSra",               BENCH_SCALAR, b_sra,            0 },
+  { "IntervalTrunc",             BENCH_SCALAR, b_trunc,          0 },
+  { "IntervalSext",              BENCH_SCALAR, b_sext,           0 },
+  { "IntervalZext",              BENCH_SCALAR, b_zext,           0 },
+  { "IntervalSlice",             BENCH_SCALAR, b_slice,          0 },
+  { "IntervalConcat",            BENCH_SCALAR, b_concat,         0 },
+  { "IntervalExpInteger",        BENCH_SCALAR, b_exp,            0 },
+  { "IntervalSqrt",              BENCH_SCALAR, b_sqrt,           0 },
+  { "IntervalPoly",              BENCH_SCALAR, b_poly,           0 },
+  { "IntervalPolySplit",         BENCH_SCALAR, b_polysplit,      0 },
+  { "IntervalAbs",               BENCH_SCALAR, b_abs,            0 },
+  { "IntervalMax",               BENCH_SCALAR, b_max,            0 },
+  { "IntervalMin",               BENCH_SCALAR, b_min,            0 },
+  { "IntervalUnion",             BENCH_SCALAR, b_union,          0 },
+  { "IntervalIntersection",      BENCH_SCALAR, b_intersection,   0 },
+  { "ValueIsInInterval",         BENCH_SCALAR, b_isin,           0 },
+  { "IntervalIsEmpty",           BENCH_SCALAR, b_isempty,        0 },
+  { "IntervalIsPositive",        BENCH_SCALAR, b_ispositive,     0 },
+  { "IntervalIsNegative",        BENCH_SCALAR, b_isnegative,     0 },
+  { "ValueToInterval",           BENCH_SCALAR, b_valuetoint,     0 },
+  { "IntervalBalanced",          BENCH_SCALAR, b_balanced,       0 },
+  { "IntervalIsBalanced",        BENCH_SCALAR, b_isbalanced,     0 },
+  { "IntervalIsSymmetric",       BENCH_SCALAR, b_issymmetric,    0 },
+  { "IntegerBitwidthToInterval", BENCH_SCALAR, b_bw2int,         0 },
+  { "IntervalToIntegerBitwidth", BENCH_SCALAR, b_int2bw,         0 },
+  { "log2ceil",                  BENCH_SCALAR, b_log2ceil,       0 },
+  { "ipow",                      BENCH_SCALAR, b_ipow,           0 },
+  { "IntervalAddWide",           BENCH_SCALAR, b_addwide,        0 },
+  { "IntervalSubWide",           BENCH_SCALAR, b_subwide,        0 },
+  { "IntervalNegWide",           BENCH_SCALAR, b_negwide,        0 },
+  { "IntervalMulWide",           BENCH_SCALAR, b_mulwide,        0 },
+  { "IntervalMulCached",         BENCH_SCALAR, b_mulcached,      0 },
+  { "IntervalDivCached",         BENCH_SCALAR, b_divcached,      0 },
+  { "IntervalModCached",         BENCH_SCALAR, b_modcached,      0 },
+  { "IntervalExpIntegerCached",  BENCH_SCALAR, b_expcached,      0 },
+  { "IntervalBalancedCached",    BENCH_SCALAR, b_balcached,      0 },
+  { "IntervalArenaNewInterval",  BENCH_SCALAR, b_arena,          0 },
+  { "IntervalArenaAllocIntervals", BENCH_SCALAR, b_arena_array,  0 },
+  { "IntervalMultiAdd",          BENCH_SCALAR, b_multi, INTERVAL_OP_ADD },
+  { "IntervalMultiMul",          BENCH_SCALAR, b_multi, INTERVAL_OP_MUL },
+  { "IntervalMultiDiv",          BENCH_SCALAR, b_multi, INTERVAL_OP_DIV },
+  { "IntervalMultiUnion",        BENCH_SCALAR, b_multi, INTERVAL_OP_UNION },
+  { "IntervalMultiIntersection", BENCH_SCALAR, b_multi, INTERVAL_OP_INTERSECTION },
+  { "IntervalIndexAny",          BENCH_SCALAR, b_index_any,      0 },
+  { "IntervalIndexStab",         BENCH_SCALAR, b_index_stab,     0 },
+  { "IntervalIndexAnyBatch",     BENCH_SCALAR, b_index_batch,    0 },
+  { "IntervalAtomicJoinValue",   BENCH_SCALAR, b_atomic,         0 },
+  { "IntervalAtomicSplitJoinValue", BENCH_SCALAR, b_atomic_split, 0 },
+  { "INTERVAL_PROBE",            BENCH_SCALAR, b_probe,          0 },
+  { "Interval64Mul",             BENCH_SCALAR, b_mul64,          0 },
+#ifdef INTERVAL_HAVE_INT128
+  { "Interval128Mul",            BENCH_SCALAR, b_mul128,         0 },
+#endif
+  { "IntervalBigMul",            BENCH_SCALAR, b_mulbig,         0 },
+  { "IntervalBitsFromInterval",  BENCH_SCALAR, b_bitsfrom,       0 },
+  { "IntervalBitsRefine",        BENCH_SCALAR, b_bitsrefine,     0 },
+  { "IntervalBitsAdd",           BENCH_SCALAR, b_bitsadd,        0 },
+  { "IntervalBitsAnd",           BENCH_SCALAR, b_bitsand,        0 },
+  { "IntervalUniverseChecked",   BENCH_SCALAR, b_universechecked, 0 },
+  { "IntervalMulChecked",        BENCH_SCALAR, b_mulchecked,     0 },
+  { "IntervalDivChecked",        BENCH_SCALAR, b_divchecked,     0 },
+  { "IntervalModChecked",        BENCH_SCALAR, b_modchecked,     0 },
+  { "IntervalSetChecked",        BENCH_SCALAR, b_setchecked,     0 },
+  { "IntervalExpIntegerChecked", BENCH_SCALAR, b_expchecked,     0 },
+  { "IntervalSqrtChecked",       BENCH_SCALAR, b_sqrtchecked,    0 },
+  { "IntervalShlChecked",        BENCH_SCALAR, b_shlchecked,     0 },
+  { "IntervalShrChecked",        BENCH_SCALAR, b_shrchecked,     0 },
+  { "IntervalSraChecked",        BENCH_SCALAR, b_srachecked,     0 },
+  { "IntervalTruncChecked",      BENCH_SCALAR, b_truncchecked,   0 },
+  { "IntervalSliceChecked",      BENCH_SCALAR, b_slicechecked,   0 },
+  { "IntervalConcatChecked",     BENCH_SCALAR, b_concatchecked,  0 },
+  { "IntervalBalancedChecked",   BENCH_SCALAR, b_balchecked,     0 },
+  { "IntervalToIntegerBitwidthChecked", BENCH_SCALAR, b_int2bwchecked, 0 },
+  { "log2ceilChecked",           BENCH_SCALAR, b_log2ceilchecked, 0 },
+  { "IntervalAddBatch",          BENCH_BATCH,  b_batch, INTERVAL_OP_ADD },
+  { "IntervalSubBatch",          BENCH_BATCH,  b_batch, INTERVAL_OP_SUB },
+  { "IntervalNegBatch",          BENCH_BATCH,  b_batch, INTERVAL_OP_NEG },
+  { "IntervalMulBatch",          BENCH_BATCH,  b_batch, INTERVAL_OP_MUL },
+  { "IntervalAbsBatch",          BENCH_BATCH,  b_batch, INTERVAL_OP_ABS },
+  { "IntervalMaxBatch",          BENCH_BATCH,  b_batch, INTERVAL_OP_MAX },
+  { "IntervalMinBatch",          BENCH_BATCH,  b_batch, INTERVAL_OP_MIN },
+  { "IntervalMuxBatch",          BENCH_BATCH,  b_batch, INTERVAL_OP_MUX },
+  { "IntervalUnionBatch",        BENCH_BATCH,  b_batch, INTERVAL_OP_UNION },
+  { "IntervalIntersectionBatch", BENCH_BATCH,  b_batch, INTERVAL_OP_INTERSECTION },
+  { "IntervalDivBatch",          BENCH_BATCH,  b_batch, INTERVAL_OP_DIV },
+  { "IntervalModBatch",          BENCH_BATCH,  b_batch, INTERVAL_OP_MOD },
+  { "IntervalSetBatch",          BENCH_BATCH,  b_batch, INTERVAL_OP_SET },
+  { "IntervalSqrtBatch",         BENCH_BATCH,  b_batch, INTERVAL_OP_SQRT },
+  { "IntervalAndBatch",          BENCH_BATCH,  b_batch, INTERVAL_OP_AND },
+  { "IntervalIorBatch",          BENCH_BATCH,  b_batch, INTERVAL_OP_IOR },
+  { "IntervalXorBatch",          BENCH_BATCH,  b_batch, INTERVAL_OP_XOR },
+  { "IntervalNotBatch",          BENCH_BATCH,  b_batch, INTERVAL_OP_NOT },
+  { "IntervalShlBatch",          BENCH_BATCH,  b_batch, INTERVAL_OP_SHL },
+  { "IntervalShrBatch",          BENCH_BATCH,  b_batch, INTERVAL_OP_SHR },
+  { "IntervalSraBatch",          BENCH_BATCH,  b_batch, INTERVAL_OP_SRA },
+  { "IntervalTruncBatch",        BENCH_BATCH,  b_batch_field,    0 },
+  { "IntervalSliceBatch",        BENCH_BATCH,  b_batch_field,    1 },
+  { "IntervalConcatBatch",       BENCH_BATCH,  b_batch_field,    2 },
+  { "IntervalExpIntegerBatch",   BENCH_BATCH,  b_batch_field,    3 },
+  { "IntervalPolyBatch",         BENCH_BATCH,  b_batch_poly,     0 },
+  { "IntervalPolySplitBatch",    BENCH_BATCH,  b_batch_poly,     1 },
+  { "IntervalToIntegerBitwidthBatch", BENCH_BATCH, b_batch_bitwidth, 0 },
+  { "IntervalViolationsBatch",   BENCH_BATCH,  b_violations,     0 },
+  { "IntervalViolationsMinMaxBatch", BENCH_BATCH, b_violations,   1 },
+  { "ValueIsInIntervalBatch",    BENCH_BATCH,  b_violations,     2 },
+  { "IntervalDagEval",           BENCH_BATCH,  b_dag,            0 },
+  { NULL,                        BENCH_SCALAR, NULL,             0 }
+};
+
+/* cmp_double:
+ * qsort() comparison function for doubles.
+ */
+static int cmp_double(const void *a, const void *b)
+{
+  double x = *(const double *)a, y = *(const double *)b;
+  return ((x > y) - (x < y));
+}
+
+/* bench_run:
+ * Time nsamples samples of BLOCK operations of the given benchmark and print
+ * one result record.
+ */
+static void bench_run(const BenchEntry *e, BenchData *d, const char *isa,
+  int nsamples, int json, int *first)
+{
+  double *lat = malloc(nsamples * sizeof(double));
+  double t0, t1, total_ns = 0.0;
+  unsigned long long c0, c1, total_cycles = 0;
+  double ops;
+  int s;
+
+  for (s = 0; s < NWARMUP; s++)
+  {
+    e->fn(BLOCK, d, e->op);
+  }
+  for (s = 0; s < nsamples; s++)
+  {
+    t0 = now_ns();
+    c0 = READ_CYCLES();
+    e->fn(BLOCK, d, e->op);
+    c1 = READ_CYCLES();
+    t1 = now_ns();
+    lat[s] = (t1 - t0) / BLOCK;
+    total_ns += t1 - t0;
+    total_cycles += c1 - c0;
+  }
+  qsort(lat, nsamples, sizeof(double), cmp_double);
+  ops = (double)nsamples * BLOCK;
+
+  if (json)
+  {
+    printf("%s  {\"benchmark\": \"%s\", \"isa\": \"%s\", \"distribution\": \"%s\", "
+      "\"ops\": %.0f, \"ns_per_op\": %.3f, \"mops_per_s\": %.3f, "
+      "\"p50_ns\": %.3f, \"p90_ns\": %.3f, \"p99_ns\": %.3f, "
+      "\"cycles_per_op\": %.3f}",
+      *first ? "" : ",\n", e->name, isa, d->name, ops, total_ns / ops,
+      ops / total_ns * 1e3, lat[nsamples / 2], lat[(nsamples * 9) / 10],
+      lat[(nsamples * 99) / 100], total_cycles / ops);
+  }
+  else
+  {
+    printf("%s,%s,%s,%.0f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f\n",
+      e->name, isa, d->name, ops, total_ns / ops, ops / total_ns * 1e3,
+      lat[nsamples / 2], lat[(nsamples * 9) / 10], lat[(nsamples * 99) / 100],
+      total_cycles / ops);
+  }
+  *first = 0;
+  free(lat);
+}
+
+/* print_usage:
+ * Print usage information.
+ */
+static void print_usage(void)
+{
+  printf("Usage: bench-interval [options]\n");
+  printf("  -j          Report in JSON format (default: CSV).\n");
+  printf("  -s <num>    Number of timed samples per benchmark (default: %d).\n",
+    NSAMPLES);
+  printf("  -f <str>    Only run benchmarks whose name contains <str>.\n");
+  printf("  -h          Print this help.\n");
+}
+
+/* main:
+ */
+int main(int argc, char *argv[])
+{
+  static BenchData dists[3];
+  const BenchEntry *e;
+  const char *filter = NULL;
+  int json = 0, nsamples = NSAMPLES, first = 1;
+  int i, k, isa, host;
+
+  for (i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "-j") == 0)
+    {
+      json = 1;
+    }
+    else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+    {
+      nsamples = atoi(argv[++i]);
+      nsamples = MAX(nsamples, 1);
+    }
+    else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc)
+    {
+      filter = argv[++i];
+    }
+    else
+    {
+      print_usage();
+      return (strcmp(argv[i], "-h") == 0 ? 0 : 1);
+    }
+  }
+
+  srand(1);
+  bench_fill(&dists[0], "u8", 0, 255);
+  bench_fill(&dists[1], "s12", -2048, 2047);
+  bench_fill(&dists[2], "s16", -32768, 32767);
+  host = IntervalBatchGetIsa();
+  bench_cache = IntervalCacheCreate(0);
+  bench_arena = IntervalArenaCreate(0);
+  IntervalProbeInit(16);
+
+  if (json)
+  {
+    printf("[\n");
+  }
+  else
+  {
+    printf("benchmark,isa,distribution,ops,ns_per_op,mops_per_s,"
+      "p50_ns,p90_ns,p99_ns,cycles_per_op\n");
+  }
+  for (e = bench_entries; e->name != NULL; e++)
+  {
+    if (filter != NULL && strstr(e->name, filter) == NULL)
+    {
+      continue;
+    }
+    for (k = 0; k < 3; k++)
+    {
+      if (e->kind == BENCH_SCALAR)
+      {
+        bench_run(e, &dists[k], "scalar", nsamples, json, &first);
+        continue;
+      }
+      for (isa = INTERVAL_ISA_SCALAR; isa <= host; isa++)
+      {
+        IntervalBatchSetIsa((IntervalIsa)isa);
+        bench_run(e, &dists[k], IntervalBatchIsaName((IntervalIsa)isa),
+          nsamples, json, &first);
+      }
+      IntervalBatchSetIsa((IntervalIsa)host);
+    }
+  }
+  if (json)
+  {
+    printf("\n]\n");
+  }
+  for (k = 0; k < 3; k++)
+  {
+    IntervalDagDestroy(dists[k].dag);
+    IntervalIndexDestroy(dists[k].index);
+  }
+  IntervalCacheDestroy(bench_cache);
+  IntervalArenaDestroy(bench_arena);
+  IntervalProbeShutdown();
+
+  return 0;
+}
@@ -0,0 +1,152 @@
+/*
+ * Filename: interval-arena.c
+ * Purpose : Implementation of the arena (bump) allocator for interval nodes
+ *           and interval arrays.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.0 (26/10/16)
+ *           Initial version.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "interval.h"
+#include "interval-arena.h"
+
+/* arena_new_chunk:
+ * Allocate a chunk of at least size usable bytes, starting at a cache line
+ * boundary; abort when out of memory.
+ */
+static IntervalArenaChunk *arena_new_chunk(IntervalArena *a, size_t size)
+{
+  IntervalArenaChunk *c;
+  uintptr_t p;
+
+  size = MAX(size, a->chunk_size);
+  c = malloc(sizeof(IntervalArenaChunk) + size + INTERVAL_ARENA_ALIGN);
+  if (c == NULL)
+  {
+    fprintf(stderr, "Error: Out of memory in interval arena.\n");
+    exit(1);
+  }
+  p = (uintptr_t)(c + 1);
+  p = (p + INTERVAL_ARENA_ALIGN - 1) & ~(uintptr_t)(INTERVAL_ARENA_ALIGN - 1);
+  c->data = (char *)p;
+  c->size = size;
+  c->used = 0;
+  c->next = NULL;
+  a->capacity += size;
+  return (c);
+}
+
+/* IntervalArenaCreate:
+ * Create an empty arena whose chunks are chunk_size bytes
+ * (INTERVAL_ARENA_CHUNK_SIZE if 0); larger allocations get a chunk of their
+ * own.
+ */
+IntervalArena *IntervalArenaCreate(size_t chunk_size)
+{
+  IntervalArena *a = malloc(sizeof(IntervalArena));
+
+  if (a == NULL)
+  {
+    fprintf(stderr, "Error: Out of memory in interval arena.\n");
+    exit(1);
+  }
+  a->chunk_size = (chunk_size > 0) ? chunk_size : INTERVAL_ARENA_CHUNK_SIZE;
+  a->used = 0;
+  a->capacity = 0;
+  a->first = a->cur = arena_new_chunk(a, a->chunk_size);
+
+  return (a);
+}
+
+/* IntervalArenaDestroy:
+ * Return all chunks of arena a to the system and free a.
+ */
+void IntervalArenaDestroy(IntervalArena *a)
+{
+  IntervalArenaChunk *c, *next;
+
+  if (a == NULL)
+  {
+    return;
+  }
+  for (c = a->first; c != NULL; c = next)
+  {
+    next = c->next;
+    free(c);
+  }
+  free(a);
+}
+
+/* IntervalArenaReset:
+ * Release all allocations of arena a at once, in constant time. The chunks
+ * are kept and reused by the following allocations.
+ */
+void IntervalArenaReset(IntervalArena *a)
+{
+  a->cur = a->first;
+  a->cur->used = 0;
+  a->used = 0;
+}
+
+/* IntervalArenaAllocAligned:
+ * Allocate size bytes from arena a, aligned to align bytes (a power of two,
+ * at most INTERVAL_ARENA_ALIGN).
+ */
+void *IntervalArenaAllocAligned(IntervalArena *a, size_t size, size_t align)
+{
+  IntervalArenaChunk *c = a->cur, *n;
+  size_t off;
+
+  off = (c->used + align - 1) & ~(align - 1);
+  if (off + size > c->size)
+  {
+    // Move on to the next chunk kept by a reset, if large enough, or insert a
+    // new one after the current chunk.
+    n = c->next;
+    if (n == NULL || size > n->size)
+    {
+      n = arena_new_chunk(a, size);
+      n->next = c->next;
+      c->next = n;
+    }
+    n->used = 0;
+    a->cur = c = n;
+    off = 0;
+  }
+  a->used += off + size - c->used;
+  c->used = off + size;
+  return (c->data + off);
+}
+
+/* IntervalArenaAlloc:
+ * Allocate size bytes from arena a, aligned to a cache line.
+ */
+void *IntervalArenaAlloc(IntervalArena *a, size_t size)
+{
+  return (IntervalArenaAllocAligned(a, size, INTERVAL_ARENA_ALIGN));
+}
+
+/* IntervalArenaAllocIntervals:
+ * Allocate an array of n intervals from arena a, aligned to a cache line.
+ */
+Interval *IntervalArenaAllocIntervals(IntervalArena *a, int n)
+{
+  return (IntervalArenaAlloc(a, (size_t)MAX(n, 0) * sizeof(Interval)));
+}
+
+/* IntervalArenaNewInterval:
+ * Allocate a single interval from arena a and set it to x. Single intervals
+ * are packed with their natural alignment.
+ */
+Interval *IntervalArenaNewInterval(IntervalArena *a, Interval x)
+{
+  Interval *z = IntervalArenaAllocAligned(a, sizeof(Interval), sizeof(int));
+
+  *z = x;
+  return (z);
+}
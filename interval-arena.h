@@ -0,0 +1,63 @@
+/*
+ * Filename: interval-arena.h
+ * Purpose : Arena (bump) allocator for interval nodes and interval arrays.
+ *           Definitions and function prototypes.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.1 (26/10/16)
+ *           Added extern "C" guards for C++.
+ *           0.3.0 (26/10/16)
+ *           Initial version.
+ */
+#ifndef INTERVAL_ARENA_H
+#define INTERVAL_ARENA_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include "interval.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Cache line size, the default alignment of arena allocations. */
+#define INTERVAL_ARENA_ALIGN       64
+
+/* Default size of an arena chunk in bytes. */
+#define INTERVAL_ARENA_CHUNK_SIZE  65536
+
+/* IntervalArenaChunk is a block of memory allocated from the system. */
+typedef struct IntervalArenaChunk {
+  struct IntervalArenaChunk *next;  /* Next chunk */
+  size_t size;                      /* Usable bytes */
+  size_t used;                      /* Bytes handed out */
+  char *data;                       /* Start of the usable bytes (aligned) */
+} IntervalArenaChunk;
+
+/* IntervalArena hands out memory from a list of chunks by bumping a pointer.
+ * Individual allocations are never freed: the whole arena is either reset,
+ * keeping its chunks for reuse, or destroyed.
+ */
+typedef struct {
+  IntervalArenaChunk *first;        /* First chunk */
+  IntervalArenaChunk *cur;          /* Chunk allocations are taken from */
+  size_t chunk_size;                /* Size of new chunks */
+  size_t used;                      /* Bytes handed out since the last reset */
+  size_t capacity;                  /* Bytes allocated from the system */
+} IntervalArena;
+
+/* Interval arena API. */
+IntervalArena *IntervalArenaCreate(size_t chunk_size);
+void IntervalArenaDestroy(IntervalArena *a);
+void IntervalArenaReset(IntervalArena *a);
+void *IntervalArenaAlloc(IntervalArena *a, size_t size);
+void *IntervalArenaAllocAligned(IntervalArena *a, size_t size, size_t align);
+Interval *IntervalArenaAllocIntervals(IntervalArena *a, int n);
+Interval *IntervalArenaNewInterval(IntervalArena *a, Interval x);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INTERVAL_ARENA_H */
@@ -0,0 +1,202 @@
+/*
+ * Filename: interval-atomic.c
+ * Purpose : Implementation of the lock-free interval hull accumulators, on
+ *           the GCC __atomic builtins. Every join first checks whether the
+ *           accumulated interval already covers its argument; once the range
+ *           of a signal has settled, joins only read the shared cache line
+ *           and scale with the number of threads. Relaxed ordering suffices,
+ *           as the bounds only grow and carry no other data; the final hull
+ *           is published by the synchronization (e.g. pthread_join) that
+ *           ends the updating threads.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.0 (26/10/16)
+ *           Initial version.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include "interval.h"
+#include "interval-batch.h"
+#include "interval-atomic.h"
+
+/* Pack and unpack the bounds of an IntervalAtomic word. */
+#define ATOMIC_PACK(infm, supr) \
+  (((uint64_t)(uint32_t)(supr) << 32) | (uint64_t)(uint32_t)(infm))
+#define ATOMIC_INFM(w)  ((int)(uint32_t)(w))
+#define ATOMIC_SUPR(w)  ((int)(uint32_t)((w) >> 32))
+
+/* atomic_join:
+ * Widen the interval in word to include [u,v] (with u <= v). Returns 1 if the
+ * interval was widened, 0 if it already included [u,v].
+ */
+static inline int atomic_join(uint64_t *word, int u, int v)
+{
+  uint64_t w = __atomic_load_n(word, __ATOMIC_RELAXED), z;
+
+  do
+  {
+    if (ATOMIC_INFM(w) <= u && v <= ATOMIC_SUPR(w))
+    {
+      return (0);
+    }
+    z = ATOMIC_PACK(MIN(ATOMIC_INFM(w), u), MAX(ATOMIC_SUPR(w), v));
+  } while (!__atomic_compare_exchange_n(word, &w, z, 1,
+              __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+  return (1);
+}
+
+/* atomic_min:
+ * Lower *p to v if v is smaller. Returns 1 if *p was lowered.
+ */
+static inline int atomic_min(int *p, int v)
+{
+  int w = __atomic_load_n(p, __ATOMIC_RELAXED);
+
+  do
+  {
+    if (w <= v)
+    {
+      return (0);
+    }
+  } while (!__atomic_compare_exchange_n(p, &w, v, 1,
+              __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+  return (1);
+}
+
+/* atomic_max:
+ * Raise *p to v if v is larger. Returns 1 if *p was raised.
+ */
+static inline int atomic_max(int *p, int v)
+{
+  int w = __atomic_load_n(p, __ATOMIC_RELAXED);
+
+  do
+  {
+    if (w >= v)
+    {
+      return (0);
+    }
+  } while (!__atomic_compare_exchange_n(p, &w, v, 1,
+              __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+  return (1);
+}
+
+/* IntervalAtomicInit:
+ * Initialize a to interval x (or to no values, if x is empty). Not atomic;
+ * to be called before a is shared.
+ */
+void IntervalAtomicInit(IntervalAtomic *a, Interval x)
+{
+  if (x.infm > x.supr)
+  {
+    x = INTERVAL(INT_MAX, INT_MIN);
+  }
+  a->word = ATOMIC_PACK(x.infm, x.supr);
+}
+
+/* IntervalAtomicLoad:
+ * Return the interval of a; IntervalEmpty() if no values were joined.
+ */
+Interval IntervalAtomicLoad(const IntervalAtomic *a)
+{
+  uint64_t w = __atomic_load_n(&a->word, __ATOMIC_RELAXED);
+
+  if (ATOMIC_INFM(w) > ATOMIC_SUPR(w))
+  {
+    return (IntervalEmpty());
+  }
+  return (INTERVAL(ATOMIC_INFM(w), ATOMIC_SUPR(w)));
+}
+
+/* IntervalAtomicJoin:
+ * Atomically replace a by its union (hull) with interval x; empty intervals
+ * are ignored. Returns 1 if a was widened, 0 otherwise.
+ */
+int IntervalAtomicJoin(IntervalAtomic *a, Interval x)
+{
+  if (x.infm > x.supr)
+  {
+    return (0);
+  }
+  return (atomic_join(&a->word, x.infm, x.supr));
+}
+
+/* IntervalAtomicJoinValue:
+ * Atomically widen a to include value v. Returns 1 if a was widened.
+ */
+int IntervalAtomicJoinValue(IntervalAtomic *a, int v)
+{
+  return (atomic_join(&a->word, v, v));
+}
+
+/* IntervalAtomicJoinBatch:
+ * Atomically widen a to include the n values of v. The values are reduced
+ * locally first, so that a is updated once per call. Returns 1 if a was
+ * widened.
+ */
+int IntervalAtomicJoinBatch(IntervalAtomic *a, int n, const int *v)
+{
+  Interval r;
+
+  if (n <= 0)
+  {
+    return (0);
+  }
+  IntervalViolationsMinMaxBatch(INTERVAL(INT_MIN, INT_MAX), n, v, NULL, &r);
+  return (atomic_join(&a->word, r.infm, r.supr));
+}
+
+/* IntervalAtomicSplitInit:
+ * Initialize a to interval x (or to no values, if x is empty). Not atomic;
+ * to be called before a is shared.
+ */
+void IntervalAtomicSplitInit(IntervalAtomicSplit *a, Interval x)
+{
+  if (x.infm > x.supr)
+  {
+    x = INTERVAL(INT_MAX, INT_MIN);
+  }
+  a->infm = x.infm;
+  a->supr = x.supr;
+}
+
+/* IntervalAtomicSplitLoad:
+ * Return the interval of a; IntervalEmpty() if no values were joined. The
+ * bounds are read separately.
+ */
+Interval IntervalAtomicSplitLoad(const IntervalAtomicSplit *a)
+{
+  int u = __atomic_load_n(&a->infm, __ATOMIC_RELAXED);
+  int v = __atomic_load_n(&a->supr, __ATOMIC_RELAXED);
+
+  if (u > v)
+  {
+    return (IntervalEmpty());
+  }
+  return (INTERVAL(u, v));
+}
+
+/* IntervalAtomicSplitJoin:
+ * Widen a to include interval x, by an atomic minimum of the infimum and an
+ * atomic maximum of the supremum; empty intervals are ignored. Returns 1 if
+ * either bound of a changed.
+ */
+int IntervalAtomicSplitJoin(IntervalAtomicSplit *a, Interval x)
+{
+  if (x.infm > x.supr)
+  {
+    return (0);
+  }
+  return (atomic_min(&a->infm, x.infm) | atomic_max(&a->supr, x.supr));
+}
+
+/* IntervalAtomicSplitJoinValue:
+ * Widen a to include value v. Returns 1 if either bound of a changed.
+ */
+int IntervalAtomicSplitJoinValue(IntervalAtomicSplit *a, int v)
+{
+  return (atomic_min(&a->infm, v) | atomic_max(&a->supr, v));
+}
@@ -0,0 +1,62 @@
+/*
+ * Filename: interval-atomic.h
+ * Purpose : Lock-free interval hull accumulators for concurrent updates.
+ *           Definitions and function prototypes.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.1 (26/10/16)
+ *           Added extern "C" guards for C++.
+ *           0.3.0 (26/10/16)
+ *           Initial version.
+ */
+#ifndef INTERVAL_ATOMIC_H
+#define INTERVAL_ATOMIC_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include "interval.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Size of a cache line, for padding. */
+#define INTERVAL_ATOMIC_LINE  64
+
+/* IntervalAtomic is an interval that several threads may widen concurrently.
+ * Both bounds are packed into a single 64-bit word (the infimum in the low
+ * half), which is updated by compare-and-swap, so that a reader always sees
+ * a consistent interval. No values joined yet is represented by the bounds
+ * [INT_MAX,INT_MIN].
+ */
+typedef struct {
+  uint64_t word __attribute__((aligned(8)));
+} IntervalAtomic;
+
+/* IntervalAtomicSplit keeps the bounds in separate cache lines, updated by
+ * independent atomic minimum and maximum operations. Threads that only widen
+ * one side do not contend with those widening the other, but a concurrent
+ * reader may see the bounds of different joins.
+ */
+typedef struct {
+  int infm __attribute__((aligned(INTERVAL_ATOMIC_LINE)));
+  int supr __attribute__((aligned(INTERVAL_ATOMIC_LINE)));
+} IntervalAtomicSplit;
+
+/* Interval atomic API. */
+void IntervalAtomicInit(IntervalAtomic *a, Interval x);
+Interval IntervalAtomicLoad(const IntervalAtomic *a);
+int IntervalAtomicJoin(IntervalAtomic *a, Interval x);
+int IntervalAtomicJoinValue(IntervalAtomic *a, int v);
+int IntervalAtomicJoinBatch(IntervalAtomic *a, int n, const int *v);
+void IntervalAtomicSplitInit(IntervalAtomicSplit *a, Interval x);
+Interval IntervalAtomicSplitLoad(const IntervalAtomicSplit *a);
+int IntervalAtomicSplitJoin(IntervalAtomicSplit *a, Interval x);
+int IntervalAtomicSplitJoinValue(IntervalAtomicSplit *a, int v);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INTERVAL_ATOMIC_H */
@@ -0,0 +1,1785 @@
+/*
+ * Filename: interval-batch.c
+ * Purpose : Implementation of the structure-of-arrays (SoA) batch API for the
+ *           interval ADT. Batches are evaluated with SSE4.1 or AVX2 kernels
+ *           (AVX-512 for the bulk containment checks) when the host processor
+ *           supports them; otherwise (and for the remaining tail elements)
+ *           the scalar interval API is used.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.7 (26/10/16)
+ *           Added an AVX2 kernel for SQRT (integer square root) and 
+ *           IntervalExpIntegerBatch, with an AVX2 kernel on 64-bit products.
+ *           0.3.6 (26/10/16)
+ *           Added the SHL, SHR and SRA opcodes, with AVX2 kernels on the 
+ *           variable shifts, and IntervalShlBatch, IntervalShrBatch, 
+ *           IntervalSraBatch, IntervalTruncBatch, IntervalSliceBatch and 
+ *           IntervalConcatBatch.
+ *           0.3.5 (26/10/16)
+ *           Added the AND, IOR, XOR and NOT opcodes, with AVX2 kernels for 
+ *           the tight bitwise bounds, and IntervalAndBatch, IntervalIorBatch, 
+ *           IntervalXorBatch and IntervalNotBatch.
+ *           0.3.4 (26/10/16)
+ *           Added AVX-512 detection and the bulk containment kernels 
+ *           ValueIsInIntervalBatch, IntervalViolationsBatch and 
+ *           IntervalViolationsMinMaxBatch.
+ *           0.3.3 (26/10/16)
+ *           Added IntervalOpcodeArity.
+ *           0.3.2 (26/10/16)
+ *           Added the non-aborting batch API: IntervalBatchEvalChecked, 
+ *           IntervalDivBatch, IntervalModBatch, IntervalSqrtBatch, 
+ *           IntervalToIntegerBitwidthBatchChecked.
+ *           0.3.1 (26/10/16)
+ *           Added IntervalToIntegerBitwidthBatch.
+ *           0.3.0 (26/10/16)
+ *           Initial version.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include "interval.h"
+#include "interval-batch.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define INTERVAL_BATCH_X86
+#include <immintrin.h>
+#endif
+
+/* Instruction set in use; -1 until first detected. */
+static int batch_isa = -1;
+
+/* BatchCheck accumulates the result of a bulk containment check. */
+typedef struct {
+  int count;                  /* Number of values outside the interval */
+  int first;                  /* Index of the first such value, or -1 */
+  int vmin, vmax;             /* Minimum and maximum of the values */
+} BatchCheck;
+
+/* batch_detect_isa:
+ * Return the widest instruction set supported by the host processor.
+ */
+static IntervalIsa batch_detect_isa(void)
+{
+#ifdef INTERVAL_BATCH_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f"))
+  {
+    return (INTERVAL_ISA_AVX512);
+  }
+  if (__builtin_cpu_supports("avx2"))
+  {
+    return (INTERVAL_ISA_AVX2);
+  }
+  if (__builtin_cpu_supports("sse4.1"))
+  {
+    return (INTERVAL_ISA_SSE41);
+  }
+#endif
+  return (INTERVAL_ISA_SCALAR);
+}
+
+/* batch_mul_mode:
+ * Encode the signedness of the IntervalMul operands as a 2-bit selector
+ * (bit 1: x is signed, bit 0: y is signed). Returns -1 for unknown types.
+ */
+static int batch_mul_mode(ArithType xtyp, ArithType ytyp)
+{
+  int xs, ys;
+
+  if (xtyp == UNSIGNED_ARITH)
+    xs = 0;
+  else if (xtyp == SIGNED_ARITH || xtyp == SIGNED_POS_ARITH || xtyp == SIGNED_NEG_ARITH)
+    xs = 1;
+  else
+    return (-1);
+
+  if (ytyp == UNSIGNED_ARITH)
+    ys = 0;
+  else if (ytyp == SIGNED_ARITH || ytyp == SIGNED_POS_ARITH || ytyp == SIGNED_NEG_ARITH)
+    ys = 1;
+  else
+    return (-1);
+
+  return ((xs << 1) | ys);
+}
+
+/* batch_scalar:
+ * Evaluate elements [i,n) of a batch through the scalar interval API.
+ */
+static void batch_scalar(IntervalOpcode op, int i, int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr, ArithType xtyp, ArithType ytyp)
+{
+  Interval x, y, z;
+
+  y = IntervalEmpty();
+  for (; i < n; i++)
+  {
+    x = INTERVAL(xinfm[i], xsupr[i]);
+    if (yinfm != NULL)
+    {
+      y = INTERVAL(yinfm[i], ysupr[i]);
+    }
+    switch (op)
+    {
+      case INTERVAL_OP_ADD:          z = IntervalAdd(x, y); break;
+      case INTERVAL_OP_SUB:          z = IntervalSub(x, y); break;
+      case INTERVAL_OP_NEG:          z = IntervalNeg(x); break;
+      case INTERVAL_OP_MUL:          z = IntervalMul(x, y, xtyp, ytyp); break;
+      case INTERVAL_OP_ABS:          z = IntervalAbs(x); break;
+      case INTERVAL_OP_MAX:          z = IntervalMax(x, y); break;
+      case INTERVAL_OP_MIN:          z = IntervalMin(x, y); break;
+      case INTERVAL_OP_MUX:          z = IntervalMux(x, y); break;
+      case INTERVAL_OP_UNION:        z = IntervalUnion(x, y); break;
+      case INTERVAL_OP_INTERSECTION: z = IntervalIntersection(x, y); break;
+      case INTERVAL_OP_DIV:          z = IntervalDiv(x, y, xtyp, ytyp); break;
+      case INTERVAL_OP_MOD:          z = IntervalMod(x, y, xtyp); break;
+      case INTERVAL_OP_SET:          z = IntervalSet(x, y); break;
+      case INTERVAL_OP_SQRT:         z = IntervalSqrt(x); break;
+      case INTERVAL_OP_AND:          z = IntervalAnd(x, y); break;
+      case INTERVAL_OP_IOR:          z = IntervalIor(x, y); break;
+      case INTERVAL_OP_XOR:          z = IntervalXor(x, y); break;
+      case INTERVAL_OP_NOT:          z = IntervalNot(x); break;
+      case INTERVAL_OP_SHL:          z = IntervalShl(x, y); break;
+      case INTERVAL_OP_SHR:          z = IntervalShr(x, y, xtyp); break;
+      case INTERVAL_OP_SRA:          z = IntervalSra(x, y); break;
+      default:
+        fprintf(stderr, "Error: Unknown IntervalOpcode in IntervalBatchEval.\n");
+        exit(1);
+    }
+    zinfm[i] = z.infm;
+    zsupr[i] = z.supr;
+  }
+}
+
+/* batch_scalar_checked:
+ * Evaluate elements [i,n) of a batch through the non-aborting scalar API. 
+ * Returns the OR of the status flags of all elements.
+ */
+static int batch_scalar_checked(IntervalOpcode op, int i, int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr, ArithType xtyp, ArithType ytyp, int *err)
+{
+  Interval x, y, z;
+  int status, mask = INTERVAL_OK;
+
+  y = IntervalEmpty();
+  for (; i < n; i++)
+  {
+    x = INTERVAL(xinfm[i], xsupr[i]);
+    if (yinfm != NULL)
+    {
+      y = INTERVAL(yinfm[i], ysupr[i]);
+    }
+    switch (op)
+    {
+      case INTERVAL_OP_MUL:  status = IntervalMulChecked(&z, x, y, xtyp, ytyp); break;
+      case INTERVAL_OP_DIV:  status = IntervalDivChecked(&z, x, y, xtyp, ytyp); break;
+      case INTERVAL_OP_MOD:  status = IntervalModChecked(&z, x, y, xtyp); break;
+      case INTERVAL_OP_SET:  status = IntervalSetChecked(&z, x, y); break;
+      case INTERVAL_OP_SQRT: status = IntervalSqrtChecked(&z, x); break;
+      case INTERVAL_OP_SHL:  status = IntervalShlChecked(&z, x, y); break;
+      case INTERVAL_OP_SHR:  status = IntervalShrChecked(&z, x, y, xtyp); break;
+      case INTERVAL_OP_SRA:  status = IntervalSraChecked(&z, x, y); break;
+      default:
+        z = IntervalEmpty();
+        status = INTERVAL_ERR_INVALID;
+        break;
+    }
+    zinfm[i] = z.infm;
+    zsupr[i] = z.supr;
+    if (err != NULL)
+    {
+      err[i] |= status;
+    }
+    mask |= status;
+  }
+
+  return (mask);
+}
+
+#ifdef INTERVAL_BATCH_X86
+/* batch_sse41:
+ * Evaluate the leading multiple-of-4 part of a batch using SSE4.1. Returns
+ * the number of elements processed.
+ */
+__attribute__((target("sse4.1")))
+static int batch_sse41(IntervalOpcode op, int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr, ArithType xtyp, ArithType ytyp)
+{
+  __m128i xi, xs, yi, ys, zi, zs;
+  __m128i pii, pis, psi, pss, e;
+  int mode = batch_mul_mode(xtyp, ytyp);
+  int i;
+
+  if (op == INTERVAL_OP_MUL && mode < 0)
+  {
+    return (0);
+  }
+  yi = ys = _mm_setzero_si128();
+
+  for (i = 0; i + 4 <= n; i += 4)
+  {
+    xi = _mm_loadu_si128((const __m128i *)(xinfm + i));
+    xs = _mm_loadu_si128((const __m128i *)(xsupr + i));
+    if (yinfm != NULL)
+    {
+      yi = _mm_loadu_si128((const __m128i *)(yinfm + i));
+      ys = _mm_loadu_si128((const __m128i *)(ysupr + i));
+    }
+    switch (op)
+    {
+      case INTERVAL_OP_ADD:
+        zs = _mm_add_epi32(xs, ys);
+        zi = _mm_add_epi32(xi, yi);
+        break;
+      case INTERVAL_OP_SUB:
+        zs = _mm_sub_epi32(xs, yi);
+        zi = _mm_sub_epi32(xi, ys);
+        break;
+      case INTERVAL_OP_NEG:
+        zs = _mm_sub_epi32(_mm_setzero_si128(), xs);
+        zi = _mm_sub_epi32(_mm_setzero_si128(), xi);
+        break;
+      case INTERVAL_OP_MUL:
+        pii = _mm_mullo_epi32(xi, yi);
+        pss = _mm_mullo_epi32(xs, ys);
+        if (mode == 0)
+        {
+          zs = pss;
+          zi = pii;
+          break;
+        }
+        pis = _mm_mullo_epi32(xi, ys);
+        psi = _mm_mullo_epi32(xs, yi);
+        if (mode == 1)
+        {
+          zs = _mm_max_epi32(pss, pis);
+          zi = _mm_min_epi32(psi, pii);
+        }
+        else if (mode == 2)
+        {
+          zs = _mm_max_epi32(pss, psi);
+          zi = _mm_min_epi32(pis, pii);
+        }
+        else
+        {
+          zs = _mm_max_epi32(_mm_max_epi32(pii, pis), _mm_max_epi32(psi, pss));
+          zi = _mm_min_epi32(_mm_min_epi32(pii, pis), _mm_min_epi32(psi, pss));
+        }
+        break;
+      case INTERVAL_OP_ABS:
+        zs = _mm_max_epi32(_mm_abs_epi32(xs), _mm_abs_epi32(xi));
+        zi = _mm_setzero_si128();
+        break;
+      case INTERVAL_OP_MAX:
+        zs = _mm_max_epi32(xs, ys);
+        zi = _mm_max_epi32(xi, yi);
+        break;
+      case INTERVAL_OP_MIN:
+        zs = _mm_min_epi32(xs, ys);
+        zi = _mm_min_epi32(xi, yi);
+        break;
+      case INTERVAL_OP_MUX:
+      case INTERVAL_OP_UNION:
+        zs = _mm_max_epi32(xs, ys);
+        zi = _mm_min_epi32(xi, yi);
+        break;
+      case INTERVAL_OP_INTERSECTION:
+        zs = _mm_min_epi32(xs, ys);
+        zi = _mm_max_epi32(xi, yi);
+        // Empty operands or disjoint operands produce the [1,0] interval.
+        e = _mm_or_si128(_mm_or_si128(_mm_cmpgt_epi32(xi, xs),
+                                      _mm_cmpgt_epi32(yi, ys)),
+                         _mm_cmpgt_epi32(zi, zs));
+        zs = _mm_andnot_si128(e, zs);
+        zi = _mm_blendv_epi8(zi, _mm_set1_epi32(1), e);
+        break;
+      case INTERVAL_OP_NOT:
+        zs = _mm_xor_si128(xi, _mm_set1_epi32(-1));
+        zi = _mm_xor_si128(xs, _mm_set1_epi32(-1));
+        break;
+      default:
+        return (i);
+    }
+    _mm_storeu_si128((__m128i *)(zinfm + i), zi);
+    _mm_storeu_si128((__m128i *)(zsupr + i), zs);
+  }
+
+  return (i);
+}
+
+/* The AVX2 bitwise kernels compute the bounds of IntervalAnd, IntervalIor and 
+ * IntervalXor as in interval.c, on 8 lanes. AVX2 has no vector count of 
+ * leading zeros, so masks are smeared to the right by shifts instead: for 
+ * s = smear(v), s >> 1 holds the bits below the leading one of v, which is 
+ * s ^ (s >> 1). The unsigned bounds of x in [a,b] and y in [c,d] take sab = 
+ * smear(a ^ b) and scd = smear(c ^ d).
+ */
+
+/* smear_avx2:
+ * Set every bit below the leading one of each lane of v.
+ */
+__attribute__((target("avx2")))
+static inline __m256i smear_avx2(__m256i v)
+{
+  v = _mm256_or_si256(v, _mm256_srli_epi32(v, 1));
+  v = _mm256_or_si256(v, _mm256_srli_epi32(v, 2));
+  v = _mm256_or_si256(v, _mm256_srli_epi32(v, 4));
+  v = _mm256_or_si256(v, _mm256_srli_epi32(v, 8));
+  return (_mm256_or_si256(v, _mm256_srli_epi32(v, 16)));
+}
+
+/* minor_avx2, maxor_avx2, minand_avx2, maxand_avx2:
+ * Unsigned bounds of x IOR y and x AND y (MinOr32 etc. in interval.c).
+ */
+__attribute__((target("avx2")))
+static inline __m256i minor_avx2(__m256i a, __m256i c, __m256i sab, __m256i scd)
+{
+  __m256i p = _mm256_and_si256(_mm256_andnot_si256(a, c), sab);
+  __m256i q = _mm256_and_si256(_mm256_andnot_si256(c, a), scd);
+  __m256i s = smear_avx2(_mm256_or_si256(p, q)), low = _mm256_srli_epi32(s, 1);
+  __m256i m = _mm256_xor_si256(s, low), z = _mm256_setzero_si256();
+  __m256i pm = _mm256_cmpeq_epi32(_mm256_and_si256(p, m), z);
+  __m256i qm = _mm256_cmpeq_epi32(_mm256_and_si256(q, m), z);
+
+  return (_mm256_or_si256(_mm256_andnot_si256(_mm256_andnot_si256(pm, low), a),
+                          _mm256_andnot_si256(_mm256_andnot_si256(qm, low), c)));
+}
+
+__attribute__((target("avx2")))
+static inline __m256i maxor_avx2(__m256i b, __m256i d, __m256i sab, __m256i scd)
+{
+  __m256i s = smear_avx2(_mm256_and_si256(_mm256_and_si256(b, d), 
+                                          _mm256_or_si256(sab, scd)));
+
+  return (_mm256_or_si256(_mm256_or_si256(b, d), _mm256_srli_epi32(s, 1)));
+}
+
+__attribute__((target("avx2")))
+static inline __m256i minand_avx2(__m256i a, __m256i c, __m256i sab, __m256i scd)
+{
+  __m256i s = smear_avx2(_mm256_andnot_si256(_mm256_or_si256(a, c), 
+                                             _mm256_or_si256(sab, scd)));
+
+  return (_mm256_andnot_si256(_mm256_srli_epi32(s, 1), _mm256_and_si256(a, c)));
+}
+
+__attribute__((target("avx2")))
+static inline __m256i maxand_avx2(__m256i b, __m256i d, __m256i sab, __m256i scd)
+{
+  __m256i p = _mm256_and_si256(_mm256_andnot_si256(d, b), sab);
+  __m256i q = _mm256_and_si256(_mm256_andnot_si256(b, d), scd);
+  __m256i s = smear_avx2(_mm256_or_si256(p, q)), low = _mm256_srli_epi32(s, 1);
+  __m256i m = _mm256_xor_si256(s, low), z = _mm256_setzero_si256();
+  __m256i pm = _mm256_cmpeq_epi32(_mm256_and_si256(p, m), z);
+  __m256i qm = _mm256_cmpeq_epi32(_mm256_and_si256(q, m), z);
+
+  return (_mm256_and_si256(_mm256_or_si256(b, _mm256_andnot_si256(pm, low)),
+                           _mm256_or_si256(d, _mm256_andnot_si256(qm, low))));
+}
+
+/* bitwise_avx2:
+ * Compute [zi,zs] = [xi,xs] op [yi,ys] for op AND, IOR or XOR on 8 lanes. As 
+ * in IntervalBitwise, the operands are split into their negative and 
+ * non-negative parts and the bounds of the valid pairs of parts are joined; 
+ * empty operands give [1,0].
+ */
+__attribute__((target("avx2")))
+static inline void bitwise_avx2(IntervalOpcode op, __m256i xi, __m256i xs, 
+  __m256i yi, __m256i ys, __m256i *zi, __m256i *zs)
+{
+  __m256i z = _mm256_setzero_si256(), ones = _mm256_set1_epi32(-1);
+  __m256i xl[2], xh[2], xv[2], xm[2], yl[2], yh[2], yv[2], ym[2];
+  __m256i lo = _mm256_set1_epi32(INT_MAX), hi = _mm256_set1_epi32(INT_MIN);
+  __m256i a, b, c, d, l, h, u, v, e;
+  int i, j;
+
+  xl[0] = xi;
+  xh[0] = _mm256_min_epi32(xs, ones);
+  xv[0] = _mm256_cmpgt_epi32(z, xi);
+  xl[1] = _mm256_max_epi32(xi, z);
+  xh[1] = xs;
+  xv[1] = _mm256_cmpgt_epi32(xs, ones);
+  yl[0] = yi;
+  yh[0] = _mm256_min_epi32(ys, ones);
+  yv[0] = _mm256_cmpgt_epi32(z, yi);
+  yl[1] = _mm256_max_epi32(yi, z);
+  yh[1] = ys;
+  yv[1] = _mm256_cmpgt_epi32(ys, ones);
+  for (i = 0; i < 2; i++)
+  {
+    xm[i] = smear_avx2(_mm256_xor_si256(xl[i], xh[i]));
+    ym[i] = smear_avx2(_mm256_xor_si256(yl[i], yh[i]));
+  }
+  for (i = 0; i < 2; i++)
+  {
+    for (j = 0; j < 2; j++)
+    {
+      a = xl[i];
+      b = xh[i];
+      c = yl[j];
+      d = yh[j];
+      if (op == INTERVAL_OP_AND)
+      {
+        l = minand_avx2(a, c, xm[i], ym[j]);
+        h = maxand_avx2(b, d, xm[i], ym[j]);
+      }
+      else if (op == INTERVAL_OP_IOR)
+      {
+        l = minor_avx2(a, c, xm[i], ym[j]);
+        h = maxor_avx2(b, d, xm[i], ym[j]);
+      }
+      else
+      {
+        l = _mm256_or_si256(minand_avx2(a, _mm256_xor_si256(d, ones), xm[i], ym[j]),
+                            minand_avx2(_mm256_xor_si256(b, ones), c, xm[i], ym[j]));
+        u = maxand_avx2(b, _mm256_xor_si256(c, ones), xm[i], ym[j]);
+        v = maxand_avx2(_mm256_xor_si256(a, ones), d, xm[i], ym[j]);
+        h = _mm256_or_si256(_mm256_or_si256(u, v), 
+              _mm256_srli_epi32(smear_avx2(_mm256_and_si256(u, v)), 1));
+      }
+      e = _mm256_and_si256(xv[i], yv[j]);
+      lo = _mm256_blendv_epi8(lo, _mm256_min_epi32(lo, l), e);
+      hi = _mm256_blendv_epi8(hi, _mm256_max_epi32(hi, h), e);
+    }
+  }
+  e = _mm256_or_si256(_mm256_cmpgt_epi32(xi, xs), _mm256_cmpgt_epi32(yi, ys));
+  *zi = _mm256_blendv_epi8(lo, _mm256_set1_epi32(1), e);
+  *zs = _mm256_andnot_si256(e, hi);
+}
+
+/* shift_avx2:
+ * Compute the bounds of x << y (SHL), x >>> y (SHR) and x >> y (SRA) on 8 
+ * lanes with the AVX2 variable shifts, as in interval.c. Empty operands give 
+ * [1,0]. Returns the mask of the lanes in error (shift amounts outside 
+ * [0,31], overflow, or negative values of an unsigned x), for which the 
+ * bounds are not valid.
+ */
+__attribute__((target("avx2")))
+static inline int shift_avx2(IntervalOpcode op, ArithType xtyp, __m256i xi, 
+  __m256i xs, __m256i yi, __m256i ys, __m256i *zi, __m256i *zs)
+{
+  __m256i z = _mm256_setzero_si256(), ones = _mm256_set1_epi32(-1);
+  __m256i e, bad, a, b, lo, hi, neg, xn;
+
+  e = _mm256_or_si256(_mm256_cmpgt_epi32(xi, xs), _mm256_cmpgt_epi32(yi, ys));
+  bad = _mm256_or_si256(_mm256_cmpgt_epi32(z, yi), 
+                        _mm256_cmpgt_epi32(ys, _mm256_set1_epi32(31)));
+  switch (op)
+  {
+    case INTERVAL_OP_SHL:
+      // Shifting back by the largest amount recovers x unless it overflows
+      a = _mm256_sllv_epi32(xi, ys);
+      b = _mm256_sllv_epi32(xs, ys);
+      bad = _mm256_or_si256(bad, _mm256_xor_si256(ones, _mm256_and_si256(
+              _mm256_cmpeq_epi32(_mm256_srav_epi32(a, ys), xi),
+              _mm256_cmpeq_epi32(_mm256_srav_epi32(b, ys), xs))));
+      lo = _mm256_min_epi32(_mm256_sllv_epi32(xi, yi), a);
+      hi = _mm256_max_epi32(_mm256_sllv_epi32(xs, yi), b);
+      break;
+    case INTERVAL_OP_SRA:
+      lo = _mm256_min_epi32(_mm256_srav_epi32(xi, yi), _mm256_srav_epi32(xi, ys));
+      hi = _mm256_max_epi32(_mm256_srav_epi32(xs, yi), _mm256_srav_epi32(xs, ys));
+      break;
+    default:
+      if (xtyp != UNSIGNED_ARITH && xtyp != SIGNED_ARITH && 
+          xtyp != SIGNED_POS_ARITH && xtyp != SIGNED_NEG_ARITH)
+      {
+        return (0xFF);
+      }
+      neg = _mm256_cmpgt_epi32(z, xi);
+      if (xtyp == UNSIGNED_ARITH || xtyp == SIGNED_POS_ARITH)
+      {
+        bad = _mm256_or_si256(bad, neg);
+      }
+      // The non-negative part, the negative part shifted by at least 1 and 
+      // the negative part shifted by 0 (left unchanged)
+      a = _mm256_cmpgt_epi32(xs, ones);
+      lo = _mm256_blendv_epi8(_mm256_set1_epi32(INT_MAX), 
+             _mm256_srlv_epi32(_mm256_max_epi32(xi, z), ys), a);
+      hi = _mm256_blendv_epi8(_mm256_set1_epi32(INT_MIN), 
+             _mm256_srlv_epi32(xs, yi), a);
+      xn = _mm256_min_epi32(xs, ones);
+      a = _mm256_and_si256(neg, _mm256_cmpgt_epi32(ys, z));
+      lo = _mm256_blendv_epi8(lo, _mm256_min_epi32(lo, _mm256_srlv_epi32(xi, ys)), a);
+      hi = _mm256_blendv_epi8(hi, _mm256_max_epi32(hi, _mm256_srlv_epi32(xn, 
+             _mm256_max_epi32(yi, _mm256_set1_epi32(1)))), a);
+      a = _mm256_and_si256(neg, _mm256_cmpeq_epi32(yi, z));
+      lo = _mm256_blendv_epi8(lo, _mm256_min_epi32(lo, xi), a);
+      hi = _mm256_blendv_epi8(hi, _mm256_max_epi32(hi, xn), a);
+      break;
+  }
+  *zi = _mm256_blendv_epi8(lo, _mm256_set1_epi32(1), e);
+  *zs = _mm256_andnot_si256(e, hi);
+  return (_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_andnot_si256(e, bad))));
+}
+
+/* sqrt_avx2:
+ * Compute the bounds of sqrt(x) on 8 lanes, as in interval.c: the integer 
+ * square roots are found bit by bit for both bounds at once, and the upper 
+ * bound is rounded up unless it is a perfect square. Returns the mask of the 
+ * lanes with negative values (domain errors), for which the bounds are not 
+ * valid.
+ */
+__attribute__((target("avx2")))
+static inline int sqrt_avx2(__m256i xi, __m256i xs, __m256i *zi, __m256i *zs)
+{
+  __m256i z = _mm256_setzero_si256(), sign = _mm256_set1_epi32(INT_MIN);
+  __m256i ri = z, rs = z, vi = xi, vs = xs, b, t, ge;
+  int k;
+
+  for (k = 30; k >= 0; k -= 2)
+  {
+    // v >= r + b, compared as unsigned
+    b = _mm256_set1_epi32(1 << k);
+    t = _mm256_add_epi32(ri, b);
+    ge = _mm256_cmpgt_epi32(_mm256_xor_si256(t, sign), _mm256_xor_si256(vi, sign));
+    vi = _mm256_sub_epi32(vi, _mm256_andnot_si256(ge, t));
+    ri = _mm256_add_epi32(_mm256_srli_epi32(ri, 1), _mm256_andnot_si256(ge, b));
+    t = _mm256_add_epi32(rs, b);
+    ge = _mm256_cmpgt_epi32(_mm256_xor_si256(t, sign), _mm256_xor_si256(vs, sign));
+    vs = _mm256_sub_epi32(vs, _mm256_andnot_si256(ge, t));
+    rs = _mm256_add_epi32(_mm256_srli_epi32(rs, 1), _mm256_andnot_si256(ge, b));
+  }
+  *zi = ri;
+  // rs + 1, less one (all ones) where rs * rs == xs
+  *zs = _mm256_add_epi32(_mm256_add_epi32(rs, _mm256_set1_epi32(1)), 
+          _mm256_cmpeq_epi32(_mm256_mullo_epi32(rs, rs), xs));
+  return (_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_or_si256(xi, xs))));
+}
+
+/* field_avx2:
+ * Evaluate IntervalTruncChecked(width, ztyp) on the x intervals shifted 
+ * right by shift (IntervalSlice), or IntervalConcatChecked(width) with the y 
+ * intervals if yinfm is not NULL, using AVX2. The arguments are assumed 
+ * valid. Returns the number of elements processed, stopping before the 
+ * first group of 8 holding an overflow.
+ */
+__attribute__((target("avx2")))
+static int field_avx2(int n, const int *xinfm, const int *xsupr, 
+  const int *yinfm, const int *ysupr, int width, int shift, ArithType ztyp, 
+  int *zinfm, int *zsupr)
+{
+  __m256i xi, xs, yi, ys, e, f, lo, hi, span;
+  __m256i ui, us, mask, sign = _mm256_set1_epi32(INT_MIN);
+  __m128i cnt = _mm_cvtsi32_si128(shift), w = _mm_cvtsi32_si128(width);
+  Interval u;
+  int i;
+
+  IntervalUniverseChecked(&u, width, ztyp);
+  ui = _mm256_set1_epi32(u.infm);
+  us = _mm256_set1_epi32(u.supr);
+  // mask = 2**width - 1, so that span <= mask compares the width of x
+  mask = _mm256_set1_epi32((int)(0xFFFFFFFFU >> (32 - width)));
+  for (i = 0; i + 8 <= n; i += 8)
+  {
+    xi = _mm256_loadu_si256((const __m256i *)(((yinfm != NULL) ? yinfm : xinfm) + i));
+    xs = _mm256_loadu_si256((const __m256i *)(((yinfm != NULL) ? ysupr : xsupr) + i));
+    e = _mm256_cmpgt_epi32(xi, xs);
+    xi = _mm256_sra_epi32(xi, cnt);
+    xs = _mm256_sra_epi32(xs, cnt);
+    // Fast path: lanes that fit in the n-bit range are left unchanged; the 
+    // others wrap modulo 2**n, or take the whole range if not contiguous
+    f = _mm256_andnot_si256(_mm256_or_si256(_mm256_cmpgt_epi32(ui, xi), 
+                                            _mm256_cmpgt_epi32(xs, us)), 
+                            _mm256_set1_epi32(-1));
+    lo = _mm256_add_epi32(ui, _mm256_and_si256(_mm256_sub_epi32(xi, ui), mask));
+    hi = _mm256_add_epi32(ui, _mm256_and_si256(_mm256_sub_epi32(xs, ui), mask));
+    span = _mm256_xor_si256(_mm256_sub_epi32(xs, xi), sign);
+    span = _mm256_or_si256(_mm256_cmpgt_epi32(span, _mm256_xor_si256(mask, sign)),
+                           _mm256_cmpgt_epi32(lo, hi));
+    lo = _mm256_blendv_epi8(_mm256_blendv_epi8(lo, ui, span), xi, f);
+    hi = _mm256_blendv_epi8(_mm256_blendv_epi8(hi, us, span), xs, f);
+    if (yinfm != NULL)
+    {
+      // {x, y}: x << width with the truncated y below, unless x overflows
+      xi = _mm256_loadu_si256((const __m256i *)(xinfm + i));
+      xs = _mm256_loadu_si256((const __m256i *)(xsupr + i));
+      e = _mm256_or_si256(e, _mm256_cmpgt_epi32(xi, xs));
+      yi = _mm256_sll_epi32(xi, w);
+      ys = _mm256_sll_epi32(xs, w);
+      f = _mm256_and_si256(_mm256_cmpeq_epi32(_mm256_sra_epi32(yi, w), xi), 
+                           _mm256_cmpeq_epi32(_mm256_sra_epi32(ys, w), xs));
+      if (_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_andnot_si256(f, 
+            _mm256_xor_si256(e, _mm256_set1_epi32(-1))))) != 0)
+      {
+        break;
+      }
+      lo = _mm256_or_si256(yi, lo);
+      hi = _mm256_or_si256(ys, hi);
+    }
+    lo = _mm256_blendv_epi8(lo, _mm256_set1_epi32(1), e);
+    hi = _mm256_andnot_si256(e, hi);
+    _mm256_storeu_si256((__m256i *)(zinfm + i), lo);
+    _mm256_storeu_si256((__m256i *)(zsupr + i), hi);
+  }
+
+  return (i);
+}
+
+/* pow_avx2:
+ * Compute x ** e for e >= 0 on 8 lanes by exponentiation by squaring, as 
+ * Pow32 in interval.c. The products are formed on 4 lanes of 64 bits at a 
+ * time, so that their overflow is detected exactly; the overflowing lanes 
+ * are set in *ovf.
+ */
+__attribute__((target("avx2")))
+static inline __m256i pow_avx2(__m256i x, int e, __m256i *ovf)
+{
+  __m256i hi = _mm256_set1_epi64x(INT_MAX), lo = _mm256_set1_epi64x(INT_MIN);
+  __m256i idx = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+  __m256i z[2], b[2], o[2];
+  int h, k;
+
+  for (h = 0; h < 2; h++)
+  {
+    z[h] = _mm256_set1_epi64x(1);
+    b[h] = _mm256_cvtepi32_epi64((h == 0) ? _mm256_castsi256_si128(x) 
+                                          : _mm256_extracti128_si256(x, 1));
+    o[h] = _mm256_setzero_si256();
+    for (k = e; k > 0; )
+    {
+      if (k & 1)
+      {
+        z[h] = _mm256_mul_epi32(z[h], b[h]);
+        o[h] = _mm256_or_si256(o[h], _mm256_or_si256(_mm256_cmpgt_epi64(z[h], hi), 
+                                                     _mm256_cmpgt_epi64(lo, z[h])));
+      }
+      k >>= 1;
+      if (k > 0)
+      {
+        b[h] = _mm256_mul_epi32(b[h], b[h]);
+        o[h] = _mm256_or_si256(o[h], _mm256_cmpgt_epi64(b[h], hi));
+      }
+    }
+    // Narrow to the low 32 bits of each lane
+    z[h] = _mm256_permutevar8x32_epi32(z[h], idx);
+    o[h] = _mm256_permutevar8x32_epi32(o[h], idx);
+  }
+  *ovf = _mm256_inserti128_si256(o[0], _mm256_castsi256_si128(o[1]), 1);
+  return (_mm256_inserti128_si256(z[0], _mm256_castsi256_si128(z[1]), 1));
+}
+
+/* exp_avx2:
+ * Evaluate IntervalExpIntegerChecked(e), for e >= 0, using AVX2. Returns the 
+ * number of elements processed, stopping before the first group of 8 holding 
+ * an overflow.
+ */
+__attribute__((target("avx2")))
+static int exp_avx2(int n, const int *xinfm, const int *xsupr, int e, 
+  int *zinfm, int *zsupr)
+{
+  __m256i xi, xs, pi, ps, oi, os, lo, hi, pos, neg, emp;
+  __m256i z = _mm256_setzero_si256();
+  int i;
+
+  for (i = 0; i + 8 <= n; i += 8)
+  {
+    xi = _mm256_loadu_si256((const __m256i *)(xinfm + i));
+    xs = _mm256_loadu_si256((const __m256i *)(xsupr + i));
+    emp = _mm256_cmpgt_epi32(xi, xs);
+    pi = pow_avx2(xi, e, &oi);
+    ps = pow_avx2(xs, e, &os);
+    if (_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_andnot_si256(emp, 
+          _mm256_or_si256(oi, os)))) != 0)
+    {
+      break;
+    }
+    lo = pi;
+    hi = ps;
+    if (e > 0 && (e & 1) == 0)
+    {
+      // [infm**e,supr**e] for x >= 0, [supr**e,infm**e] for x <= 0, and 
+      // [0,max] for an x containing zero
+      pos = _mm256_cmpgt_epi32(xi, _mm256_set1_epi32(-1));
+      neg = _mm256_cmpgt_epi32(_mm256_set1_epi32(1), xs);
+      lo = _mm256_blendv_epi8(_mm256_blendv_epi8(z, ps, neg), pi, pos);
+      hi = _mm256_blendv_epi8(_mm256_blendv_epi8(_mm256_max_epi32(pi, ps), pi, neg), 
+                              ps, pos);
+    }
+    lo = _mm256_blendv_epi8(lo, _mm256_set1_epi32(1), emp);
+    hi = _mm256_andnot_si256(emp, hi);
+    _mm256_storeu_si256((__m256i *)(zinfm + i), lo);
+    _mm256_storeu_si256((__m256i *)(zsupr + i), hi);
+  }
+
+  return (i);
+}
+
+/* batch_avx2:
+ * Evaluate the leading multiple-of-8 part of a batch using AVX2. Returns
+ * the number of elements processed.
+ */
+__attribute__((target("avx2")))
+static int batch_avx2(IntervalOpcode op, int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr, ArithType xtyp, ArithType ytyp)
+{
+  __m256i xi, xs, yi, ys, zi, zs;
+  __m256i pii, pis, psi, pss, e;
+  int mode = batch_mul_mode(xtyp, ytyp);
+  int i;
+
+  if (op == INTERVAL_OP_MUL && mode < 0)
+  {
+    return (0);
+  }
+  yi = ys = _mm256_setzero_si256();
+
+  for (i = 0; i + 8 <= n; i += 8)
+  {
+    xi = _mm256_loadu_si256((const __m256i *)(xinfm + i));
+    xs = _mm256_loadu_si256((const __m256i *)(xsupr + i));
+    if (yinfm != NULL)
+    {
+      yi = _mm256_loadu_si256((const __m256i *)(yinfm + i));
+      ys = _mm256_loadu_si256((const __m256i *)(ysupr + i));
+    }
+    switch (op)
+    {
+      case INTERVAL_OP_ADD:
+        zs = _mm256_add_epi32(xs, ys);
+        zi = _mm256_add_epi32(xi, yi);
+        break;
+      case INTERVAL_OP_SUB:
+        zs = _mm256_sub_epi32(xs, yi);
+        zi = _mm256_sub_epi32(xi, ys);
+        break;
+      case INTERVAL_OP_NEG:
+        zs = _mm256_sub_epi32(_mm256_setzero_si256(), xs);
+        zi = _mm256_sub_epi32(_mm256_setzero_si256(), xi);
+        break;
+      case INTERVAL_OP_MUL:
+        pii = _mm256_mullo_epi32(xi, yi);
+        pss = _mm256_mullo_epi32(xs, ys);
+        if (mode == 0)
+        {
+          zs = pss;
+          zi = pii;
+          break;
+        }
+        pis = _mm256_mullo_epi32(xi, ys);
+        psi = _mm256_mullo_epi32(xs, yi);
+        if (mode == 1)
+        {
+          zs = _mm256_max_epi32(pss, pis);
+          zi = _mm256_min_epi32(psi, pii);
+        }
+        else if (mode == 2)
+        {
+          zs = _mm256_max_epi32(pss, psi);
+          zi = _mm256_min_epi32(pis, pii);
+        }
+        else
+        {
+          zs = _mm256_max_epi32(_mm256_max_epi32(pii, pis),
+                                _mm256_max_epi32(psi, pss));
+          zi = _mm256_min_epi32(_mm256_min_epi32(pii, pis),
+                                _mm256_min_epi32(psi, pss));
+        }
+        break;
+      case INTERVAL_OP_ABS:
+        zs = _mm256_max_epi32(_mm256_abs_epi32(xs), _mm256_abs_epi32(xi));
+        zi = _mm256_setzero_si256();
+        break;
+      case INTERVAL_OP_MAX:
+        zs = _mm256_max_epi32(xs, ys);
+        zi = _mm256_max_epi32(xi, yi);
+        break;
+      case INTERVAL_OP_MIN:
+        zs = _mm256_min_epi32(xs, ys);
+        zi = _mm256_min_epi32(xi, yi);
+        break;
+      case INTERVAL_OP_MUX:
+      case INTERVAL_OP_UNION:
+        zs = _mm256_max_epi32(xs, ys);
+        zi = _mm256_min_epi32(xi, yi);
+        break;
+      case INTERVAL_OP_INTERSECTION:
+        zs = _mm256_min_epi32(xs, ys);
+        zi = _mm256_max_epi32(xi, yi);
+        // Empty operands or disjoint operands produce the [1,0] interval.
+        e = _mm256_or_si256(_mm256_or_si256(_mm256_cmpgt_epi32(xi, xs),
+                                            _mm256_cmpgt_epi32(yi, ys)),
+                            _mm256_cmpgt_epi32(zi, zs));
+        zs = _mm256_andnot_si256(e, zs);
+        zi = _mm256_blendv_epi8(zi, _mm256_set1_epi32(1), e);
+        break;
+      case INTERVAL_OP_AND:
+      case INTERVAL_OP_IOR:
+      case INTERVAL_OP_XOR:
+        bitwise_avx2(op, xi, xs, yi, ys, &zi, &zs);
+        break;
+      case INTERVAL_OP_NOT:
+        zs = _mm256_xor_si256(xi, _mm256_set1_epi32(-1));
+        zi = _mm256_xor_si256(xs, _mm256_set1_epi32(-1));
+        break;
+      case INTERVAL_OP_SHL:
+      case INTERVAL_OP_SHR:
+      case INTERVAL_OP_SRA:
+        // Groups holding an error are left to the scalar code
+        if (shift_avx2(op, xtyp, xi, xs, yi, ys, &zi, &zs) != 0)
+        {
+          return (i);
+        }
+        break;
+      case INTERVAL_OP_SQRT:
+        if (sqrt_avx2(xi, xs, &zi, &zs) != 0)
+        {
+          return (i);
+        }
+        break;
+      default:
+        return (i);
+    }
+    _mm256_storeu_si256((__m256i *)(zinfm + i), zi);
+    _mm256_storeu_si256((__m256i *)(zsupr + i), zs);
+  }
+
+  return (i);
+}
+
+/* The vector bitwidth kernels compute the bit length of (range - 1) from the 
+ * exponent of its single-precision conversion. Clearing every bit that 
+ * directly follows a set bit keeps the leading one and guarantees that the 
+ * conversion never rounds up to the next power of two; a set bit 31 (range 
+ * larger than 2**31) is handled separately, as the conversion is signed.
+ */
+
+/* bitwidth_sse41:
+ * Compute the bitwidth of the leading multiple-of-4 part of a batch using 
+ * SSE4.1. Empty intervals get a zero bitwidth and are flagged in err and mask; 
+ * if err is NULL, processing stops before the first group holding an empty 
+ * interval.
+ */
+__attribute__((target("sse4.1")))
+static int bitwidth_sse41(int n, const int *xinfm, const int *xsupr, int *bw, 
+  int *err, int *mask)
+{
+  __m128i xi, xs, r, e, empty;
+  int i, j, m;
+
+  for (i = 0; i + 4 <= n; i += 4)
+  {
+    xi = _mm_loadu_si128((const __m128i *)(xinfm + i));
+    xs = _mm_loadu_si128((const __m128i *)(xsupr + i));
+    empty = _mm_cmpgt_epi32(xi, xs);
+    m = _mm_movemask_ps(_mm_castsi128_ps(empty));
+    if (m != 0 && err == NULL)
+    {
+      break;
+    }
+    r = _mm_sub_epi32(xs, xi);
+    r = _mm_andnot_si128(_mm_srli_epi32(r, 1), r);
+    e = _mm_srli_epi32(_mm_castps_si128(_mm_cvtepi32_ps(r)), 23);
+    e = _mm_max_epi32(_mm_sub_epi32(e, _mm_set1_epi32(126)), _mm_setzero_si128());
+    e = _mm_blendv_epi8(e, _mm_set1_epi32(32), 
+          _mm_cmpgt_epi32(_mm_setzero_si128(), r));
+    _mm_storeu_si128((__m128i *)(bw + i), _mm_andnot_si128(empty, e));
+    if (m != 0)
+    {
+      *mask |= INTERVAL_ERR_EMPTY;
+    }
+    for (j = 0; m != 0; j++, m >>= 1)
+    {
+      if (m & 1)
+      {
+        err[i + j] |= INTERVAL_ERR_EMPTY;
+      }
+    }
+  }
+
+  return (i);
+}
+
+/* bitwidth_avx2:
+ * Compute the bitwidth of the leading multiple-of-8 part of a batch using 
+ * AVX2. Empty intervals get a zero bitwidth and are flagged in err and mask; 
+ * if err is NULL, processing stops before the first group holding an empty 
+ * interval.
+ */
+__attribute__((target("avx2")))
+static int bitwidth_avx2(int n, const int *xinfm, const int *xsupr, int *bw, 
+  int *err, int *mask)
+{
+  __m256i xi, xs, r, e, empty;
+  int i, j, m;
+
+  for (i = 0; i + 8 <= n; i += 8)
+  {
+    xi = _mm256_loadu_si256((const __m256i *)(xinfm + i));
+    xs = _mm256_loadu_si256((const __m256i *)(xsupr + i));
+    empty = _mm256_cmpgt_epi32(xi, xs);
+    m = _mm256_movemask_ps(_mm256_castsi256_ps(empty));
+    if (m != 0 && err == NULL)
+    {
+      break;
+    }
+    r = _mm256_sub_epi32(xs, xi);
+    r = _mm256_andnot_si256(_mm256_srli_epi32(r, 1), r);
+    e = _mm256_srli_epi32(_mm256_castps_si256(_mm256_cvtepi32_ps(r)), 23);
+    e = _mm256_max_epi32(_mm256_sub_epi32(e, _mm256_set1_epi32(126)), 
+          _mm256_setzero_si256());
+    e = _mm256_blendv_epi8(e, _mm256_set1_epi32(32), 
+          _mm256_cmpgt_epi32(_mm256_setzero_si256(), r));
+    _mm256_storeu_si256((__m256i *)(bw + i), _mm256_andnot_si256(empty, e));
+    if (m != 0)
+    {
+      *mask |= INTERVAL_ERR_EMPTY;
+    }
+    for (j = 0; m != 0; j++, m >>= 1)
+    {
+      if (m & 1)
+      {
+        err[i + j] |= INTERVAL_ERR_EMPTY;
+      }
+    }
+  }
+
+  return (i);
+}
+
+/* check_sse41:
+ * Check the leading multiple-of-4 part of array v against interval [lo,hi]
+ * using SSE4.1, accumulating into c; in[i] (if in is not NULL) is set to
+ * whether v[i] lies in the interval. Returns the number of values processed.
+ */
+__attribute__((target("sse4.1")))
+static int check_sse41(int lo, int hi, int n, const int *v, int *in, 
+  BatchCheck *c)
+{
+  __m128i vlo = _mm_set1_epi32(lo), vhi = _mm_set1_epi32(hi);
+  __m128i x, out, cnt = _mm_setzero_si128();
+  __m128i mn = _mm_set1_epi32(c->vmin), mx = _mm_set1_epi32(c->vmax);
+  int t[4], i, j, m;
+
+  for (i = 0; i + 4 <= n; i += 4)
+  {
+    x = _mm_loadu_si128((const __m128i *)(v + i));
+    out = _mm_or_si128(_mm_cmpgt_epi32(vlo, x), _mm_cmpgt_epi32(x, vhi));
+    cnt = _mm_sub_epi32(cnt, out);
+    mn = _mm_min_epi32(mn, x);
+    mx = _mm_max_epi32(mx, x);
+    if (in != NULL)
+    {
+      _mm_storeu_si128((__m128i *)(in + i), _mm_add_epi32(out, _mm_set1_epi32(1)));
+    }
+    if (c->first < 0 && (m = _mm_movemask_ps(_mm_castsi128_ps(out))) != 0)
+    {
+      c->first = i + __builtin_ctz(m);
+    }
+  }
+  _mm_storeu_si128((__m128i *)t, cnt);
+  for (j = 0; j < 4; j++)
+  {
+    c->count += t[j];
+  }
+  _mm_storeu_si128((__m128i *)t, mn);
+  for (j = 0; j < 4; j++)
+  {
+    c->vmin = MIN(c->vmin, t[j]);
+  }
+  _mm_storeu_si128((__m128i *)t, mx);
+  for (j = 0; j < 4; j++)
+  {
+    c->vmax = MAX(c->vmax, t[j]);
+  }
+
+  return (i);
+}
+
+/* check_avx2:
+ * AVX2 version of check_sse41, for the leading multiple-of-8 part of v.
+ */
+__attribute__((target("avx2")))
+static int check_avx2(int lo, int hi, int n, const int *v, int *in, 
+  BatchCheck *c)
+{
+  __m256i vlo = _mm256_set1_epi32(lo), vhi = _mm256_set1_epi32(hi);
+  __m256i x, out, cnt = _mm256_setzero_si256();
+  __m256i mn = _mm256_set1_epi32(c->vmin), mx = _mm256_set1_epi32(c->vmax);
+  int t[8], i, j, m;
+
+  for (i = 0; i + 8 <= n; i += 8)
+  {
+    x = _mm256_loadu_si256((const __m256i *)(v + i));
+    out = _mm256_or_si256(_mm256_cmpgt_epi32(vlo, x), _mm256_cmpgt_epi32(x, vhi));
+    cnt = _mm256_sub_epi32(cnt, out);
+    mn = _mm256_min_epi32(mn, x);
+    mx = _mm256_max_epi32(mx, x);
+    if (in != NULL)
+    {
+      _mm256_storeu_si256((__m256i *)(in + i), 
+        _mm256_add_epi32(out, _mm256_set1_epi32(1)));
+    }
+    if (c->first < 0 && (m = _mm256_movemask_ps(_mm256_castsi256_ps(out))) != 0)
+    {
+      c->first = i + __builtin_ctz(m);
+    }
+  }
+  _mm256_storeu_si256((__m256i *)t, cnt);
+  for (j = 0; j < 8; j++)
+  {
+    c->count += t[j];
+  }
+  _mm256_storeu_si256((__m256i *)t, mn);
+  for (j = 0; j < 8; j++)
+  {
+    c->vmin = MIN(c->vmin, t[j]);
+  }
+  _mm256_storeu_si256((__m256i *)t, mx);
+  for (j = 0; j < 8; j++)
+  {
+    c->vmax = MAX(c->vmax, t[j]);
+  }
+
+  return (i);
+}
+
+/* check_avx512:
+ * AVX-512F version of check_sse41, for the leading multiple-of-16 part of v.
+ * The comparisons produce mask registers, which count the violations 
+ * directly.
+ */
+__attribute__((target("avx512f")))
+static int check_avx512(int lo, int hi, int n, const int *v, int *in, 
+  BatchCheck *c)
+{
+  __m512i vlo = _mm512_set1_epi32(lo), vhi = _mm512_set1_epi32(hi);
+  __m512i x, one = _mm512_set1_epi32(1), cnt = _mm512_setzero_si512();
+  __m512i mn = _mm512_set1_epi32(c->vmin), mx = _mm512_set1_epi32(c->vmax);
+  __mmask16 out;
+  int i;
+
+  for (i = 0; i + 16 <= n; i += 16)
+  {
+    x = _mm512_loadu_si512((const void *)(v + i));
+    out = _mm512_cmpgt_epi32_mask(vlo, x) | _mm512_cmpgt_epi32_mask(x, vhi);
+    cnt = _mm512_mask_add_epi32(cnt, out, cnt, one);
+    mn = _mm512_min_epi32(mn, x);
+    mx = _mm512_max_epi32(mx, x);
+    if (in != NULL)
+    {
+      _mm512_storeu_si512((void *)(in + i), _mm512_maskz_mov_epi32(~out, one));
+    }
+    if (c->first < 0 && out != 0)
+    {
+      c->first = i + __builtin_ctz(out);
+    }
+  }
+  c->count += _mm512_reduce_add_epi32(cnt);
+  c->vmin = MIN(c->vmin, _mm512_reduce_min_epi32(mn));
+  c->vmax = MAX(c->vmax, _mm512_reduce_max_epi32(mx));
+
+  return (i);
+}
+#endif /* INTERVAL_BATCH_X86 */
+
+/* IntervalBatchGetIsa:
+ * Return the instruction set currently used by the batch kernels. On first
+ * use, the widest instruction set supported by the host is selected.
+ */
+IntervalIsa IntervalBatchGetIsa(void)
+{
+  if (batch_isa < 0)
+  {
+    batch_isa = batch_detect_isa();
+  }
+  return ((IntervalIsa)batch_isa);
+}
+
+/* IntervalBatchSetIsa:
+ * Request a specific instruction set for the batch kernels, e.g. for
+ * benchmarking. The request is limited to what the host supports; the
+ * instruction set actually selected is returned.
+ */
+IntervalIsa IntervalBatchSetIsa(IntervalIsa isa)
+{
+  IntervalIsa host = batch_detect_isa();
+  batch_isa = (isa > host) ? host : isa;
+  return ((IntervalIsa)batch_isa);
+}
+
+/* IntervalBatchIsaName:
+ * Return a printable name for the given instruction set.
+ */
+const char *IntervalBatchIsaName(IntervalIsa isa)
+{
+  switch (isa)
+  {
+    case INTERVAL_ISA_SSE41:  return ("sse4.1");
+    case INTERVAL_ISA_AVX2:   return ("avx2");
+    case INTERVAL_ISA_AVX512: return ("avx512");
+    default:                  return ("scalar");
+  }
+}
+
+/* IntervalOpcodeArity:
+ * Return the number of interval operands of operation op (1 or 2), or 0 for 
+ * an invalid opcode.
+ */
+int IntervalOpcodeArity(IntervalOpcode op)
+{
+  switch (op)
+  {
+    case INTERVAL_OP_NEG:
+    case INTERVAL_OP_ABS:
+    case INTERVAL_OP_SQRT:
+    case INTERVAL_OP_NOT:
+      return (1);
+    default:
+      return ((op >= 0 && op < INTERVAL_NUM_OPCODES) ? 2 : 0);
+  }
+}
+
+/* batch_vector:
+ * Evaluate the leading part of a batch with the kernels of the instruction 
+ * set in use. Returns the number of elements processed.
+ */
+static int batch_vector(IntervalOpcode op, int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr, ArithType xtyp, ArithType ytyp)
+{
+  int i = 0;
+
+#ifdef INTERVAL_BATCH_X86
+  switch (IntervalBatchGetIsa())
+  {
+    case INTERVAL_ISA_AVX512:
+    case INTERVAL_ISA_AVX2:
+      i = batch_avx2(op, n, xinfm, xsupr, yinfm, ysupr, zinfm, zsupr, xtyp, ytyp);
+      break;
+    case INTERVAL_ISA_SSE41:
+      i = batch_sse41(op, n, xinfm, xsupr, yinfm, ysupr, zinfm, zsupr, xtyp, ytyp);
+      break;
+    default:
+      break;
+  }
+#else
+  (void)op; (void)n; (void)xinfm; (void)xsupr; (void)yinfm; (void)ysupr;
+  (void)zinfm; (void)zsupr; (void)xtyp; (void)ytyp;
+#endif
+
+  return (i);
+}
+
+/* IntervalBatchEval:
+ * Evaluate operation op over a batch of n interval pairs. The i-th result
+ * [zinfm[i],zsupr[i]] is the same as the one returned by the corresponding
+ * scalar function for [xinfm[i],xsupr[i]] and [yinfm[i],ysupr[i]]. For unary
+ * operations, yinfm and ysupr may be NULL. xtyp, ytyp provide the arithmetic
+ * representation type for x and y, respectively (used by IntervalMul and 
+ * IntervalShr only).
+ */
+void IntervalBatchEval(IntervalOpcode op, int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr, ArithType xtyp, ArithType ytyp)
+{
+  int i;
+
+  if (IntervalOpcodeArity(op) == 2 && (yinfm == NULL || ysupr == NULL))
+  {
+    fprintf(stderr, "Error: Missing y operand arrays in IntervalBatchEval.\n");
+    exit(1);
+  }
+
+  i = batch_vector(op, n, xinfm, xsupr, yinfm, ysupr, zinfm, zsupr, xtyp, ytyp);
+  batch_scalar(op, i, n, xinfm, xsupr, yinfm, ysupr, zinfm, zsupr, xtyp, ytyp);
+}
+
+/* IntervalAddBatch:
+ * Batch version of IntervalAdd.
+ */
+void IntervalAddBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr)
+{
+  IntervalBatchEval(INTERVAL_OP_ADD, n, xinfm, xsupr, yinfm, ysupr,
+    zinfm, zsupr, UNKNOWN_ARITH_TYPE, UNKNOWN_ARITH_TYPE);
+}
+
+/* IntervalSubBatch:
+ * Batch version of IntervalSub.
+ */
+void IntervalSubBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr)
+{
+  IntervalBatchEval(INTERVAL_OP_SUB, n, xinfm, xsupr, yinfm, ysupr,
+    zinfm, zsupr, UNKNOWN_ARITH_TYPE, UNKNOWN_ARITH_TYPE);
+}
+
+/* IntervalNegBatch:
+ * Batch version of IntervalNeg.
+ */
+void IntervalNegBatch(int n,
+       const int *xinfm, const int *xsupr, int *zinfm, int *zsupr)
+{
+  IntervalBatchEval(INTERVAL_OP_NEG, n, xinfm, xsupr, NULL, NULL,
+    zinfm, zsupr, UNKNOWN_ARITH_TYPE, UNKNOWN_ARITH_TYPE);
+}
+
+/* IntervalMulBatch:
+ * Batch version of IntervalMul. xtyp, ytyp provide the arithmetic
+ * representation type for all x and y intervals, respectively.
+ */
+void IntervalMulBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr, ArithType xtyp, ArithType ytyp)
+{
+  IntervalBatchEval(INTERVAL_OP_MUL, n, xinfm, xsupr, yinfm, ysupr,
+    zinfm, zsupr, xtyp, ytyp);
+}
+
+/* IntervalAbsBatch:
+ * Batch version of IntervalAbs.
+ */
+void IntervalAbsBatch(int n,
+       const int *xinfm, const int *xsupr, int *zinfm, int *zsupr)
+{
+  IntervalBatchEval(INTERVAL_OP_ABS, n, xinfm, xsupr, NULL, NULL,
+    zinfm, zsupr, UNKNOWN_ARITH_TYPE, UNKNOWN_ARITH_TYPE);
+}
+
+/* IntervalMaxBatch:
+ * Batch version of IntervalMax.
+ */
+void IntervalMaxBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr)
+{
+  IntervalBatchEval(INTERVAL_OP_MAX, n, xinfm, xsupr, yinfm, ysupr,
+    zinfm, zsupr, UNKNOWN_ARITH_TYPE, UNKNOWN_ARITH_TYPE);
+}
+
+/* IntervalMinBatch:
+ * Batch version of IntervalMin.
+ */
+void IntervalMinBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr)
+{
+  IntervalBatchEval(INTERVAL_OP_MIN, n, xinfm, xsupr, yinfm, ysupr,
+    zinfm, zsupr, UNKNOWN_ARITH_TYPE, UNKNOWN_ARITH_TYPE);
+}
+
+/* IntervalMuxBatch:
+ * Batch version of IntervalMux.
+ */
+void IntervalMuxBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr)
+{
+  IntervalBatchEval(INTERVAL_OP_MUX, n, xinfm, xsupr, yinfm, ysupr,
+    zinfm, zsupr, UNKNOWN_ARITH_TYPE, UNKNOWN_ARITH_TYPE);
+}
+
+/* IntervalUnionBatch:
+ * Batch version of IntervalUnion (interval hull).
+ */
+void IntervalUnionBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr)
+{
+  IntervalBatchEval(INTERVAL_OP_UNION, n, xinfm, xsupr, yinfm, ysupr,
+    zinfm, zsupr, UNKNOWN_ARITH_TYPE, UNKNOWN_ARITH_TYPE);
+}
+
+/* IntervalIntersectionBatch:
+ * Batch version of IntervalIntersection. Empty intersections are returned
+ * as the [1,0] interval.
+ */
+void IntervalIntersectionBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr)
+{
+  IntervalBatchEval(INTERVAL_OP_INTERSECTION, n, xinfm, xsupr, yinfm, ysupr,
+    zinfm, zsupr, UNKNOWN_ARITH_TYPE, UNKNOWN_ARITH_TYPE);
+}
+
+/* IntervalAndBatch:
+ * Batch version of IntervalAnd.
+ */
+void IntervalAndBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr)
+{
+  IntervalBatchEval(INTERVAL_OP_AND, n, xinfm, xsupr, yinfm, ysupr,
+    zinfm, zsupr, UNKNOWN_ARITH_TYPE, UNKNOWN_ARITH_TYPE);
+}
+
+/* IntervalIorBatch:
+ * Batch version of IntervalIor.
+ */
+void IntervalIorBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr)
+{
+  IntervalBatchEval(INTERVAL_OP_IOR, n, xinfm, xsupr, yinfm, ysupr,
+    zinfm, zsupr, UNKNOWN_ARITH_TYPE, UNKNOWN_ARITH_TYPE);
+}
+
+/* IntervalXorBatch:
+ * Batch version of IntervalXor.
+ */
+void IntervalXorBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr)
+{
+  IntervalBatchEval(INTERVAL_OP_XOR, n, xinfm, xsupr, yinfm, ysupr,
+    zinfm, zsupr, UNKNOWN_ARITH_TYPE, UNKNOWN_ARITH_TYPE);
+}
+
+/* IntervalNotBatch:
+ * Batch version of IntervalNot.
+ */
+void IntervalNotBatch(int n,
+       const int *xinfm, const int *xsupr, int *zinfm, int *zsupr)
+{
+  IntervalBatchEval(INTERVAL_OP_NOT, n, xinfm, xsupr, NULL, NULL,
+    zinfm, zsupr, UNKNOWN_ARITH_TYPE, UNKNOWN_ARITH_TYPE);
+}
+
+/* IntervalToIntegerBitwidthBatch:
+ * Batch version of IntervalToIntegerBitwidth: bw[i] receives the minimum 
+ * bitwidth of interval [xinfm[i],xsupr[i]]. xtyp provides the arithmetic 
+ * type for the assumed integer representation of all intervals.
+ */
+void IntervalToIntegerBitwidthBatch(int n,
+       const int *xinfm, const int *xsupr, ArithType xtyp, int *bw)
+{
+  int i = 0;
+
+#ifdef INTERVAL_BATCH_X86
+  if (xtyp == UNSIGNED_ARITH || xtyp == SIGNED_ARITH)
+  {
+    switch (IntervalBatchGetIsa())
+    {
+      case INTERVAL_ISA_AVX512:
+      case INTERVAL_ISA_AVX2:
+        i = bitwidth_avx2(n, xinfm, xsupr, bw, NULL, NULL);
+        break;
+      case INTERVAL_ISA_SSE41:
+        i = bitwidth_sse41(n, xinfm, xsupr, bw, NULL, NULL);
+        break;
+      default:
+        break;
+    }
+  }
+#endif
+
+  for (; i < n; i++)
+  {
+    bw[i] = IntervalToIntegerBitwidth(INTERVAL(xinfm[i], xsupr[i]), xtyp);
+  }
+}
+
+/* batch_check:
+ * Check the n values of v against interval x, accumulating into c; in[i] (if 
+ * in is not NULL) is set to ValueIsInInterval(x, v[i]).
+ */
+static void batch_check(Interval x, int n, const int *v, int *in, BatchCheck *c)
+{
+  int i = 0, out;
+
+  c->count = 0;
+  c->first = -1;
+  c->vmin = INT_MAX;
+  c->vmax = INT_MIN;
+#ifdef INTERVAL_BATCH_X86
+  switch (IntervalBatchGetIsa())
+  {
+    case INTERVAL_ISA_AVX512:
+      i = check_avx512(x.infm, x.supr, n, v, in, c);
+      break;
+    case INTERVAL_ISA_AVX2:
+      i = check_avx2(x.infm, x.supr, n, v, in, c);
+      break;
+    case INTERVAL_ISA_SSE41:
+      i = check_sse41(x.infm, x.supr, n, v, in, c);
+      break;
+    default:
+      break;
+  }
+#endif
+
+  for (; i < n; i++)
+  {
+    out = (v[i] < x.infm) | (v[i] > x.supr);
+    if (in != NULL)
+    {
+      in[i] = !out;
+    }
+    if (c->first < 0 && out)
+    {
+      c->first = i;
+    }
+    c->count += out;
+    c->vmin = MIN(c->vmin, v[i]);
+    c->vmax = MAX(c->vmax, v[i]);
+  }
+}
+
+/* ValueIsInIntervalBatch:
+ * Batch version of ValueIsInInterval for a single interval: in[i] is set to 
+ * ValueIsInInterval(x, v[i]). Returns the number of values in x.
+ */
+int ValueIsInIntervalBatch(Interval x, int n, const int *v, int *in)
+{
+  BatchCheck c;
+
+  batch_check(x, n, v, in, &c);
+  return (n - c.count);
+}
+
+/* IntervalViolationsBatch:
+ * Return the number of values of v lying outside interval x (all of them if 
+ * x is empty). The index of the first such value, or -1 if there is none, is 
+ * stored in *first (first may be NULL).
+ */
+int IntervalViolationsBatch(Interval x, int n, const int *v, int *first)
+{
+  BatchCheck c;
+
+  batch_check(x, n, v, NULL, &c);
+  if (first != NULL)
+  {
+    *first = c.first;
+  }
+  return (c.count);
+}
+
+/* IntervalViolationsMinMaxBatch:
+ * Same as IntervalViolationsBatch; the range [min,max] of the values (empty 
+ * if n is 0) is computed in the same pass and stored in *range.
+ */
+int IntervalViolationsMinMaxBatch(Interval x, int n, const int *v, int *first,
+      Interval *range)
+{
+  BatchCheck c;
+
+  batch_check(x, n, v, NULL, &c);
+  if (first != NULL)
+  {
+    *first = c.first;
+  }
+  *range = (n > 0) ? INTERVAL(c.vmin, c.vmax) : IntervalEmpty();
+  return (c.count);
+}
+
+/* IntervalBatchEvalChecked:
+ * Non-aborting version of IntervalBatchEval. The status flags of the i-th 
+ * element are OR-ed into err[i] (err may be NULL); elements in error receive 
+ * the empty interval [1,0]. Returns the OR of the flags of all elements.
+ */
+int IntervalBatchEvalChecked(IntervalOpcode op, int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr, ArithType xtyp, ArithType ytyp, int *err)
+{
+  int i, j, mask = INTERVAL_OK;
+
+  if (IntervalOpcodeArity(op) == 2 && (yinfm == NULL || ysupr == NULL))
+  {
+    op = (IntervalOpcode)-1;
+  }
+
+  switch (op)
+  {
+    case INTERVAL_OP_MUL:
+      if (batch_mul_mode(xtyp, ytyp) >= 0)
+      {
+        break;
+      }
+      /* fall through */
+    case INTERVAL_OP_DIV:
+    case INTERVAL_OP_MOD:
+    case INTERVAL_OP_SET:
+      return (batch_scalar_checked(op, 0, n, xinfm, xsupr, yinfm, ysupr, 
+                zinfm, zsupr, xtyp, ytyp, err));
+    case INTERVAL_OP_SQRT:
+    case INTERVAL_OP_SHL:
+    case INTERVAL_OP_SHR:
+    case INTERVAL_OP_SRA:
+      // The vector kernels stop before a group holding an error, which is 
+      // evaluated by the scalar code before resuming (y is NULL for SQRT)
+      for (i = 0; i < n; i = j)
+      {
+        i += batch_vector(op, n - i, xinfm + i, xsupr + i, 
+               (yinfm != NULL) ? yinfm + i : NULL, (ysupr != NULL) ? ysupr + i : NULL, 
+               zinfm + i, zsupr + i, xtyp, ytyp);
+        j = MIN(i + 8, n);
+        mask |= batch_scalar_checked(op, i, j, xinfm, xsupr, yinfm, ysupr, 
+                  zinfm, zsupr, xtyp, ytyp, err);
+      }
+      return (mask);
+    case INTERVAL_OP_ADD:
+    case INTERVAL_OP_SUB:
+    case INTERVAL_OP_NEG:
+    case INTERVAL_OP_ABS:
+    case INTERVAL_OP_MAX:
+    case INTERVAL_OP_MIN:
+    case INTERVAL_OP_MUX:
+    case INTERVAL_OP_UNION:
+    case INTERVAL_OP_INTERSECTION:
+    case INTERVAL_OP_AND:
+    case INTERVAL_OP_IOR:
+    case INTERVAL_OP_XOR:
+    case INTERVAL_OP_NOT:
+      break;
+    default:
+      for (i = 0; i < n; i++)
+      {
+        zinfm[i] = 1;
+        zsupr[i] = 0;
+        if (err != NULL)
+        {
+          err[i] |= INTERVAL_ERR_INVALID;
+        }
+      }
+      return ((n > 0) ? INTERVAL_ERR_INVALID : INTERVAL_OK);
+  }
+
+  // The remaining operations cannot fail.
+  IntervalBatchEval(op, n, xinfm, xsupr, yinfm, ysupr, zinfm, zsupr, xtyp, ytyp);
+  return (INTERVAL_OK);
+}
+
+/* IntervalDivBatch:
+ * Non-aborting batch version of IntervalDiv; a divisor containing zero flags 
+ * INTERVAL_ERR_DIV_ZERO for its element only. See IntervalBatchEvalChecked.
+ */
+int IntervalDivBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr, ArithType xtyp, ArithType ytyp, int *err)
+{
+  return (IntervalBatchEvalChecked(INTERVAL_OP_DIV, n, xinfm, xsupr, yinfm, ysupr,
+            zinfm, zsupr, xtyp, ytyp, err));
+}
+
+/* IntervalModBatch:
+ * Non-aborting batch version of IntervalMod. See IntervalBatchEvalChecked.
+ */
+int IntervalModBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr, ArithType xtyp, int *err)
+{
+  return (IntervalBatchEvalChecked(INTERVAL_OP_MOD, n, xinfm, xsupr, yinfm, ysupr,
+            zinfm, zsupr, xtyp, UNKNOWN_ARITH_TYPE, err));
+}
+
+/* IntervalSqrtBatch:
+ * Non-aborting batch version of IntervalSqrt. See IntervalBatchEvalChecked.
+ */
+int IntervalSqrtBatch(int n,
+       const int *xinfm, const int *xsupr, int *zinfm, int *zsupr, int *err)
+{
+  return (IntervalBatchEvalChecked(INTERVAL_OP_SQRT, n, xinfm, xsupr, NULL, NULL,
+            zinfm, zsupr, UNKNOWN_ARITH_TYPE, UNKNOWN_ARITH_TYPE, err));
+}
+
+/* IntervalShlBatch:
+ * Non-aborting batch version of IntervalShl; y holds the shift amounts. See 
+ * IntervalBatchEvalChecked.
+ */
+int IntervalShlBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr, int *err)
+{
+  return (IntervalBatchEvalChecked(INTERVAL_OP_SHL, n, xinfm, xsupr, yinfm, ysupr,
+            zinfm, zsupr, UNKNOWN_ARITH_TYPE, UNKNOWN_ARITH_TYPE, err));
+}
+
+/* IntervalShrBatch:
+ * Non-aborting batch version of IntervalShr; y holds the shift amounts. See 
+ * IntervalBatchEvalChecked.
+ */
+int IntervalShrBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr, ArithType xtyp, int *err)
+{
+  return (IntervalBatchEvalChecked(INTERVAL_OP_SHR, n, xinfm, xsupr, yinfm, ysupr,
+            zinfm, zsupr, xtyp, UNKNOWN_ARITH_TYPE, err));
+}
+
+/* IntervalSraBatch:
+ * Non-aborting batch version of IntervalSra; y holds the shift amounts. See 
+ * IntervalBatchEvalChecked.
+ */
+int IntervalSraBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr, int *err)
+{
+  return (IntervalBatchEvalChecked(INTERVAL_OP_SRA, n, xinfm, xsupr, yinfm, ysupr,
+            zinfm, zsupr, UNKNOWN_ARITH_TYPE, UNKNOWN_ARITH_TYPE, err));
+}
+
+/* batch_param:
+ * Evaluate IntervalTruncChecked (kind 0), IntervalSliceChecked (kind 1), 
+ * IntervalConcatChecked (kind 2) or IntervalExpIntegerChecked (kind 3) over 
+ * a batch, with the flags of each element OR-ed into err[i] (err may be 
+ * NULL). a and b are the width and representation type, the bit field 
+ * [a:b], the width of y, or the exponent, respectively. Returns the OR of 
+ * the flags of all elements.
+ */
+static int batch_param(int kind, int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int a, int b, int *zinfm, int *zsupr, int *err)
+{
+  Interval x, y, z;
+  int i, j, f, status, mask = INTERVAL_OK;
+
+  // The vector kernel assumes valid arguments; invalid ones are left to the 
+  // scalar loop, where every element fails
+  x = IntervalEmpty();
+  switch (kind)
+  {
+    case 0:  status = IntervalTruncChecked(&z, x, a, (ArithType)b); break;
+    case 1:  status = IntervalSliceChecked(&z, x, a, b); break;
+    case 2:  status = IntervalConcatChecked(&z, x, x, a); break;
+    default: status = IntervalExpIntegerChecked(&z, x, a); break;
+  }
+  for (i = 0; i < n; i = j)
+  {
+#ifdef INTERVAL_BATCH_X86
+    if (status == INTERVAL_OK && IntervalBatchGetIsa() >= INTERVAL_ISA_AVX2)
+    {
+      switch (kind)
+      {
+        case 0:
+          i += field_avx2(n - i, xinfm + i, xsupr + i, NULL, NULL, a, 0, 
+                 (ArithType)b, zinfm + i, zsupr + i);
+          break;
+        case 1:
+          i += field_avx2(n - i, xinfm + i, xsupr + i, NULL, NULL, a - b + 1, b, 
+                 UNSIGNED_ARITH, zinfm + i, zsupr + i);
+          break;
+        case 2:
+          i += field_avx2(n - i, xinfm + i, xsupr + i, yinfm + i, ysupr + i, a, 0, 
+                 UNSIGNED_ARITH, zinfm + i, zsupr + i);
+          break;
+        default:
+          i += exp_avx2(n - i, xinfm + i, xsupr + i, a, zinfm + i, zsupr + i);
+          break;
+      }
+    }
+#endif
+    // The group where the kernel stopped (or the tail) is evaluated here
+    for (j = MIN(i + 8, n); i < j; i++)
+    {
+      x = INTERVAL(xinfm[i], xsupr[i]);
+      switch (kind)
+      {
+        case 0:  f = IntervalTruncChecked(&z, x, a, (ArithType)b); break;
+        case 1:  f = IntervalSliceChecked(&z, x, a, b); break;
+        case 2:
+          y = INTERVAL(yinfm[i], ysupr[i]);
+          f = IntervalConcatChecked(&z, x, y, a);
+          break;
+        default: f = IntervalExpIntegerChecked(&z, x, a); break;
+      }
+      zinfm[i] = z.infm;
+      zsupr[i] = z.supr;
+      if (err != NULL)
+      {
+        err[i] |= f;
+      }
+      mask |= f;
+    }
+  }
+
+  return (mask);
+}
+
+/* IntervalTruncBatch:
+ * Non-aborting batch version of IntervalTrunc, truncating all intervals to 
+ * width bits of representation ztyp. See IntervalBatchEvalChecked.
+ */
+int IntervalTruncBatch(int n,
+       const int *xinfm, const int *xsupr, int width, ArithType ztyp,
+       int *zinfm, int *zsupr, int *err)
+{
+  return (batch_param(0, n, xinfm, xsupr, NULL, NULL, width, (int)ztyp, 
+            zinfm, zsupr, err));
+}
+
+/* IntervalSliceBatch:
+ * Non-aborting batch version of IntervalSlice, extracting the bit field 
+ * [hi:lo] of all intervals. See IntervalBatchEvalChecked.
+ */
+int IntervalSliceBatch(int n,
+       const int *xinfm, const int *xsupr, int hi, int lo,
+       int *zinfm, int *zsupr, int *err)
+{
+  return (batch_param(1, n, xinfm, xsupr, NULL, NULL, hi, lo, zinfm, zsupr, err));
+}
+
+/* IntervalConcatBatch:
+ * Non-aborting batch version of IntervalConcat, concatenating each x with 
+ * the width least significant bits of y. See IntervalBatchEvalChecked.
+ */
+int IntervalConcatBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int width, int *zinfm, int *zsupr, int *err)
+{
+  if (yinfm == NULL || ysupr == NULL)
+  {
+    return (IntervalBatchEvalChecked((IntervalOpcode)-1, n, xinfm, xsupr, NULL, NULL, 
+              zinfm, zsupr, UNKNOWN_ARITH_TYPE, UNKNOWN_ARITH_TYPE, err));
+  }
+  return (batch_param(2, n, xinfm, xsupr, yinfm, ysupr, width, 0, zinfm, zsupr, err));
+}
+
+/* IntervalExpIntegerBatch:
+ * Non-aborting batch version of IntervalExpInteger, raising all intervals to 
+ * the power e. See IntervalBatchEvalChecked.
+ */
+int IntervalExpIntegerBatch(int n,
+       const int *xinfm, const int *xsupr, int e, int *zinfm, int *zsupr, int *err)
+{
+  return (batch_param(3, n, xinfm, xsupr, NULL, NULL, e, 0, zinfm, zsupr, err));
+}
+
+/* IntervalToIntegerBitwidthBatchChecked:
+ * Non-aborting version of IntervalToIntegerBitwidthBatch. Empty intervals get 
+ * a zero bitwidth and INTERVAL_ERR_EMPTY is OR-ed into their err[i] (err may 
+ * be NULL). Returns the OR of the flags of all elements.
+ */
+int IntervalToIntegerBitwidthBatchChecked(int n,
+       const int *xinfm, const int *xsupr, ArithType xtyp, int *bw, int *err)
+{
+  int i = 0, status, mask = INTERVAL_OK;
+
+#ifdef INTERVAL_BATCH_X86
+  if (xtyp == UNSIGNED_ARITH || xtyp == SIGNED_ARITH)
+  {
+    switch (IntervalBatchGetIsa())
+    {
+      case INTERVAL_ISA_AVX512:
+      case INTERVAL_ISA_AVX2:
+        i = bitwidth_avx2(n, xinfm, xsupr, bw, err, &mask);
+        break;
+      case INTERVAL_ISA_SSE41:
+        i = bitwidth_sse41(n, xinfm, xsupr, bw, err, &mask);
+        break;
+      default:
+        break;
+    }
+  }
+#endif
+
+  for (; i < n; i++)
+  {
+    status = IntervalToIntegerBitwidthChecked(&bw[i], INTERVAL(xinfm[i], xsupr[i]), xtyp);
+    if (err != NULL)
+    {
+      err[i] |= status;
+    }
+    mask |= status;
+  }
+
+  return (mask);
+}
@@ -0,0 +1,184 @@
+/*
+ * Filename: interval-batch.h
+ * Purpose : Structure-of-arrays (SoA) batch API for the interval ADT.
+ *           Definitions and function prototypes.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.8 (26/10/16)
+ *           Added IntervalExpIntegerBatch.
+ *           0.3.7 (26/10/16)
+ *           Added the SHL, SHR and SRA opcodes and the shift and bit-field 
+ *           batch functions.
+ *           0.3.6 (26/10/16)
+ *           Added the AND, IOR, XOR and NOT opcodes and their batch versions.
+ *           0.3.5 (26/10/16)
+ *           Added extern "C" guards for C++.
+ *           0.3.4 (26/10/16)
+ *           Added INTERVAL_ISA_AVX512 and the bulk containment kernels 
+ *           ValueIsInIntervalBatch, IntervalViolationsBatch and 
+ *           IntervalViolationsMinMaxBatch.
+ *           0.3.3 (26/10/16)
+ *           Added INTERVAL_NUM_OPCODES and IntervalOpcodeArity.
+ *           0.3.2 (26/10/16)
+ *           Added the DIV, MOD, SET and SQRT opcodes and the non-aborting 
+ *           batch API with per-element error flags.
+ *           0.3.1 (26/10/16)
+ *           Added IntervalToIntegerBitwidthBatch.
+ *           0.3.0 (26/10/16)
+ *           Initial version.
+ */
+#ifndef INTERVAL_BATCH_H
+#define INTERVAL_BATCH_H
+
+#include <stdio.h>
+#include "interval.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* IntervalOpcode enumerates the interval operations that can be evaluated
+ * over a whole batch. Unary operations ignore the y operand arrays.
+ */
+typedef enum {
+  INTERVAL_OP_ADD = 0,        /* IntervalAdd */
+  INTERVAL_OP_SUB,            /* IntervalSub */
+  INTERVAL_OP_NEG,            /* IntervalNeg (unary) */
+  INTERVAL_OP_MUL,            /* IntervalMul */
+  INTERVAL_OP_ABS,            /* IntervalAbs (unary) */
+  INTERVAL_OP_MAX,            /* IntervalMax */
+  INTERVAL_OP_MIN,            /* IntervalMin */
+  INTERVAL_OP_MUX,            /* IntervalMux */
+  INTERVAL_OP_UNION,          /* IntervalUnion */
+  INTERVAL_OP_INTERSECTION,   /* IntervalIntersection */
+  INTERVAL_OP_DIV,            /* IntervalDiv */
+  INTERVAL_OP_MOD,            /* IntervalMod */
+  INTERVAL_OP_SET,            /* IntervalSet */
+  INTERVAL_OP_SQRT,           /* IntervalSqrt (unary) */
+  INTERVAL_OP_AND,            /* IntervalAnd */
+  INTERVAL_OP_IOR,            /* IntervalIor */
+  INTERVAL_OP_XOR,            /* IntervalXor */
+  INTERVAL_OP_NOT,            /* IntervalNot (unary) */
+  INTERVAL_OP_SHL,            /* IntervalShl (y is the shift amount) */
+  INTERVAL_OP_SHR,            /* IntervalShr (y is the shift amount) */
+  INTERVAL_OP_SRA,            /* IntervalSra (y is the shift amount) */
+  INTERVAL_NUM_OPCODES        /* Number of opcodes (not an operation) */
+} IntervalOpcode;
+
+/* IntervalIsa specifies the instruction set used by the batch kernels. */
+typedef enum {
+  INTERVAL_ISA_SCALAR = 0,    /* Portable C, one interval at a time */
+  INTERVAL_ISA_SSE41,         /* x86 SSE4.1, 4 intervals per step */
+  INTERVAL_ISA_AVX2,          /* x86 AVX2, 8 intervals per step */
+  INTERVAL_ISA_AVX512         /* x86 AVX-512F, 16 values per step (bulk 
+                                 containment only; AVX2 elsewhere) */
+} IntervalIsa;
+
+/* Interval batch API.
+ * Each batch of n intervals is given as two separate arrays holding the
+ * infimum and supremum bounds. The result arrays may alias the operand
+ * arrays.
+ */
+IntervalIsa IntervalBatchGetIsa(void);
+IntervalIsa IntervalBatchSetIsa(IntervalIsa isa);
+const char *IntervalBatchIsaName(IntervalIsa isa);
+int IntervalOpcodeArity(IntervalOpcode op);
+void IntervalBatchEval(IntervalOpcode op, int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr, ArithType xtyp, ArithType ytyp);
+void IntervalAddBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr);
+void IntervalSubBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr);
+void IntervalNegBatch(int n,
+       const int *xinfm, const int *xsupr, int *zinfm, int *zsupr);
+void IntervalMulBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr, ArithType xtyp, ArithType ytyp);
+void IntervalAbsBatch(int n,
+       const int *xinfm, const int *xsupr, int *zinfm, int *zsupr);
+void IntervalMaxBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr);
+void IntervalMinBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr);
+void IntervalMuxBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr);
+void IntervalUnionBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr);
+void IntervalIntersectionBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr);
+void IntervalAndBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr);
+void IntervalIorBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr);
+void IntervalXorBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr);
+void IntervalNotBatch(int n,
+       const int *xinfm, const int *xsupr, int *zinfm, int *zsupr);
+void IntervalToIntegerBitwidthBatch(int n,
+       const int *xinfm, const int *xsupr, ArithType xtyp, int *bw);
+
+/* Bulk containment API.
+ * A single interval x is checked against an array of n values.
+ */
+int ValueIsInIntervalBatch(Interval x, int n, const int *v, int *in);
+int IntervalViolationsBatch(Interval x, int n, const int *v, int *first);
+int IntervalViolationsMinMaxBatch(Interval x, int n, const int *v, int *first,
+      Interval *range);
+
+/* Non-aborting interval batch API.
+ * Errors are reported per element instead of terminating the program: the 
+ * IntervalStatus flags of the i-th element are OR-ed into err[i] (err may be 
+ * NULL) and the element receives the empty interval [1,0] (or a zero 
+ * bitwidth). The OR of the flags of all elements is returned.
+ */
+int IntervalBatchEvalChecked(IntervalOpcode op, int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr, ArithType xtyp, ArithType ytyp, int *err);
+int IntervalDivBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr, ArithType xtyp, ArithType ytyp, int *err);
+int IntervalModBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr, ArithType xtyp, int *err);
+int IntervalSqrtBatch(int n,
+       const int *xinfm, const int *xsupr, int *zinfm, int *zsupr, int *err);
+int IntervalShlBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr, int *err);
+int IntervalShrBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr, ArithType xtyp, int *err);
+int IntervalSraBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int *zinfm, int *zsupr, int *err);
+int IntervalTruncBatch(int n,
+       const int *xinfm, const int *xsupr, int width, ArithType ztyp,
+       int *zinfm, int *zsupr, int *err);
+int IntervalSliceBatch(int n,
+       const int *xinfm, const int *xsupr, int hi, int lo,
+       int *zinfm, int *zsupr, int *err);
+int IntervalConcatBatch(int n,
+       const int *xinfm, const int *xsupr, const int *yinfm, const int *ysupr,
+       int width, int *zinfm, int *zsupr, int *err);
+int IntervalExpIntegerBatch(int n,
+       const int *xinfm, const int *xsupr, int e, int *zinfm, int *zsupr, int *err);
+int IntervalToIntegerBitwidthBatchChecked(int n,
+       const int *xinfm, const int *xsupr, ArithType xtyp, int *bw, int *err);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INTERVAL_BATCH_H */
@@ -0,0 +1,396 @@
+/*
+ * Filename: interval-bits.c
+ * Purpose : Implementation of the known-bits domain kept alongside an
+ *           interval. The known bits of each operation are propagated with a
+ *           few logical operations on the masks (the addition and subtraction
+ *           rules are those of the tristate numbers of the Linux eBPF
+ *           verifier); IntervalBitsRefine forms the reduced product of the two
+ *           domains in constant time, moving each bound to the nearest value
+ *           that agrees with the known bits.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.0 (26/10/16)
+ *           Initial version.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <stdint.h>
+#include "interval.h"
+#include "interval-bits.h"
+
+/* Sign bit; biasing a value by it maps the signed order to the unsigned. */
+#define BITS_SIGN  0x80000000U
+
+/* bits_smear:
+ * Set all the bits below the most significant set bit of v.
+ */
+static inline unsigned int bits_smear(unsigned int v)
+{
+  v |= v >> 1;
+  v |= v >> 2;
+  v |= v >> 4;
+  v |= v >> 8;
+  v |= v >> 16;
+  return (v);
+}
+
+/* bits_empty:
+ * Return the canonical empty IntervalBits.
+ */
+static inline IntervalBits bits_empty(void)
+{
+  IntervalBits z;
+
+  z.r = IntervalEmpty();
+  z.zeros = ~0U;
+  z.ones = ~0U;
+  return (z);
+}
+
+/* bits_make:
+ * Return the IntervalBits with range r and known bits zeros and ones.
+ */
+static inline IntervalBits bits_make(Interval r, unsigned int zeros,
+  unsigned int ones)
+{
+  IntervalBits z;
+
+  z.r = r;
+  z.zeros = zeros;
+  z.ones = ones;
+  return (z);
+}
+
+/* bits_check_shift:
+ * Abort on a shift amount outside [0,31].
+ */
+static inline void bits_check_shift(int k)
+{
+  if (k < 0 || k > 31)
+  {
+    fprintf(stderr, "Error: Shift amount %d out of range in IntervalBits.\n", k);
+    exit(1);
+  }
+}
+
+/* bits_min_ge:
+ * Return in *z the smallest unsigned value not less than lo whose bits agree
+ * with the known bits (zeros, ones), assumed not to conflict. Returns 0 if
+ * there is no such value.
+ */
+static inline int bits_min_ge(unsigned int *z, unsigned int lo,
+  unsigned int zeros, unsigned int ones)
+{
+  unsigned int known = zeros | ones;
+  unsigned int c = (lo ^ ones) & known;
+  unsigned int h, upto, cand, p;
+
+  if (c == 0)
+  {
+    *z = lo;
+    return (1);
+  }
+  // h is the highest bit of lo that disagrees with a known bit
+  upto = bits_smear(c);
+  h = upto ^ (upto >> 1);
+  if (ones & h)
+  {
+    // Set bit h; the bits below take their least value
+    *z = (lo & ~upto) | (ones & upto);
+    return (1);
+  }
+  // Bit h must be cleared: carry into the lowest clear unknown bit above
+  cand = ~known & ~lo & ~upto;
+  if (cand == 0)
+  {
+    return (0);
+  }
+  p = cand & (0U - cand);
+  *z = (lo & ~(p | (p - 1))) | p | (ones & (p - 1));
+  return (1);
+}
+
+/* IntervalBitsFromInterval:
+ * Return the IntervalBits of interval x, with the bits of the common prefix
+ * of its bounds known.
+ */
+IntervalBits IntervalBitsFromInterval(Interval x)
+{
+  return (IntervalBitsRefine(bits_make(x, 0, 0)));
+}
+
+/* IntervalBitsFromMasks:
+ * Return the IntervalBits of the values with the given known zero and one
+ * bits.
+ */
+IntervalBits IntervalBitsFromMasks(unsigned int zeros, unsigned int ones)
+{
+  return (IntervalBitsRefine(bits_make(INTERVAL(INT_MIN, INT_MAX), zeros, ones)));
+}
+
+/* IntervalBitsRefine:
+ * Tighten the interval and the known bits of x by each other: the bounds are
+ * moved inwards to the nearest values that agree with the known bits, and
+ * the bits of the common prefix of the new bounds become known. The result
+ * is the canonical empty IntervalBits if no value remains.
+ */
+IntervalBits IntervalBitsRefine(IntervalBits x)
+{
+  unsigned int lo, hi, zeros, ones, d, pm;
+
+  if (IntervalBitsIsEmpty(x))
+  {
+    return (bits_empty());
+  }
+  // Bias by the sign bit so that the signed order becomes unsigned
+  lo = (unsigned int)x.r.infm ^ BITS_SIGN;
+  hi = (unsigned int)x.r.supr ^ BITS_SIGN;
+  zeros = (x.zeros & ~BITS_SIGN) | (x.ones & BITS_SIGN);
+  ones = (x.ones & ~BITS_SIGN) | (x.zeros & BITS_SIGN);
+  // The largest value up to hi is the complement of the smallest from ~hi
+  // under the complemented known bits
+  if (!bits_min_ge(&lo, lo, zeros, ones) || !bits_min_ge(&hi, ~hi, ones, zeros))
+  {
+    return (bits_empty());
+  }
+  hi = ~hi;
+  if (lo > hi)
+  {
+    return (bits_empty());
+  }
+  x.r.infm = (int)(lo ^ BITS_SIGN);
+  x.r.supr = (int)(hi ^ BITS_SIGN);
+  // Known bits of the common prefix
+  d = (unsigned int)x.r.infm ^ (unsigned int)x.r.supr;
+  pm = ~bits_smear(d);
+  x.ones |= (unsigned int)x.r.infm & pm;
+  x.zeros |= ~(unsigned int)x.r.infm & pm;
+  return (x);
+}
+
+/* IntervalBitsIsEmpty:
+ * Return 1 if x contains no value, i.e. its interval is empty or its known
+ * bits conflict.
+ */
+int IntervalBitsIsEmpty(IntervalBits x)
+{
+  return (x.r.infm > x.r.supr || (x.zeros & x.ones) != 0);
+}
+
+/* ValueIsInIntervalBits:
+ * Return 1 if v is in the interval of x and agrees with its known bits.
+ */
+int ValueIsInIntervalBits(IntervalBits x, int v)
+{
+  unsigned int u = (unsigned int)v;
+
+  return (ValueIsInInterval(x.r, v) && (u & x.zeros) == 0 && (~u & x.ones) == 0);
+}
+
+/* IntervalBitsAdd:
+ * Add x and y, wrapping around on overflow.
+ */
+IntervalBits IntervalBitsAdd(IntervalBits x, IntervalBits y)
+{
+  unsigned int xm, ym, sm, sv, mu;
+  Interval r;
+  int ovf;
+
+  if (IntervalBitsIsEmpty(x) || IntervalBitsIsEmpty(y))
+  {
+    return (bits_empty());
+  }
+  r = IntervalAddWide(x.r, y.r, &ovf);
+  if (ovf)
+  {
+    r = INTERVAL(INT_MIN, INT_MAX);
+  }
+  // The unknown bits of the sum are those reached by a carry that differs
+  // between the least and the greatest sums
+  xm = ~(x.zeros | x.ones);
+  ym = ~(y.zeros | y.ones);
+  sm = xm + ym;
+  sv = x.ones + y.ones;
+  mu = ((sm + sv) ^ sv) | xm | ym;
+  return (bits_make(r, ~(sv | mu), sv & ~mu));
+}
+
+/* IntervalBitsSub:
+ * Subtract y from x, wrapping around on overflow.
+ */
+IntervalBits IntervalBitsSub(IntervalBits x, IntervalBits y)
+{
+  unsigned int xm, ym, dv, mu;
+  Interval r;
+  int ovf;
+
+  if (IntervalBitsIsEmpty(x) || IntervalBitsIsEmpty(y))
+  {
+    return (bits_empty());
+  }
+  r = IntervalSubWide(x.r, y.r, &ovf);
+  if (ovf)
+  {
+    r = INTERVAL(INT_MIN, INT_MAX);
+  }
+  xm = ~(x.zeros | x.ones);
+  ym = ~(y.zeros | y.ones);
+  dv = x.ones - y.ones;
+  mu = ((dv + xm) ^ (dv - ym)) | xm | ym;
+  return (bits_make(r, ~(dv | mu), dv & ~mu));
+}
+
+/* IntervalBitsAnd:
+ * Bitwise AND of x and y.
+ */
+IntervalBits IntervalBitsAnd(IntervalBits x, IntervalBits y)
+{
+  if (IntervalBitsIsEmpty(x) || IntervalBitsIsEmpty(y))
+  {
+    return (bits_empty());
+  }
+  return (bits_make(IntervalAnd(x.r, y.r), x.zeros | y.zeros, x.ones & y.ones));
+}
+
+/* IntervalBitsIor:
+ * Bitwise inclusive OR of x and y.
+ */
+IntervalBits IntervalBitsIor(IntervalBits x, IntervalBits y)
+{
+  if (IntervalBitsIsEmpty(x) || IntervalBitsIsEmpty(y))
+  {
+    return (bits_empty());
+  }
+  return (bits_make(IntervalIor(x.r, y.r), x.zeros & y.zeros, x.ones | y.ones));
+}
+
+/* IntervalBitsXor:
+ * Bitwise exclusive OR of x and y.
+ */
+IntervalBits IntervalBitsXor(IntervalBits x, IntervalBits y)
+{
+  if (IntervalBitsIsEmpty(x) || IntervalBitsIsEmpty(y))
+  {
+    return (bits_empty());
+  }
+  return (bits_make(IntervalXor(x.r, y.r),
+    (x.zeros & y.zeros) | (x.ones & y.ones),
+    (x.zeros & y.ones) | (x.ones & y.zeros)));
+}
+
+/* IntervalBitsNot:
+ * Bitwise complement of x.
+ */
+IntervalBits IntervalBitsNot(IntervalBits x)
+{
+  if (IntervalBitsIsEmpty(x))
+  {
+    return (bits_empty());
+  }
+  return (bits_make(IntervalNot(x.r), x.ones, x.zeros));
+}
+
+/* IntervalBitsShl:
+ * Shift x left by k bits (0 <= k <= 31), wrapping around on overflow.
+ */
+IntervalBits IntervalBitsShl(IntervalBits x, int k)
+{
+  int64_t lo, hi;
+  Interval r;
+
+  bits_check_shift(k);
+  if (IntervalBitsIsEmpty(x))
+  {
+    return (bits_empty());
+  }
+  lo = (int64_t)x.r.infm * ((int64_t)1 << k);
+  hi = (int64_t)x.r.supr * ((int64_t)1 << k);
+  if (lo >= INT_MIN && hi <= INT_MAX)
+  {
+    r = INTERVAL((int)lo, (int)hi);
+  }
+  else
+  {
+    r = INTERVAL(INT_MIN, INT_MAX);
+  }
+  return (bits_make(r, (x.zeros << k) | ((1U << k) - 1), x.ones << k));
+}
+
+/* IntervalBitsShr:
+ * Logical shift right of x by k bits (0 <= k <= 31).
+ */
+IntervalBits IntervalBitsShr(IntervalBits x, int k)
+{
+  unsigned int lo, hi;
+  Interval r;
+
+  bits_check_shift(k);
+  if (IntervalBitsIsEmpty(x))
+  {
+    return (bits_empty());
+  }
+  lo = (unsigned int)x.r.infm;
+  hi = (unsigned int)x.r.supr;
+  if (k == 0)
+  {
+    r = x.r;
+  }
+  else if (x.r.infm >= 0 || x.r.supr < 0)
+  {
+    // No sign change, so the unsigned order is that of the interval
+    r = INTERVAL((int)(lo >> k), (int)(hi >> k));
+  }
+  else
+  {
+    r = INTERVAL(0, (int)(~0U >> k));
+  }
+  return (bits_make(r, (x.zeros >> k) | ~(~0U >> k), x.ones >> k));
+}
+
+/* IntervalBitsSra:
+ * Arithmetic shift right of x by k bits (0 <= k <= 31).
+ */
+IntervalBits IntervalBitsSra(IntervalBits x, int k)
+{
+  bits_check_shift(k);
+  if (IntervalBitsIsEmpty(x))
+  {
+    return (bits_empty());
+  }
+  return (bits_make(INTERVAL(x.r.infm >> k, x.r.supr >> k),
+    (unsigned int)((int)x.zeros >> k), (unsigned int)((int)x.ones >> k)));
+}
+
+/* IntervalBitsPrint:
+ * Print x to outfile as its interval followed by its bits, most significant
+ * first, as 0, 1, x when unknown or ! when conflicting.
+ */
+void IntervalBitsPrint(FILE *outfile, IntervalBits x)
+{
+  int i;
+
+  IntervalPrint(outfile, x.r);
+  fputc(':', outfile);
+  for (i = 31; i >= 0; i--)
+  {
+    if ((x.zeros >> i) & (x.ones >> i) & 1)
+    {
+      fputc('!', outfile);
+    }
+    else if ((x.zeros >> i) & 1)
+    {
+      fputc('0', outfile);
+    }
+    else if ((x.ones >> i) & 1)
+    {
+      fputc('1', outfile);
+    }
+    else
+    {
+      fputc('x', outfile);
+    }
+  }
+}
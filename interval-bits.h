@@ -0,0 +1,56 @@
+/*
+ * Filename: interval-bits.h
+ * Purpose : Known-bits (tristate) domain kept alongside an interval.
+ *           Definitions and function prototypes.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.0 (26/10/16)
+ *           Initial version.
+ */
+#ifndef INTERVAL_BITS_H
+#define INTERVAL_BITS_H
+
+#include <stdio.h>
+#include "interval.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* IntervalBits is an interval r together with the bits known to be 0
+ * (zeros) and to be 1 (ones) in the 32-bit two's complement representation
+ * of every value of r; the other bits are unknown. A bit set in both masks,
+ * or an empty r, denotes the empty set.
+ */
+typedef struct {
+  Interval r;                 /* Range of the values */
+  unsigned int zeros;         /* Bits known to be 0 */
+  unsigned int ones;          /* Bits known to be 1 */
+} IntervalBits;
+
+/* Interval known-bits API. The operations propagate the interval and the
+ * known bits separately, with the wrap-around semantics of 32-bit integers;
+ * IntervalBitsRefine then tightens each by the other.
+ */
+IntervalBits IntervalBitsFromInterval(Interval x);
+IntervalBits IntervalBitsFromMasks(unsigned int zeros, unsigned int ones);
+IntervalBits IntervalBitsRefine(IntervalBits x);
+int IntervalBitsIsEmpty(IntervalBits x);
+int ValueIsInIntervalBits(IntervalBits x, int v);
+IntervalBits IntervalBitsAdd(IntervalBits x, IntervalBits y);
+IntervalBits IntervalBitsSub(IntervalBits x, IntervalBits y);
+IntervalBits IntervalBitsAnd(IntervalBits x, IntervalBits y);
+IntervalBits IntervalBitsIor(IntervalBits x, IntervalBits y);
+IntervalBits IntervalBitsXor(IntervalBits x, IntervalBits y);
+IntervalBits IntervalBitsNot(IntervalBits x);
+IntervalBits IntervalBitsShl(IntervalBits x, int k);
+IntervalBits IntervalBitsShr(IntervalBits x, int k);
+IntervalBits IntervalBitsSra(IntervalBits x, int k);
+void IntervalBitsPrint(FILE *outfile, IntervalBits x);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INTERVAL_BITS_H */
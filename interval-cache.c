@@ -0,0 +1,241 @@
+/*
+ * Filename: interval-cache.c
+ * Purpose : Implementation of the memoizing result cache. Results are looked
+ *           up by a multiplicative hash of the packed operands, operation and
+ *           ArithTypes; on a miss, the interval API is called and the result
+ *           is stored, replacing the home entry when all probed entries are
+ *           in use.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.0 (26/10/16)
+ *           Initial version.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "interval.h"
+#include "interval-cache.h"
+
+/* Operation codes of the cache tags. */
+#define CACHE_OP_MUL       1
+#define CACHE_OP_DIV       2
+#define CACHE_OP_MOD       3
+#define CACHE_OP_EXP       4
+#define CACHE_OP_BALANCED  5
+
+/* cache_pack:
+ * Pack interval x into 64 bits.
+ */
+static inline uint64_t cache_pack(Interval x)
+{
+  return (((uint64_t)(uint32_t)x.infm << 32) | (uint32_t)x.supr);
+}
+
+/* cache_tag:
+ * Return the (non-zero) tag of operation op with types xtyp, ytyp.
+ */
+static inline uint32_t cache_tag(int op, ArithType xtyp, ArithType ytyp)
+{
+  return (((uint32_t)op << 8) | ((uint32_t)(xtyp + 1) << 4) | (uint32_t)(ytyp + 1));
+}
+
+/* cache_hash:
+ * Return the home entry index for the given key.
+ */
+static inline uint32_t cache_hash(const IntervalCache *c, uint64_t x, uint64_t y,
+  uint32_t tag)
+{
+  uint64_t h = (x * 0x9E3779B97F4A7C15ULL) ^ (y * 0xC2B2AE3D27D4EB4FULL) ^ tag;
+  h ^= h >> 29;
+  h *= 0xBF58476D1CE4E5B9ULL;
+  return ((uint32_t)(h >> 32) & c->mask);
+}
+
+/* cache_lookup:
+ * Look up the key in c. On a hit, the result is returned in z and NULL is
+ * returned; on a miss, the entry to be filled is returned.
+ */
+static IntervalCacheEntry *cache_lookup(IntervalCache *c, uint64_t x, uint64_t y,
+  uint32_t tag, Interval *z)
+{
+  uint32_t h = cache_hash(c, x, y, tag);
+  IntervalCacheEntry *e;
+  int k;
+
+  for (k = 0; k < INTERVAL_CACHE_PROBES; k++)
+  {
+    e = &c->entry[(h + k) & c->mask];
+    if (e->tag == tag && e->x == x && e->y == y)
+    {
+      c->hits++;
+      *z = e->z;
+      return (NULL);
+    }
+    if (e->tag == 0)
+    {
+      break;
+    }
+  }
+  c->misses++;
+  // Fill the first unused entry, or replace the home entry.
+  return ((k < INTERVAL_CACHE_PROBES) ? e : &c->entry[h]);
+}
+
+/* cache_store:
+ * Store result z for the key in entry e.
+ */
+static inline void cache_store(IntervalCacheEntry *e, uint64_t x, uint64_t y,
+  uint32_t tag, Interval z)
+{
+  e->x = x;
+  e->y = y;
+  e->tag = tag;
+  e->z = z;
+}
+
+/* IntervalCacheCreate:
+ * Create an empty cache of 2^bits entries (INTERVAL_CACHE_BITS for bits <= 0,
+ * at most 2^INTERVAL_CACHE_MAX_BITS). Each entry takes 32 bytes.
+ */
+IntervalCache *IntervalCacheCreate(int bits)
+{
+  IntervalCache *c = malloc(sizeof(IntervalCache));
+
+  if (bits <= 0)
+  {
+    bits = INTERVAL_CACHE_BITS;
+  }
+  bits = MIN(bits, INTERVAL_CACHE_MAX_BITS);
+  if (c != NULL)
+  {
+    c->mask = (1U << bits) - 1;
+    c->entry = malloc((size_t)(c->mask + 1) * sizeof(IntervalCacheEntry));
+  }
+  if (c == NULL || c->entry == NULL)
+  {
+    fprintf(stderr, "Error: Out of memory in interval cache.\n");
+    exit(1);
+  }
+  IntervalCacheClear(c);
+
+  return (c);
+}
+
+/* IntervalCacheDestroy:
+ * Free all memory of cache c.
+ */
+void IntervalCacheDestroy(IntervalCache *c)
+{
+  if (c == NULL)
+  {
+    return;
+  }
+  free(c->entry);
+  free(c);
+}
+
+/* IntervalCacheClear:
+ * Remove all entries of cache c and reset its counters.
+ */
+void IntervalCacheClear(IntervalCache *c)
+{
+  memset(c->entry, 0, (size_t)(c->mask + 1) * sizeof(IntervalCacheEntry));
+  c->hits = 0;
+  c->misses = 0;
+}
+
+/* IntervalMulCached:
+ * Memoized version of IntervalMul.
+ */
+Interval IntervalMulCached(IntervalCache *c, Interval x, Interval y,
+           ArithType xtyp, ArithType ytyp)
+{
+  uint64_t px = cache_pack(x), py = cache_pack(y);
+  uint32_t tag = cache_tag(CACHE_OP_MUL, xtyp, ytyp);
+  IntervalCacheEntry *e;
+  Interval z;
+
+  if ((e = cache_lookup(c, px, py, tag, &z)) != NULL)
+  {
+    z = IntervalMul(x, y, xtyp, ytyp);
+    cache_store(e, px, py, tag, z);
+  }
+  return (z);
+}
+
+/* IntervalDivCached:
+ * Memoized version of IntervalDiv.
+ */
+Interval IntervalDivCached(IntervalCache *c, Interval x, Interval y,
+           ArithType xtyp, ArithType ytyp)
+{
+  uint64_t px = cache_pack(x), py = cache_pack(y);
+  uint32_t tag = cache_tag(CACHE_OP_DIV, xtyp, ytyp);
+  IntervalCacheEntry *e;
+  Interval z;
+
+  if ((e = cache_lookup(c, px, py, tag, &z)) != NULL)
+  {
+    z = IntervalDiv(x, y, xtyp, ytyp);
+    cache_store(e, px, py, tag, z);
+  }
+  return (z);
+}
+
+/* IntervalModCached:
+ * Memoized version of IntervalMod.
+ */
+Interval IntervalModCached(IntervalCache *c, Interval x, Interval y,
+           ArithType xtyp)
+{
+  uint64_t px = cache_pack(x), py = cache_pack(y);
+  uint32_t tag = cache_tag(CACHE_OP_MOD, xtyp, UNKNOWN_ARITH_TYPE);
+  IntervalCacheEntry *e;
+  Interval z;
+
+  if ((e = cache_lookup(c, px, py, tag, &z)) != NULL)
+  {
+    z = IntervalMod(x, y, xtyp);
+    cache_store(e, px, py, tag, z);
+  }
+  return (z);
+}
+
+/* IntervalExpIntegerCached:
+ * Memoized version of IntervalExpInteger.
+ */
+Interval IntervalExpIntegerCached(IntervalCache *c, Interval x, int n)
+{
+  uint64_t px = cache_pack(x), py = (uint32_t)n;
+  uint32_t tag = cache_tag(CACHE_OP_EXP, UNKNOWN_ARITH_TYPE, UNKNOWN_ARITH_TYPE);
+  IntervalCacheEntry *e;
+  Interval z;
+
+  if ((e = cache_lookup(c, px, py, tag, &z)) != NULL)
+  {
+    z = IntervalExpInteger(x, n);
+    cache_store(e, px, py, tag, z);
+  }
+  return (z);
+}
+
+/* IntervalBalancedCached:
+ * Memoized version of IntervalBalanced.
+ */
+Interval IntervalBalancedCached(IntervalCache *c, Interval x, ArithType xtyp)
+{
+  uint64_t px = cache_pack(x);
+  uint32_t tag = cache_tag(CACHE_OP_BALANCED, xtyp, UNKNOWN_ARITH_TYPE);
+  IntervalCacheEntry *e;
+  Interval z;
+
+  if ((e = cache_lookup(c, px, 0, tag, &z)) != NULL)
+  {
+    z = IntervalBalanced(x, xtyp);
+    cache_store(e, px, 0, tag, z);
+  }
+  return (z);
+}
@@ -0,0 +1,68 @@
+/*
+ * Filename: interval-cache.h
+ * Purpose : Memoizing result cache for the costlier interval operations.
+ *           Definitions and function prototypes.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.1 (26/10/16)
+ *           Added extern "C" guards for C++.
+ *           0.3.0 (26/10/16)
+ *           Initial version.
+ */
+#ifndef INTERVAL_CACHE_H
+#define INTERVAL_CACHE_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include "interval.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Default and maximum log2 of the number of cache entries. */
+#define INTERVAL_CACHE_BITS      12
+#define INTERVAL_CACHE_MAX_BITS  24
+
+/* Number of entries probed per lookup. */
+#define INTERVAL_CACHE_PROBES    4
+
+/* IntervalCacheEntry holds one memoized result; the operands are kept as
+ * packed 64-bit intervals (infimum in the upper half).
+ */
+typedef struct {
+  uint64_t x, y;              /* Packed operands (y: exponent for ExpInteger) */
+  uint32_t tag;               /* Operation and ArithTypes; 0 if unused */
+  Interval z;                 /* Result */
+} IntervalCacheEntry;
+
+/* IntervalCache is a fixed-size, open-addressing (bounded linear probing)
+ * table of results. A cache is not shared between threads: each thread uses
+ * its own.
+ */
+typedef struct {
+  uint32_t mask;              /* Number of entries - 1 */
+  IntervalCacheEntry *entry;  /* Entries */
+  unsigned long hits;         /* Number of lookups that hit */
+  unsigned long misses;       /* Number of lookups that missed */
+} IntervalCache;
+
+/* Interval cache API. */
+IntervalCache *IntervalCacheCreate(int bits);
+void IntervalCacheDestroy(IntervalCache *c);
+void IntervalCacheClear(IntervalCache *c);
+Interval IntervalMulCached(IntervalCache *c, Interval x, Interval y,
+           ArithType xtyp, ArithType ytyp);
+Interval IntervalDivCached(IntervalCache *c, Interval x, Interval y,
+           ArithType xtyp, ArithType ytyp);
+Interval IntervalModCached(IntervalCache *c, Interval x, Interval y,
+           ArithType xtyp);
+Interval IntervalExpIntegerCached(IntervalCache *c, Interval x, int n);
+Interval IntervalBalancedCached(IntervalCache *c, Interval x, ArithType xtyp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INTERVAL_CACHE_H */
@@ -0,0 +1,636 @@
+/*
+ * Filename: interval-dag.c
+ * Purpose : Implementation of range propagation over expression DAGs. The
+ *           nodes of each topological level are grouped by opcode and
+ *           operand types, and every group is evaluated with one call to the
+ *           batch API over structure-of-arrays storage.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.2 (26/10/16)
+ *           Added IntervalDagPrepare and IntervalDagEvalSlots for external 
+ *           (e.g. parallel) evaluators.
+ *           0.3.1 (26/10/16)
+ *           Added incremental re-evaluation: only the nodes in the dependency 
+ *           cone of the changed inputs, whose operands actually changed, are 
+ *           recomputed.
+ *           0.3.0 (26/10/16)
+ *           Initial version.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "interval.h"
+#include "interval-batch.h"
+#include "interval-dag.h"
+
+/* Number of distinct values of (ArithType + 1). */
+#define DAG_NUM_TYPES  5
+
+/* dag_alloc:
+ * Reallocate p to size bytes (p may be NULL); abort when out of memory.
+ */
+static void *dag_alloc(void *p, size_t size)
+{
+  p = realloc(p, (size > 0) ? size : 1);
+  if (p == NULL)
+  {
+    fprintf(stderr, "Error: Out of memory in interval DAG.\n");
+    exit(1);
+  }
+  return (p);
+}
+
+/* dag_key:
+ * Return the group key of a node: nodes with equal keys are evaluated with
+ * the same batch call.
+ */
+static int dag_key(const IntervalDagNode *nd)
+{
+  return (((nd->op + 1) * DAG_NUM_TYPES + (nd->xtyp + 1)) * DAG_NUM_TYPES +
+          (nd->ytyp + 1));
+}
+
+/* dag_result_type:
+ * Return the arithmetic type used for the bitwidth of the result of a node;
+ * it is unsigned only when all of its operands are unsigned.
+ */
+static ArithType dag_result_type(const IntervalDagNode *nd)
+{
+  if (nd->xtyp == UNSIGNED_ARITH && nd->ytyp == UNSIGNED_ARITH)
+  {
+    return (UNSIGNED_ARITH);
+  }
+  return (SIGNED_ARITH);
+}
+
+/* dag_schedule:
+ * Sort the nodes of g into levels and, within each level, into groups of
+ * equal key (two stable counting sort passes), and allocate the per-slot
+ * storage.
+ */
+static void dag_schedule(IntervalDag *g)
+{
+  int n = g->n, nkeys = (INTERVAL_NUM_OPCODES + 1) * DAG_NUM_TYPES * DAG_NUM_TYPES;
+  int *level = dag_alloc(NULL, n * sizeof(int));
+  int *tmp = dag_alloc(NULL, n * sizeof(int));
+  int *count;
+  int i, s, l, key, prev_key, nlevels = 0;
+  IntervalDagNode *nd;
+
+  for (i = 0; i < n; i++)
+  {
+    nd = &g->node[i];
+    level[i] = 0;
+    if (nd->a >= 0)
+    {
+      level[i] = level[nd->a] + 1;
+    }
+    if (nd->b >= 0)
+    {
+      level[i] = MAX(level[i], level[nd->b] + 1);
+    }
+    nlevels = MAX(nlevels, level[i] + 1);
+  }
+
+  // Sort by key, then (stably) by level.
+  count = dag_alloc(NULL, (MAX(nkeys, nlevels) + 1) * sizeof(int));
+  memset(count, 0, (nkeys + 1) * sizeof(int));
+  for (i = 0; i < n; i++)
+  {
+    count[dag_key(&g->node[i]) + 1]++;
+  }
+  for (key = 0; key < nkeys; key++)
+  {
+    count[key + 1] += count[key];
+  }
+  for (i = 0; i < n; i++)
+  {
+    tmp[count[dag_key(&g->node[i])]++] = i;
+  }
+  g->order = dag_alloc(g->order, n * sizeof(int));
+  memset(count, 0, (nlevels + 1) * sizeof(int));
+  for (i = 0; i < n; i++)
+  {
+    count[level[i] + 1]++;
+  }
+  for (l = 0; l < nlevels; l++)
+  {
+    count[l + 1] += count[l];
+  }
+  for (s = 0; s < n; s++)
+  {
+    g->order[count[level[tmp[s]]]++] = tmp[s];
+  }
+
+  // Find the group and level boundaries.
+  g->slot = dag_alloc(g->slot, n * sizeof(int));
+  g->group_start = dag_alloc(g->group_start, (n + 1) * sizeof(int));
+  g->level_group = dag_alloc(g->level_group, (nlevels + 1) * sizeof(int));
+  g->ngroups = 0;
+  g->nlevels = nlevels;
+  prev_key = -1;
+  l = -1;
+  for (s = 0; s < n; s++)
+  {
+    i = g->order[s];
+    g->slot[i] = s;
+    key = dag_key(&g->node[i]);
+    if (level[i] != l)
+    {
+      l = level[i];
+      g->level_group[l] = g->ngroups;
+      prev_key = -1;
+    }
+    if (key != prev_key)
+    {
+      g->group_start[g->ngroups++] = s;
+      prev_key = key;
+    }
+  }
+  g->group_start[g->ngroups] = n;
+  g->level_group[nlevels] = g->ngroups;
+
+  // Operand slots, result and gather storage.
+  g->aslot = dag_alloc(g->aslot, n * sizeof(int));
+  g->bslot = dag_alloc(g->bslot, n * sizeof(int));
+  for (s = 0; s < n; s++)
+  {
+    nd = &g->node[g->order[s]];
+    g->aslot[s] = (nd->a >= 0) ? g->slot[nd->a] : -1;
+    g->bslot[s] = (nd->b >= 0) ? g->slot[nd->b] : -1;
+  }
+  g->infm = dag_alloc(g->infm, n * sizeof(int));
+  g->supr = dag_alloc(g->supr, n * sizeof(int));
+  g->bw   = dag_alloc(g->bw,   n * sizeof(int));
+  g->err  = dag_alloc(g->err,  n * sizeof(int));
+  g->xi   = dag_alloc(g->xi,   n * sizeof(int));
+  g->xs   = dag_alloc(g->xs,   n * sizeof(int));
+  g->yi   = dag_alloc(g->yi,   n * sizeof(int));
+  g->ys   = dag_alloc(g->ys,   n * sizeof(int));
+
+  // Levels, consumers (CSR) and queues for incremental re-evaluation.
+  g->level = dag_alloc(g->level, n * sizeof(int));
+  for (s = 0; s < n; s++)
+  {
+    g->level[s] = level[g->order[s]];
+  }
+  g->cons_start = dag_alloc(g->cons_start, (n + 1) * sizeof(int));
+  g->cons = dag_alloc(g->cons, 2 * n * sizeof(int));
+  memset(g->cons_start, 0, (n + 1) * sizeof(int));
+  for (s = 0; s < n; s++)
+  {
+    if (g->aslot[s] >= 0)
+    {
+      g->cons_start[g->aslot[s] + 1]++;
+    }
+    if (g->bslot[s] >= 0 && g->bslot[s] != g->aslot[s])
+    {
+      g->cons_start[g->bslot[s] + 1]++;
+    }
+  }
+  for (s = 0; s < n; s++)
+  {
+    g->cons_start[s + 1] += g->cons_start[s];
+    tmp[s] = g->cons_start[s];
+  }
+  for (s = 0; s < n; s++)
+  {
+    if (g->aslot[s] >= 0)
+    {
+      g->cons[tmp[g->aslot[s]]++] = s;
+    }
+    if (g->bslot[s] >= 0 && g->bslot[s] != g->aslot[s])
+    {
+      g->cons[tmp[g->bslot[s]]++] = s;
+    }
+  }
+  g->dirty  = dag_alloc(g->dirty,  n * sizeof(int));
+  g->ndirty = dag_alloc(g->ndirty, (nlevels + 1) * sizeof(int));
+  g->mark   = dag_alloc(g->mark,   n * sizeof(char));
+  memset(g->ndirty, 0, (nlevels + 1) * sizeof(int));
+  memset(g->mark, 0, n * sizeof(char));
+  g->ti   = dag_alloc(g->ti,   n * sizeof(int));
+  g->ts   = dag_alloc(g->ts,   n * sizeof(int));
+  g->tbw  = dag_alloc(g->tbw,  n * sizeof(int));
+  g->terr = dag_alloc(g->terr, n * sizeof(int));
+  g->scheduled = 1;
+  g->evaluated = 0;
+
+  free(count);
+  free(tmp);
+  free(level);
+}
+
+/* dag_eval_nodes:
+ * Evaluate m slots of the same group: slots[0..m-1], or s0 to s0+m-1 if slots
+ * is NULL. The operands are gathered into the gather buffers from offset off
+ * on, so that disjoint slot ranges can be evaluated independently, and the
+ * results are written to zi, zs, bw and err. A node with an empty operand
+ * (e.g. the result of a failed operation) receives the empty interval and
+ * INTERVAL_ERR_EMPTY. Returns the OR of the status flags.
+ */
+static int dag_eval_nodes(IntervalDag *g, int s0, const int *slots, int m,
+  int off, int *zi, int *zs, int *bw, int *err)
+{
+  const IntervalDagNode *nd = &g->node[g->order[slots ? slots[0] : s0]];
+  int *xi = g->xi + off, *xs = g->xs + off, *yi = g->yi + off, *ys = g->ys + off;
+  int binary, k, s, t, status = INTERVAL_OK;
+
+  memset(err, 0, m * sizeof(int));
+  if (nd->op == INTERVAL_OP_INPUT)
+  {
+    for (k = 0; k < m; k++)
+    {
+      s = slots ? slots[k] : s0 + k;
+      zi[k] = g->node[g->order[s]].x.infm;
+      zs[k] = g->node[g->order[s]].x.supr;
+    }
+  }
+  else
+  {
+    binary = (nd->b >= 0);
+    for (k = 0; k < m; k++)
+    {
+      s = slots ? slots[k] : s0 + k;
+      xi[k] = g->infm[g->aslot[s]];
+      xs[k] = g->supr[g->aslot[s]];
+      if (binary)
+      {
+        yi[k] = g->infm[g->bslot[s]];
+        ys[k] = g->supr[g->bslot[s]];
+      }
+      // Substitute in-domain operands for a lane with an empty operand, so 
+      // that e.g. an empty divisor is not divided by; the result is 
+      // overwritten below.
+      if (xi[k] > xs[k] || (binary && yi[k] > ys[k]))
+      {
+        xi[k] = xs[k] = 0;
+        yi[k] = ys[k] = 1;
+        err[k] = INTERVAL_ERR_EMPTY;
+      }
+    }
+    status = IntervalBatchEvalChecked((IntervalOpcode)nd->op, m, xi, xs,
+               binary ? yi : NULL, binary ? ys : NULL, zi, zs,
+               nd->xtyp, nd->ytyp, err);
+    for (k = 0; k < m; k++)
+    {
+      // The NEG kernels follow IntervalNeg, which swaps the bounds.
+      if (nd->op == INTERVAL_OP_NEG)
+      {
+        t = zi[k];
+        zi[k] = zs[k];
+        zs[k] = t;
+      }
+      if (err[k] & INTERVAL_ERR_EMPTY)
+      {
+        zi[k] = 1;
+        zs[k] = 0;
+        status |= INTERVAL_ERR_EMPTY;
+      }
+    }
+  }
+  status |= IntervalToIntegerBitwidthBatchChecked(m, zi, zs, dag_result_type(nd),
+              bw, err);
+
+  return (status);
+}
+
+/* IntervalDagEvalSlots:
+ * Evaluate slots s0 to s1-1 in place; they must all belong to the same group 
+ * and the operands in earlier levels must have been evaluated. Disjoint slot 
+ * ranges may be evaluated concurrently. Returns the OR of the status flags.
+ */
+int IntervalDagEvalSlots(IntervalDag *g, int s0, int s1)
+{
+  return (dag_eval_nodes(g, s0, NULL, s1 - s0, s0, g->infm + s0, g->supr + s0,
+            g->bw + s0, g->err + s0));
+}
+
+/* dag_enqueue:
+ * Queue slot s for recomputation, unless already queued.
+ */
+static void dag_enqueue(IntervalDag *g, int s)
+{
+  int l = g->level[s];
+
+  if (!g->mark[s])
+  {
+    g->mark[s] = 1;
+    g->dirty[g->group_start[g->level_group[l]] + g->ndirty[l]++] = s;
+  }
+}
+
+/* cmp_int:
+ * qsort() comparison function for ints.
+ */
+static int cmp_int(const void *a, const void *b)
+{
+  return (*(const int *)a - *(const int *)b);
+}
+
+/* IntervalDagCreate:
+ * Create an empty DAG with room for capacity nodes (it grows as needed).
+ */
+IntervalDag *IntervalDagCreate(int capacity)
+{
+  IntervalDag *g = dag_alloc(NULL, sizeof(IntervalDag));
+
+  memset(g, 0, sizeof(IntervalDag));
+  g->cap = MAX(capacity, 16);
+  g->node = dag_alloc(NULL, g->cap * sizeof(IntervalDagNode));
+
+  return (g);
+}
+
+/* IntervalDagDestroy:
+ * Free all memory of DAG g.
+ */
+void IntervalDagDestroy(IntervalDag *g)
+{
+  if (g == NULL)
+  {
+    return;
+  }
+  free(g->node);
+  free(g->level_group);
+  free(g->group_start);
+  free(g->order);
+  free(g->slot);
+  free(g->aslot);
+  free(g->bslot);
+  free(g->infm);
+  free(g->supr);
+  free(g->bw);
+  free(g->err);
+  free(g->xi);
+  free(g->xs);
+  free(g->yi);
+  free(g->ys);
+  free(g->level);
+  free(g->cons_start);
+  free(g->cons);
+  free(g->dirty);
+  free(g->ndirty);
+  free(g->mark);
+  free(g->ti);
+  free(g->ts);
+  free(g->tbw);
+  free(g->terr);
+  free(g);
+}
+
+/* dag_append:
+ * Append node nd to g and return its index.
+ */
+static int dag_append(IntervalDag *g, const IntervalDagNode *nd)
+{
+  if (g->n == g->cap)
+  {
+    g->cap *= 2;
+    g->node = dag_alloc(g->node, g->cap * sizeof(IntervalDagNode));
+  }
+  g->node[g->n] = *nd;
+  g->scheduled = 0;
+  return (g->n++);
+}
+
+/* IntervalDagAddInput:
+ * Add an input node of value x and arithmetic type xtyp to g. Returns the
+ * index of the new node.
+ */
+int IntervalDagAddInput(IntervalDag *g, Interval x, ArithType xtyp)
+{
+  IntervalDagNode nd;
+
+  nd.op = INTERVAL_OP_INPUT;
+  nd.a = nd.b = -1;
+  nd.xtyp = nd.ytyp = (xtyp == UNSIGNED_ARITH) ? UNSIGNED_ARITH : SIGNED_ARITH;
+  nd.x = x;
+  return (dag_append(g, &nd));
+}
+
+/* IntervalDagAddNode:
+ * Add a node computing operation op on the results of nodes a and b (b is
+ * ignored for unary operations) to g. xtyp, ytyp provide the arithmetic
+ * representation type for a and b, respectively. Returns the index of the new
+ * node, or -1 if op is invalid or an operand does not exist yet.
+ */
+int IntervalDagAddNode(IntervalDag *g, IntervalOpcode op, int a, int b,
+       ArithType xtyp, ArithType ytyp)
+{
+  IntervalDagNode nd;
+  int arity = IntervalOpcodeArity(op);
+
+  if (arity == 0 || a < 0 || a >= g->n ||
+      (arity == 2 && (b < 0 || b >= g->n)) ||
+      xtyp < UNKNOWN_ARITH_TYPE || xtyp > SIGNED_NEG_ARITH ||
+      ytyp < UNKNOWN_ARITH_TYPE || ytyp > SIGNED_NEG_ARITH)
+  {
+    return (-1);
+  }
+  nd.op = op;
+  nd.a = a;
+  nd.b = (arity == 2) ? b : -1;
+  nd.xtyp = xtyp;
+  nd.ytyp = (arity == 2) ? ytyp : xtyp;
+  nd.x = IntervalEmpty();
+  return (dag_append(g, &nd));
+}
+
+/* IntervalDagPrepare:
+ * Prepare g for a full evaluation: compute its schedule, if out of date, and 
+ * drop the nodes queued for incremental re-evaluation. After evaluating all 
+ * groups (see IntervalDagEvalSlots), the caller sets g->evaluated to 1.
+ */
+void IntervalDagPrepare(IntervalDag *g)
+{
+  int k, l;
+
+  if (!g->scheduled)
+  {
+    dag_schedule(g);
+  }
+  for (l = 0; l < g->nlevels; l++)
+  {
+    for (k = 0; k < g->ndirty[l]; k++)
+    {
+      g->mark[g->dirty[g->group_start[g->level_group[l]] + k]] = 0;
+    }
+    g->ndirty[l] = 0;
+  }
+}
+
+/* IntervalDagEval:
+ * Evaluate all nodes of g, level by level. Errors do not abort: the status
+ * flags of each node are available from IntervalDagStatus and failed nodes
+ * (and the nodes depending on them) receive the empty interval. Returns the
+ * OR of the status flags of all nodes.
+ */
+int IntervalDagEval(IntervalDag *g)
+{
+  int k, status = INTERVAL_OK;
+
+  IntervalDagPrepare(g);
+  for (k = 0; k < g->ngroups; k++)
+  {
+    status |= IntervalDagEvalSlots(g, g->group_start[k], g->group_start[k+1]);
+  }
+  g->evaluated = 1;
+
+  return (status);
+}
+
+/* IntervalDagSetInput:
+ * Change the value of input node id to x; the change takes effect with the 
+ * next IntervalDagUpdate (or IntervalDagEval). Returns INTERVAL_OK, or 
+ * INTERVAL_ERR_INVALID if id is not an input node.
+ */
+int IntervalDagSetInput(IntervalDag *g, int id, Interval x)
+{
+  if (id < 0 || id >= g->n || g->node[id].op != INTERVAL_OP_INPUT)
+  {
+    return (INTERVAL_ERR_INVALID);
+  }
+  g->node[id].x = x;
+  if (g->evaluated)
+  {
+    dag_enqueue(g, g->slot[id]);
+  }
+  return (INTERVAL_OK);
+}
+
+/* IntervalDagUpdate:
+ * Bring the results of g up-to-date after IntervalDagSetInput. Only the 
+ * dependency cone of the changed inputs is visited, level by level: a node is 
+ * recomputed only if the result of one of its operands changed, and 
+ * propagation stops at nodes whose result (interval and status) is the same 
+ * as before. The queued nodes of each group are evaluated with a single batch 
+ * call. If g has not been evaluated since its last change in structure, a 
+ * full IntervalDagEval is performed. The number of recomputed nodes is 
+ * returned in nrecomputed (if not NULL); the OR of their status flags is 
+ * returned.
+ */
+int IntervalDagUpdate(IntervalDag *g, int *nrecomputed)
+{
+  int *run, *q;
+  int l, m, k, j, c, s, count = 0, status = INTERVAL_OK;
+
+  if (!g->scheduled || !g->evaluated)
+  {
+    status = IntervalDagEval(g);
+    if (nrecomputed != NULL)
+    {
+      *nrecomputed = g->n;
+    }
+    return (status);
+  }
+
+  for (l = 0; l < g->nlevels; l++)
+  {
+    m = g->ndirty[l];
+    if (m == 0)
+    {
+      continue;
+    }
+    q = g->dirty + g->group_start[g->level_group[l]];
+    // Sorting the queue of the level brings the slots of each group together.
+    qsort(q, m, sizeof(int), cmp_int);
+    g->ndirty[l] = 0;
+    count += m;
+    for (run = q; run < q + m; run += k)
+    {
+      k = 1;
+      while (run + k < q + m && dag_key(&g->node[g->order[run[k]]]) == 
+                                dag_key(&g->node[g->order[run[0]]]))
+      {
+        k++;
+      }
+      status |= dag_eval_nodes(g, 0, run, k, 0, g->ti, g->ts, g->tbw, g->terr);
+      for (j = 0; j < k; j++)
+      {
+        s = run[j];
+        g->mark[s] = 0;
+        g->bw[s] = g->tbw[j];
+        if (g->ti[j] == g->infm[s] && g->ts[j] == g->supr[s] && 
+            g->terr[j] == g->err[s])
+        {
+          continue;
+        }
+        g->infm[s] = g->ti[j];
+        g->supr[s] = g->ts[j];
+        g->err[s] = g->terr[j];
+        for (c = g->cons_start[s]; c < g->cons_start[s + 1]; c++)
+        {
+          dag_enqueue(g, g->cons[c]);
+        }
+      }
+    }
+  }
+  if (nrecomputed != NULL)
+  {
+    *nrecomputed = count;
+  }
+
+  return (status);
+}
+
+/* IntervalDagResult:
+ * Return the interval computed for node id by the last IntervalDagEval, or
+ * the empty interval if there is none.
+ */
+Interval IntervalDagResult(const IntervalDag *g, int id)
+{
+  if (!g->scheduled || id < 0 || id >= g->n)
+  {
+    return (IntervalEmpty());
+  }
+  return (INTERVAL(g->infm[g->slot[id]], g->supr[g->slot[id]]));
+}
+
+/* IntervalDagBitwidth:
+ * Return the bitwidth (see IntervalToIntegerBitwidth) computed for node id by
+ * the last IntervalDagEval, or 0 if there is none.
+ */
+int IntervalDagBitwidth(const IntervalDag *g, int id)
+{
+  if (!g->scheduled || id < 0 || id >= g->n)
+  {
+    return (0);
+  }
+  return (g->bw[g->slot[id]]);
+}
+
+/* IntervalDagStatus:
+ * Return the IntervalStatus flags of node id from the last IntervalDagEval.
+ */
+int IntervalDagStatus(const IntervalDag *g, int id)
+{
+  if (!g->scheduled || id < 0 || id >= g->n)
+  {
+    return (INTERVAL_ERR_INVALID);
+  }
+  return (g->err[g->slot[id]]);
+}
+
+/* IntervalDagResults:
+ * Copy the results of the last IntervalDagEval into z and bw (either may be
+ * NULL), indexed by node.
+ */
+void IntervalDagResults(const IntervalDag *g, Interval *z, int *bw)
+{
+  int i;
+
+  for (i = 0; i < g->n; i++)
+  {
+    if (z != NULL)
+    {
+      z[i] = IntervalDagResult(g, i);
+    }
+    if (bw != NULL)
+    {
+      bw[i] = IntervalDagBitwidth(g, i);
+    }
+  }
+}
@@ -0,0 +1,94 @@
+/*
+ * Filename: interval-dag.h
+ * Purpose : Range propagation over expression DAGs built from interval
+ *           operations. Definitions and function prototypes.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.3 (26/10/16)
+ *           Added extern "C" guards for C++.
+ *           0.3.2 (26/10/16)
+ *           Added IntervalDagPrepare and IntervalDagEvalSlots.
+ *           0.3.1 (26/10/16)
+ *           Added incremental re-evaluation (IntervalDagSetInput, 
+ *           IntervalDagUpdate).
+ *           0.3.0 (26/10/16)
+ *           Initial version.
+ */
+#ifndef INTERVAL_DAG_H
+#define INTERVAL_DAG_H
+
+#include <stdio.h>
+#include "interval.h"
+#include "interval-batch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Opcode of the input (leaf) nodes of a DAG. */
+#define INTERVAL_OP_INPUT   (-1)
+
+/* IntervalDagNode describes a single node of an expression DAG. */
+typedef struct {
+  int op;                     /* IntervalOpcode or INTERVAL_OP_INPUT */
+  int a, b;                   /* Operand node indices (-1 if unused) */
+  ArithType xtyp, ytyp;       /* Arithmetic types of operands a and b */
+  Interval x;                 /* Value of an input node */
+} IntervalDagNode;
+
+/* IntervalDag holds an expression DAG along with its evaluation schedule.
+ * Nodes are identified by their index in order of creation; the operands of a
+ * node always precede it, so that the DAG is acyclic by construction.
+ * For evaluation, the nodes are sorted into topological levels (inputs at
+ * level 0, every other node one level above its deepest operand) and, within
+ * each level, into groups of nodes with the same opcode and operand types.
+ * The per-node results are kept as structure-of-arrays in this (slot) order,
+ * so that each group is evaluated with a single batch call.
+ * For incremental re-evaluation, the consumers of each slot are kept in
+ * compressed sparse row form, and the slots pending recomputation are queued
+ * per level (within the slot range of that level).
+ */
+typedef struct {
+  int n, cap;                 /* Number of nodes, allocated nodes */
+  IntervalDagNode *node;      /* Nodes, by index */
+  int scheduled;              /* Whether the schedule below is up-to-date */
+  int nlevels, ngroups;       /* Number of levels and groups */
+  int *level_group;           /* First group of each level (nlevels+1) */
+  int *group_start;           /* First slot of each group (ngroups+1) */
+  int *order;                 /* Node index of each slot */
+  int *slot;                  /* Slot of each node index */
+  int *aslot, *bslot;         /* Slots of the operands of each slot */
+  int *infm, *supr;           /* Resulting intervals, by slot */
+  int *bw;                    /* Resulting bitwidths, by slot */
+  int *err;                   /* IntervalStatus flags, by slot */
+  int *xi, *xs, *yi, *ys;     /* Operand gather buffers */
+  int evaluated;              /* Whether the results are up-to-date */
+  int *level;                 /* Level of each slot */
+  int *cons_start, *cons;     /* Consumer slots of each slot (CSR) */
+  int *dirty, *ndirty;        /* Queued slots and their number, per level */
+  char *mark;                 /* Whether each slot is queued */
+  int *ti, *ts, *tbw, *terr;  /* Incremental evaluation buffers */
+} IntervalDag;
+
+/* Interval DAG API. */
+IntervalDag *IntervalDagCreate(int capacity);
+void IntervalDagDestroy(IntervalDag *g);
+int IntervalDagAddInput(IntervalDag *g, Interval x, ArithType xtyp);
+int IntervalDagAddNode(IntervalDag *g, IntervalOpcode op, int a, int b,
+       ArithType xtyp, ArithType ytyp);
+int IntervalDagEval(IntervalDag *g);
+int IntervalDagSetInput(IntervalDag *g, int id, Interval x);
+int IntervalDagUpdate(IntervalDag *g, int *nrecomputed);
+Interval IntervalDagResult(const IntervalDag *g, int id);
+int IntervalDagBitwidth(const IntervalDag *g, int id);
+int IntervalDagStatus(const IntervalDag *g, int id);
+void IntervalDagResults(const IntervalDag *g, Interval *z, int *bw);
+void IntervalDagPrepare(IntervalDag *g);
+int IntervalDagEvalSlots(IntervalDag *g, int s0, int s1);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INTERVAL_DAG_H */
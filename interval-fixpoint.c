@@ -0,0 +1,625 @@
+/*
+ * Filename: interval-fixpoint.c
+ * Purpose : Implementation of the sparse worklist fixed-point solver for range
+ *           analysis over cyclic (SSA) graphs. An ascending phase with
+ *           threshold widening at phi nodes is followed by a bounded
+ *           narrowing phase.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.0 (26/10/16)
+ *           Initial version.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "interval.h"
+#include "interval-batch.h"
+#include "interval-dag.h"
+#include "interval-fixpoint.h"
+
+/* FixpointGraph holds the operand and user lists of a fixed-point graph in
+ * compressed sparse row form, along with the solver worklist.
+ */
+typedef struct {
+  int *phi_start, *phi_ops;   /* Operands of each phi node */
+  int *user_start, *users;    /* Users of each node */
+  int *queue, head, tail;     /* Circular worklist */
+  char *queued;               /* Whether each node is in the worklist */
+  int *count;                 /* Per-node update counters */
+} FixpointGraph;
+
+/* fixpoint_alloc:
+ * Reallocate p to size bytes (p may be NULL); abort when out of memory.
+ */
+static void *fixpoint_alloc(void *p, size_t size)
+{
+  p = realloc(p, (size > 0) ? size : 1);
+  if (p == NULL)
+  {
+    fprintf(stderr, "Error: Out of memory in interval fixed-point solver.\n");
+    exit(1);
+  }
+  return (p);
+}
+
+/* fixpoint_norm:
+ * Return x, or the canonical empty interval if x is empty.
+ */
+static Interval fixpoint_norm(Interval x)
+{
+  return ((x.infm > x.supr) ? IntervalEmpty() : x);
+}
+
+/* fixpoint_equal:
+ * Return 1 if intervals x and y are equal.
+ */
+static int fixpoint_equal(Interval x, Interval y)
+{
+  return (x.infm == y.infm && x.supr == y.supr);
+}
+
+/* fixpoint_hull:
+ * Return the hull of x and y, either of which may be empty.
+ */
+static Interval fixpoint_hull(Interval x, Interval y)
+{
+  if (IntervalIsEmpty(x) == 1)
+  {
+    return (y);
+  }
+  if (IntervalIsEmpty(y) == 1)
+  {
+    return (x);
+  }
+  return (IntervalUnion(x, y));
+}
+
+/* fixpoint_meet:
+ * Return the intersection of x and y, either of which may be empty.
+ */
+static Interval fixpoint_meet(Interval x, Interval y)
+{
+  if (IntervalIsEmpty(x) == 1 || IntervalIsEmpty(y) == 1)
+  {
+    return (IntervalEmpty());
+  }
+  return (fixpoint_norm(INTERVAL(MAX(x.infm, y.infm), MIN(x.supr, y.supr))));
+}
+
+/* fixpoint_widen:
+ * Widen old to x (a superset of old): each bound of x that has grown past the
+ * corresponding bound of old is rounded outwards to the next threshold.
+ */
+static Interval fixpoint_widen(const IntervalFixpoint *f, Interval old, Interval x)
+{
+  int lo, hi, mid;
+
+  if (IntervalIsEmpty(old) == 1)
+  {
+    return (x);
+  }
+  if (x.supr > old.supr)
+  {
+    // Smallest threshold >= x.supr.
+    lo = 0;
+    hi = f->nthresholds;
+    while (lo < hi)
+    {
+      mid = (lo + hi) / 2;
+      if (f->thresholds[mid] < x.supr)
+      {
+        lo = mid + 1;
+      }
+      else
+      {
+        hi = mid;
+      }
+    }
+    x.supr = (lo < f->nthresholds) ? f->thresholds[lo] : INT_MAX;
+  }
+  if (x.infm < old.infm)
+  {
+    // Largest threshold <= x.infm.
+    lo = 0;
+    hi = f->nthresholds;
+    while (lo < hi)
+    {
+      mid = (lo + hi) / 2;
+      if (f->thresholds[mid] <= x.infm)
+      {
+        lo = mid + 1;
+      }
+      else
+      {
+        hi = mid;
+      }
+    }
+    x.infm = (lo > 0) ? f->thresholds[lo - 1] : INT_MIN;
+  }
+  return (x);
+}
+
+/* fixpoint_eval:
+ * Compute the value of node v from the current values of its operands; the
+ * status flags are returned in status. The overflow-safe (wide) versions of
+ * the additive and multiplicative operations are used, so that bounds grown
+ * by widening saturate instead of wrapping around.
+ */
+static Interval fixpoint_eval(const IntervalFixpoint *f, const FixpointGraph *fg,
+  int v, int *status)
+{
+  const IntervalDagNode *nd = &f->node[v];
+  Interval x, y, z;
+  int k, binary, ovf = 0;
+
+  *status = INTERVAL_OK;
+  if (nd->op == INTERVAL_OP_INPUT)
+  {
+    return (fixpoint_norm(nd->x));
+  }
+  if (nd->op == INTERVAL_OP_PHI)
+  {
+    z = IntervalEmpty();
+    for (k = fg->phi_start[v]; k < fg->phi_start[v + 1]; k++)
+    {
+      z = fixpoint_hull(z, f->val[fg->phi_ops[k]]);
+    }
+    return (z);
+  }
+
+  binary = (nd->b >= 0);
+  x = f->val[nd->a];
+  y = binary ? f->val[nd->b] : x;
+  if (IntervalIsEmpty(x) == 1 || IntervalIsEmpty(y) == 1)
+  {
+    return (IntervalEmpty());
+  }
+  switch (nd->op)
+  {
+    case INTERVAL_OP_ADD:
+      z = IntervalAddWide(x, y, &ovf);
+      break;
+    case INTERVAL_OP_SUB:
+      z = IntervalSubWide(x, y, &ovf);
+      break;
+    case INTERVAL_OP_NEG:
+      z = IntervalNegWide(x, &ovf);
+      break;
+    case INTERVAL_OP_MUL:
+      // IntervalMulWide reports an unknown ArithType as an overflow; the 
+      // checked path reports INTERVAL_ERR_ARITH_TYPE instead.
+      if (nd->xtyp != UNKNOWN_ARITH_TYPE && nd->ytyp != UNKNOWN_ARITH_TYPE)
+      {
+        z = IntervalMulWide(x, y, nd->xtyp, nd->ytyp, &ovf);
+        break;
+      }
+      /* fall through */
+    default:
+      *status = IntervalBatchEvalChecked((IntervalOpcode)nd->op, 1,
+                  &x.infm, &x.supr, binary ? &y.infm : NULL, binary ? &y.supr : NULL,
+                  &z.infm, &z.supr, nd->xtyp, nd->ytyp, NULL);
+      break;
+  }
+  if (ovf)
+  {
+    *status |= INTERVAL_ERR_OVERFLOW;
+  }
+  return (fixpoint_norm(z));
+}
+
+/* fixpoint_push:
+ * Add node v to the worklist, unless already there.
+ */
+static void fixpoint_push(FixpointGraph *fg, int n, int v)
+{
+  if (!fg->queued[v])
+  {
+    fg->queued[v] = 1;
+    fg->queue[fg->tail] = v;
+    fg->tail = (fg->tail + 1) % (n + 1);
+  }
+}
+
+/* fixpoint_pop:
+ * Remove and return the first node of the worklist, or -1 if it is empty.
+ */
+static int fixpoint_pop(FixpointGraph *fg, int n)
+{
+  int v;
+
+  if (fg->head == fg->tail)
+  {
+    return (-1);
+  }
+  v = fg->queue[fg->head];
+  fg->head = (fg->head + 1) % (n + 1);
+  fg->queued[v] = 0;
+  return (v);
+}
+
+/* fixpoint_build:
+ * Build the phi operand and user lists of f. Returns INTERVAL_ERR_INVALID if
+ * a phi operand does not exist.
+ */
+static int fixpoint_build(const IntervalFixpoint *f, FixpointGraph *fg)
+{
+  int n = f->n, i, k;
+  int *pos = fixpoint_alloc(NULL, (n + 1) * sizeof(int));
+
+  fg->phi_start  = fixpoint_alloc(NULL, (n + 1) * sizeof(int));
+  fg->phi_ops    = fixpoint_alloc(NULL, f->nphiops * sizeof(int));
+  fg->user_start = fixpoint_alloc(NULL, (n + 1) * sizeof(int));
+  fg->users      = fixpoint_alloc(NULL, (2 * n + f->nphiops) * sizeof(int));
+  fg->queue      = fixpoint_alloc(NULL, (n + 1) * sizeof(int));
+  fg->queued     = fixpoint_alloc(NULL, n * sizeof(char));
+  fg->count      = fixpoint_alloc(NULL, n * sizeof(int));
+  fg->head = fg->tail = 0;
+  memset(fg->queued, 0, n * sizeof(char));
+  memset(fg->phi_start, 0, (n + 1) * sizeof(int));
+  memset(fg->user_start, 0, (n + 1) * sizeof(int));
+
+  for (k = 0; k < f->nphiops; k++)
+  {
+    if (f->phi_src[k] >= n)
+    {
+      free(pos);
+      return (INTERVAL_ERR_INVALID);
+    }
+    fg->phi_start[f->phi_dst[k] + 1]++;
+    fg->user_start[f->phi_src[k] + 1]++;
+  }
+  for (i = 0; i < n; i++)
+  {
+    if (f->node[i].a >= 0)
+    {
+      fg->user_start[f->node[i].a + 1]++;
+    }
+    if (f->node[i].b >= 0)
+    {
+      fg->user_start[f->node[i].b + 1]++;
+    }
+  }
+  for (i = 0; i < n; i++)
+  {
+    fg->phi_start[i + 1] += fg->phi_start[i];
+    fg->user_start[i + 1] += fg->user_start[i];
+  }
+
+  memcpy(pos, fg->phi_start, (n + 1) * sizeof(int));
+  for (k = 0; k < f->nphiops; k++)
+  {
+    fg->phi_ops[pos[f->phi_dst[k]]++] = f->phi_src[k];
+  }
+  memcpy(pos, fg->user_start, (n + 1) * sizeof(int));
+  for (k = 0; k < f->nphiops; k++)
+  {
+    fg->users[pos[f->phi_src[k]]++] = f->phi_dst[k];
+  }
+  for (i = 0; i < n; i++)
+  {
+    if (f->node[i].a >= 0)
+    {
+      fg->users[pos[f->node[i].a]++] = i;
+    }
+    if (f->node[i].b >= 0)
+    {
+      fg->users[pos[f->node[i].b]++] = i;
+    }
+  }
+
+  free(pos);
+  return (INTERVAL_OK);
+}
+
+/* fixpoint_free:
+ * Free the lists of fg.
+ */
+static void fixpoint_free(FixpointGraph *fg)
+{
+  free(fg->phi_start);
+  free(fg->phi_ops);
+  free(fg->user_start);
+  free(fg->users);
+  free(fg->queue);
+  free(fg->queued);
+  free(fg->count);
+}
+
+/* IntervalFixpointCreate:
+ * Create an empty graph with room for capacity nodes (it grows as needed),
+ * with the default widening thresholds and solver parameters.
+ */
+IntervalFixpoint *IntervalFixpointCreate(int capacity)
+{
+  IntervalFixpoint *f = fixpoint_alloc(NULL, sizeof(IntervalFixpoint));
+  Interval t;
+  int k;
+
+  memset(f, 0, sizeof(IntervalFixpoint));
+  f->cap = MAX(capacity, 16);
+  f->node = fixpoint_alloc(NULL, f->cap * sizeof(IntervalDagNode));
+  f->phicap = 16;
+  f->phi_dst = fixpoint_alloc(NULL, f->phicap * sizeof(int));
+  f->phi_src = fixpoint_alloc(NULL, f->phicap * sizeof(int));
+  f->widen_delay = INTERVAL_FIXPOINT_WIDEN_DELAY;
+  f->narrow_passes = INTERVAL_FIXPOINT_NARROW_PASSES;
+  // Default thresholds: the ranges of all signed bitwidths, i.e.
+  // -2^(k-1) and 2^(k-1)-1 (the latter also covers unsigned bitwidths).
+  IntervalFixpointAddThreshold(f, 0);
+  for (k = 1; k <= 32; k++)
+  {
+    t = IntegerBitwidthToInterval(k, SIGNED_ARITH);
+    IntervalFixpointAddThreshold(f, t.infm);
+    IntervalFixpointAddThreshold(f, t.supr);
+  }
+
+  return (f);
+}
+
+/* IntervalFixpointDestroy:
+ * Free all memory of f.
+ */
+void IntervalFixpointDestroy(IntervalFixpoint *f)
+{
+  if (f == NULL)
+  {
+    return;
+  }
+  free(f->node);
+  free(f->phi_dst);
+  free(f->phi_src);
+  free(f->thresholds);
+  free(f->val);
+  free(f->err);
+  free(f);
+}
+
+/* fixpoint_append:
+ * Append node nd to f and return its index.
+ */
+static int fixpoint_append(IntervalFixpoint *f, const IntervalDagNode *nd)
+{
+  if (f->n == f->cap)
+  {
+    f->cap *= 2;
+    f->node = fixpoint_alloc(f->node, f->cap * sizeof(IntervalDagNode));
+  }
+  f->node[f->n] = *nd;
+  return (f->n++);
+}
+
+/* IntervalFixpointAddInput:
+ * Add an input (constant) node of value x and arithmetic type xtyp to f.
+ * Returns the index of the new node, or -1 if xtyp is invalid.
+ */
+int IntervalFixpointAddInput(IntervalFixpoint *f, Interval x, ArithType xtyp)
+{
+  IntervalDagNode nd;
+
+  if (xtyp < UNKNOWN_ARITH_TYPE || xtyp > SIGNED_NEG_ARITH)
+  {
+    return (-1);
+  }
+  nd.op = INTERVAL_OP_INPUT;
+  nd.a = nd.b = -1;
+  nd.xtyp = nd.ytyp = xtyp;
+  nd.x = x;
+  return (fixpoint_append(f, &nd));
+}
+
+/* IntervalFixpointAddNode:
+ * Add a node computing operation op on the values of nodes a and b (b is
+ * ignored for unary operations) to f. Returns the index of the new node, or
+ * -1 if op, xtyp or ytyp is invalid or an operand does not exist yet.
+ */
+int IntervalFixpointAddNode(IntervalFixpoint *f, IntervalOpcode op, int a, int b,
+       ArithType xtyp, ArithType ytyp)
+{
+  IntervalDagNode nd;
+  int arity = IntervalOpcodeArity(op);
+
+  if (arity == 0 || a < 0 || a >= f->n ||
+      (arity == 2 && (b < 0 || b >= f->n)) ||
+      xtyp < UNKNOWN_ARITH_TYPE || xtyp > SIGNED_NEG_ARITH ||
+      ytyp < UNKNOWN_ARITH_TYPE || ytyp > SIGNED_NEG_ARITH)
+  {
+    return (-1);
+  }
+  nd.op = op;
+  nd.a = a;
+  nd.b = (arity == 2) ? b : -1;
+  nd.xtyp = xtyp;
+  nd.ytyp = (arity == 2) ? ytyp : xtyp;
+  nd.x = IntervalEmpty();
+  return (fixpoint_append(f, &nd));
+}
+
+/* IntervalFixpointAddPhi:
+ * Add a phi node without operands to f. Returns the index of the new node.
+ */
+int IntervalFixpointAddPhi(IntervalFixpoint *f)
+{
+  IntervalDagNode nd;
+
+  nd.op = INTERVAL_OP_PHI;
+  nd.a = nd.b = -1;
+  nd.xtyp = nd.ytyp = SIGNED_ARITH;
+  nd.x = IntervalEmpty();
+  return (fixpoint_append(f, &nd));
+}
+
+/* IntervalFixpointAddPhiOperand:
+ * Add node v as an operand of phi node phi. v may be added to f later (e.g.
+ * the value carried by the back edge of a loop), but before solving. Returns
+ * INTERVAL_OK, or INTERVAL_ERR_INVALID if phi is not a phi node or v < 0.
+ */
+int IntervalFixpointAddPhiOperand(IntervalFixpoint *f, int phi, int v)
+{
+  if (phi < 0 || phi >= f->n || f->node[phi].op != INTERVAL_OP_PHI || v < 0)
+  {
+    return (INTERVAL_ERR_INVALID);
+  }
+  if (f->nphiops == f->phicap)
+  {
+    f->phicap *= 2;
+    f->phi_dst = fixpoint_alloc(f->phi_dst, f->phicap * sizeof(int));
+    f->phi_src = fixpoint_alloc(f->phi_src, f->phicap * sizeof(int));
+  }
+  f->phi_dst[f->nphiops] = phi;
+  f->phi_src[f->nphiops] = v;
+  f->nphiops++;
+  return (INTERVAL_OK);
+}
+
+/* IntervalFixpointAddThreshold:
+ * Add widening threshold t (e.g. a loop bound) to f.
+ */
+void IntervalFixpointAddThreshold(IntervalFixpoint *f, int t)
+{
+  int k;
+
+  k = 0;
+  while (k < f->nthresholds && f->thresholds[k] < t)
+  {
+    k++;
+  }
+  if (k < f->nthresholds && f->thresholds[k] == t)
+  {
+    return;
+  }
+  f->thresholds = fixpoint_alloc(f->thresholds, (f->nthresholds + 1) * sizeof(int));
+  memmove(&f->thresholds[k + 1], &f->thresholds[k],
+    (f->nthresholds - k) * sizeof(int));
+  f->thresholds[k] = t;
+  f->nthresholds++;
+}
+
+/* IntervalFixpointSolve:
+ * Compute the interval of every node of f. All nodes start empty (unreached).
+ * In the ascending phase, a worklist of nodes is processed until no value
+ * changes: the users of a node are queued whenever its value changes, and phi
+ * nodes accumulate the hull of their successive values, widened to the
+ * thresholds after widen_delay increases. In the descending (narrowing) phase,
+ * each node is recomputed at most narrow_passes times, taking the
+ * intersection of its new and current values. The number of node evaluations
+ * is returned in nevals (if not NULL); the OR of the status flags of all
+ * nodes (or INTERVAL_ERR_INVALID for a missing phi operand) is returned.
+ */
+int IntervalFixpointSolve(IntervalFixpoint *f, int *nevals)
+{
+  FixpointGraph fg;
+  Interval z;
+  int n = f->n, v, k, st, evals = 0, status = INTERVAL_OK;
+
+  if (nevals != NULL)
+  {
+    *nevals = 0;
+  }
+  if (fixpoint_build(f, &fg) != INTERVAL_OK)
+  {
+    fixpoint_free(&fg);
+    return (INTERVAL_ERR_INVALID);
+  }
+  f->val = fixpoint_alloc(f->val, n * sizeof(Interval));
+  f->err = fixpoint_alloc(f->err, n * sizeof(int));
+  f->nsolved = n;
+  for (v = 0; v < n; v++)
+  {
+    f->val[v] = IntervalEmpty();
+    f->err[v] = INTERVAL_OK;
+    fg.count[v] = 0;
+    fixpoint_push(&fg, n, v);
+  }
+
+  // Ascending phase, with widening at the phi nodes.
+  while ((v = fixpoint_pop(&fg, n)) >= 0)
+  {
+    evals++;
+    z = fixpoint_eval(f, &fg, v, &f->err[v]);
+    if (f->node[v].op == INTERVAL_OP_PHI)
+    {
+      z = fixpoint_hull(f->val[v], z);
+      if (!fixpoint_equal(z, f->val[v]) && ++fg.count[v] > f->widen_delay)
+      {
+        z = fixpoint_widen(f, f->val[v], z);
+      }
+    }
+    if (!fixpoint_equal(z, f->val[v]))
+    {
+      f->val[v] = z;
+      for (k = fg.user_start[v]; k < fg.user_start[v + 1]; k++)
+      {
+        fixpoint_push(&fg, n, fg.users[k]);
+      }
+    }
+  }
+
+  // Descending phase: narrowing.
+  for (v = 0; v < n; v++)
+  {
+    fg.count[v] = 0;
+    if (f->node[v].op != INTERVAL_OP_INPUT)
+    {
+      fixpoint_push(&fg, n, v);
+    }
+  }
+  while ((v = fixpoint_pop(&fg, n)) >= 0)
+  {
+    if (fg.count[v]++ >= f->narrow_passes)
+    {
+      continue;
+    }
+    evals++;
+    z = fixpoint_meet(f->val[v], fixpoint_eval(f, &fg, v, &st));
+    f->err[v] = st;
+    if (!fixpoint_equal(z, f->val[v]))
+    {
+      f->val[v] = z;
+      for (k = fg.user_start[v]; k < fg.user_start[v + 1]; k++)
+      {
+        fixpoint_push(&fg, n, fg.users[k]);
+      }
+    }
+  }
+
+  for (v = 0; v < n; v++)
+  {
+    status |= f->err[v];
+  }
+  if (nevals != NULL)
+  {
+    *nevals = evals;
+  }
+  fixpoint_free(&fg);
+
+  return (status);
+}
+
+/* IntervalFixpointResult:
+ * Return the interval computed for node id by the last IntervalFixpointSolve
+ * (empty for unreached values).
+ */
+Interval IntervalFixpointResult(const IntervalFixpoint *f, int id)
+{
+  if (id < 0 || id >= f->nsolved)
+  {
+    return (IntervalEmpty());
+  }
+  return (f->val[id]);
+}
+
+/* IntervalFixpointStatus:
+ * Return the IntervalStatus flags of node id from the last
+ * IntervalFixpointSolve.
+ */
+int IntervalFixpointStatus(const IntervalFixpoint *f, int id)
+{
+  if (id < 0 || id >= f->nsolved)
+  {
+    return (INTERVAL_ERR_INVALID);
+  }
+  return (f->err[id]);
+}
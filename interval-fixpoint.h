@@ -0,0 +1,78 @@
+/*
+ * Filename: interval-fixpoint.h
+ * Purpose : Sparse worklist fixed-point solver for range analysis over cyclic
+ *           (SSA) graphs, with widening and narrowing. Definitions and
+ *           function prototypes.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.1 (26/10/16)
+ *           Added extern "C" guards for C++.
+ *           0.3.0 (26/10/16)
+ *           Initial version.
+ */
+#ifndef INTERVAL_FIXPOINT_H
+#define INTERVAL_FIXPOINT_H
+
+#include <stdio.h>
+#include "interval.h"
+#include "interval-batch.h"
+#include "interval-dag.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Opcode of the phi nodes of a fixed-point graph. */
+#define INTERVAL_OP_PHI     (-2)
+
+/* Default solver parameters. */
+#define INTERVAL_FIXPOINT_WIDEN_DELAY    1
+#define INTERVAL_FIXPOINT_NARROW_PASSES  3
+
+/* IntervalFixpoint holds a graph of SSA values along with the solver state.
+ * Nodes are input, operation (see IntervalDagNode) or phi nodes. The operands
+ * of an operation node must precede it; phi operands may refer to any node,
+ * so that loop-carried values are expressed through phi nodes (every cycle
+ * must pass through one). Branch conditions are expressed by intersecting a
+ * value with a constant interval (INTERVAL_OP_INTERSECTION).
+ * The empty interval stands for an unreached value: a phi node is the hull of
+ * its non-empty operands and any other node with an empty operand is empty.
+ * Widening is applied at phi nodes, after widen_delay increases, by rounding
+ * the growing bounds to the next threshold; the default thresholds are the
+ * bounds of IntegerBitwidthToInterval for all bitwidths. A narrowing phase of
+ * at most narrow_passes recomputations per node then recovers the bounds lost
+ * to widening.
+ */
+typedef struct {
+  int n, cap;                 /* Number of nodes, allocated nodes */
+  IntervalDagNode *node;      /* Nodes, by index */
+  int nphiops, phicap;        /* Number of phi operands, allocated */
+  int *phi_dst, *phi_src;     /* Phi operands: (phi node, operand) pairs */
+  int nthresholds;            /* Number of widening thresholds */
+  int *thresholds;            /* Widening thresholds, in increasing order */
+  int widen_delay;            /* Phi increases before widening */
+  int narrow_passes;          /* Recomputations per node while narrowing */
+  int nsolved;                /* Number of nodes at the last solve */
+  Interval *val;              /* Resulting intervals, by node */
+  int *err;                   /* IntervalStatus flags, by node */
+} IntervalFixpoint;
+
+/* Interval fixed-point solver API. */
+IntervalFixpoint *IntervalFixpointCreate(int capacity);
+void IntervalFixpointDestroy(IntervalFixpoint *f);
+int IntervalFixpointAddInput(IntervalFixpoint *f, Interval x, ArithType xtyp);
+int IntervalFixpointAddNode(IntervalFixpoint *f, IntervalOpcode op, int a, int b,
+       ArithType xtyp, ArithType ytyp);
+int IntervalFixpointAddPhi(IntervalFixpoint *f);
+int IntervalFixpointAddPhiOperand(IntervalFixpoint *f, int phi, int v);
+void IntervalFixpointAddThreshold(IntervalFixpoint *f, int t);
+int IntervalFixpointSolve(IntervalFixpoint *f, int *nevals);
+Interval IntervalFixpointResult(const IntervalFixpoint *f, int id);
+int IntervalFixpointStatus(const IntervalFixpoint *f, int id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INTERVAL_FIXPOINT_H */
@@ -0,0 +1,358 @@
+/*
+ * Filename: interval-index.c
+ * Purpose : Implementation of the static stabbing-query index. The implicit
+ *           interval tree follows the layout of H. Li's cgranges: node i of
+ *           the sorted array lies at level t, the number of trailing 1 bits
+ *           of i, and its children are i -/+ 2^(t-1). Membership in the union
+ *           is answered by a branch-free Eytzinger search, which the batched
+ *           query interleaves over several values to overlap cache misses.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.0 (26/10/16)
+ *           Initial version.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "interval.h"
+#include "interval-index.h"
+
+/* Number of values searched together by IntervalIndexAnyBatch. */
+#define INDEX_LANES  8
+
+/* Subtrees up to this level are scanned linearly. */
+#define INDEX_SCAN_LEVEL  3
+
+/* Prefetch the Eytzinger nodes three levels below node k (one cache line). */
+#if defined(__GNUC__)
+#define INDEX_PREFETCH(eyt, k)  __builtin_prefetch((eyt) + 8 * (k))
+#else
+#define INDEX_PREFETCH(eyt, k)
+#endif
+
+/* IndexFrame is a pending subtree of a tree traversal. */
+typedef struct {
+  long x;                     /* Root of the subtree */
+  int k;                      /* Level of the root */
+  int w;                      /* Whether the left child was visited */
+} IndexFrame;
+
+/* index_alloc:
+ * Allocate size bytes; abort when out of memory.
+ */
+static void *index_alloc(size_t size)
+{
+  void *p = malloc((size > 0) ? size : 1);
+
+  if (p == NULL)
+  {
+    fprintf(stderr, "Error: Out of memory in interval index.\n");
+    exit(1);
+  }
+  return (p);
+}
+
+/* cmp_node:
+ * qsort() comparison function ordering nodes by infimum, then supremum.
+ */
+static int cmp_node(const void *a, const void *b)
+{
+  const IntervalIndexNode *x = (const IntervalIndexNode *)a;
+  const IntervalIndexNode *y = (const IntervalIndexNode *)b;
+
+  if (x->infm != y->infm)
+  {
+    return ((x->infm < y->infm) ? -1 : 1);
+  }
+  return ((x->supr > y->supr) - (x->supr < y->supr));
+}
+
+/* index_ffz:
+ * Return the position plus one of the lowest zero bit of k.
+ */
+static inline int index_ffz(unsigned long k)
+{
+#if defined(__GNUC__)
+  return (__builtin_ctzl(~k) + 1);
+#else
+  int n = 1;
+  while (k & 1)
+  {
+    k >>= 1;
+    n++;
+  }
+  return (n);
+#endif
+}
+
+/* index_build_tree:
+ * Compute the maximum supremum of every subtree of the n sorted nodes and
+ * return the level of the root (-1 if n is 0).
+ */
+static int index_build_tree(IntervalIndexNode *node, long n)
+{
+  long i, last_i = 0, x, i0, step;
+  int k, last = 0, e, el, er;
+
+  if (n == 0)
+  {
+    return (-1);
+  }
+  // Leaves are the even nodes; last tracks the maximum at the rightmost node
+  // of the current level, standing in for missing right children.
+  for (i = 0; i < n; i += 2)
+  {
+    last_i = i;
+    last = node[i].max = node[i].supr;
+  }
+  for (k = 1; (1L << k) <= n; k++)
+  {
+    x = 1L << (k - 1);
+    i0 = (x << 1) - 1;
+    step = x << 2;
+    for (i = i0; i < n; i += step)
+    {
+      el = node[i - x].max;
+      er = (i + x < n) ? node[i + x].max : last;
+      e = MAX(node[i].supr, MAX(el, er));
+      node[i].max = e;
+    }
+    last_i = ((last_i >> k) & 1) ? last_i - x : last_i + x;
+    if (last_i < n && node[last_i].max > last)
+    {
+      last = node[last_i].max;
+    }
+  }
+  return (k - 1);
+}
+
+/* index_fill_eyt:
+ * Store the sorted members s[i...] in Eytzinger order, starting at node k of
+ * eyt. Returns the index of the next member of s.
+ */
+static int index_fill_eyt(Interval *eyt, const Interval *s, int i, long k, int m)
+{
+  if (k <= m)
+  {
+    i = index_fill_eyt(eyt, s, i, 2 * k, m);
+    eyt[k] = s[i++];
+    i = index_fill_eyt(eyt, s, i, 2 * k + 1, m);
+  }
+  return (i);
+}
+
+/* IntervalIndexCreate:
+ * Build the index of the n intervals of x; empty intervals are ignored. The
+ * intervals are referred to by their position in x.
+ */
+IntervalIndex *IntervalIndexCreate(const Interval *x, int n)
+{
+  IntervalIndex *ix = index_alloc(sizeof(IntervalIndex));
+  Interval *s;
+  int i, m;
+
+  ix->node = index_alloc((size_t)MAX(n, 0) * sizeof(IntervalIndexNode));
+  ix->n = 0;
+  for (i = 0; i < n; i++)
+  {
+    if (x[i].infm <= x[i].supr)
+    {
+      ix->node[ix->n].infm = x[i].infm;
+      ix->node[ix->n].supr = x[i].supr;
+      ix->node[ix->n].id = i;
+      ix->n++;
+    }
+  }
+  qsort(ix->node, ix->n, sizeof(IntervalIndexNode), cmp_node);
+  ix->root = index_build_tree(ix->node, ix->n);
+
+  // Coalesce the sorted intervals into the union, then lay it out.
+  s = index_alloc((size_t)MAX(ix->n, 1) * sizeof(Interval));
+  m = 0;
+  for (i = 0; i < ix->n; i++)
+  {
+    if (m > 0 && ix->node[i].infm <= s[m-1].supr)
+    {
+      s[m-1].supr = MAX(s[m-1].supr, ix->node[i].supr);
+    }
+    else
+    {
+      s[m++] = INTERVAL(ix->node[i].infm, ix->node[i].supr);
+    }
+  }
+  ix->m = m;
+  ix->eyt = index_alloc((size_t)(m + 1) * sizeof(Interval));
+  index_fill_eyt(ix->eyt, s, 0, 1, m);
+  free(s);
+
+  return (ix);
+}
+
+/* IntervalIndexDestroy:
+ * Free all memory of index ix.
+ */
+void IntervalIndexDestroy(IntervalIndex *ix)
+{
+  if (ix == NULL)
+  {
+    return;
+  }
+  free(ix->node);
+  free(ix->eyt);
+  free(ix);
+}
+
+/* IntervalIndexAny:
+ * Check if any indexed interval contains value v, by searching the union for
+ * the first member whose supremum is not below v.
+ */
+int IntervalIndexAny(const IntervalIndex *ix, int v)
+{
+  const Interval *eyt = ix->eyt;
+  unsigned long k = 1;
+
+  while (k <= (unsigned long)ix->m)
+  {
+    INDEX_PREFETCH(eyt, k);
+    k = 2 * k + (eyt[k].supr < v);
+  }
+  k >>= index_ffz(k);
+  return (k != 0 && eyt[k].infm <= v);
+}
+
+/* IntervalIndexStab:
+ * Find the indexed intervals containing value v and store their ids (their
+ * positions in the array given to IntervalIndexCreate, in infimum order) in
+ * ids, up to max of them (ids may be NULL for max = 0). Returns the number of
+ * intervals containing v, which may exceed max.
+ */
+int IntervalIndexStab(const IntervalIndex *ix, int v, int *ids, int max)
+{
+  const IntervalIndexNode *node = ix->node;
+  IndexFrame stack[64], z;
+  long i, i0, i1, y, n = ix->n;
+  int t = 0, count = 0;
+
+  if (n == 0)
+  {
+    return (0);
+  }
+  z.k = ix->root;
+  z.x = (1L << z.k) - 1;
+  z.w = 0;
+  stack[t++] = z;
+  while (t > 0)
+  {
+    z = stack[--t];
+    if (z.k <= INDEX_SCAN_LEVEL)
+    {
+      // Small subtree: scan its nodes in order.
+      i0 = z.x >> z.k << z.k;
+      i1 = MIN(i0 + (1L << (z.k + 1)) - 1, n);
+      for (i = i0; i < i1 && node[i].infm <= v; i++)
+      {
+        if (v <= node[i].supr)
+        {
+          if (count < max)
+          {
+            ids[count] = node[i].id;
+          }
+          count++;
+        }
+      }
+    }
+    else if (z.w == 0)
+    {
+      // Revisit z after its left child, which is skipped if no interval in
+      // it reaches v (it may lie beyond the last node).
+      y = z.x - (1L << (z.k - 1));
+      z.w = 1;
+      stack[t++] = z;
+      if (y >= n || node[y].max >= v)
+      {
+        z.x = y;
+        z.k--;
+        z.w = 0;
+        stack[t++] = z;
+      }
+    }
+    else if (z.x < n && node[z.x].infm <= v)
+    {
+      if (v <= node[z.x].supr)
+      {
+        if (count < max)
+        {
+          ids[count] = node[z.x].id;
+        }
+        count++;
+      }
+      z.x += 1L << (z.k - 1);
+      z.k--;
+      z.w = 0;
+      stack[t++] = z;
+    }
+  }
+  return (count);
+}
+
+/* IntervalIndexAnyBatch:
+ * Batched version of IntervalIndexAny: found[i] is set to whether any indexed
+ * interval contains v[i]. INDEX_LANES searches proceed in lock-step, so that
+ * their cache misses overlap.
+ */
+void IntervalIndexAnyBatch(const IntervalIndex *ix, int n, const int *v,
+       int *found)
+{
+  const Interval *eyt = ix->eyt;
+  unsigned long k[INDEX_LANES], m = (unsigned long)ix->m;
+  int i, j, w, active;
+
+  for (i = 0; i < n; i += INDEX_LANES)
+  {
+    w = MIN(INDEX_LANES, n - i);
+    for (j = 0; j < w; j++)
+    {
+      k[j] = 1;
+    }
+    // All lanes take the same number of steps, give or take the last one.
+    do
+    {
+      active = 0;
+      for (j = 0; j < w; j++)
+      {
+        if (k[j] <= m)
+        {
+          INDEX_PREFETCH(eyt, k[j]);
+          k[j] = 2 * k[j] + (eyt[k[j]].supr < v[i + j]);
+          active = 1;
+        }
+      }
+    } while (active);
+    for (j = 0; j < w; j++)
+    {
+      k[j] >>= index_ffz(k[j]);
+      found[i + j] = (k[j] != 0 && eyt[k[j]].infm <= v[i + j]);
+    }
+  }
+}
+
+/* IntervalIndexStabBatch:
+ * Batched version of IntervalIndexStab: count[i] is set to the number of
+ * indexed intervals containing v[i]. Values outside the union are answered
+ * by the (cheaper) union search alone.
+ */
+void IntervalIndexStabBatch(const IntervalIndex *ix, int n, const int *v,
+       int *count)
+{
+  int i;
+
+  IntervalIndexAnyBatch(ix, n, v, count);
+  for (i = 0; i < n; i++)
+  {
+    if (count[i])
+    {
+      count[i] = IntervalIndexStab(ix, v[i], NULL, 0);
+    }
+  }
+}
@@ -0,0 +1,58 @@
+/*
+ * Filename: interval-index.h
+ * Purpose : Static stabbing-query index over a set of intervals.
+ *           Definitions and function prototypes.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.1 (26/10/16)
+ *           Added extern "C" guards for C++.
+ *           0.3.0 (26/10/16)
+ *           Initial version.
+ */
+#ifndef INTERVAL_INDEX_H
+#define INTERVAL_INDEX_H
+
+#include <stdio.h>
+#include "interval.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* IntervalIndexNode is an indexed interval, in infimum order. */
+typedef struct {
+  int infm, supr;             /* Interval */
+  int max;                    /* Maximum supremum of the implicit subtree */
+  int id;                     /* Index of the interval given to Create */
+} IntervalIndexNode;
+
+/* IntervalIndex is built once from an array of intervals and answers point
+ * (stabbing) queries in logarithmic time. The intervals sorted by infimum form
+ * an implicit, in-order binary tree augmented with the maximum supremum of
+ * each subtree. Their union, a sorted array of disjoint intervals, is stored
+ * in Eytzinger (breadth-first) order for cache-friendly binary search.
+ */
+typedef struct {
+  int n;                      /* Number of (non-empty) indexed intervals */
+  int root;                   /* Level of the root of the implicit tree */
+  IntervalIndexNode *node;    /* Intervals sorted by infimum */
+  int m;                      /* Number of members of the union */
+  Interval *eyt;              /* Union members in Eytzinger order, from 1 */
+} IntervalIndex;
+
+/* Interval index API. */
+IntervalIndex *IntervalIndexCreate(const Interval *x, int n);
+void IntervalIndexDestroy(IntervalIndex *ix);
+int IntervalIndexAny(const IntervalIndex *ix, int v);
+int IntervalIndexStab(const IntervalIndex *ix, int v, int *ids, int max);
+void IntervalIndexAnyBatch(const IntervalIndex *ix, int n, const int *v,
+       int *found);
+void IntervalIndexStabBatch(const IntervalIndex *ix, int n, const int *v,
+       int *count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INTERVAL_INDEX_H */
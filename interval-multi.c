@@ -0,0 +1,484 @@
+/*
+ * Filename: interval-multi.c
+ * Purpose : Implementation of the multi-interval type. Union and intersection
+ *           are linear merges of the sorted member arrays. Arithmetic forms
+ *           all pairs of members and evaluates them with a single batch call,
+ *           then sorts and coalesces the results; when more than cap members
+ *           remain, those separated by the smallest gaps are merged.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.0 (26/10/16)
+ *           Initial version.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "interval.h"
+#include "interval-batch.h"
+#include "interval-multi.h"
+
+/* Number of member pairs evaluated without heap allocation. */
+#define MULTI_LOCAL  64
+
+/* Members of multi-interval s. */
+#define MULTI_MEMBERS(s)  (((s)->n <= INTERVAL_MULTI_INLINE) ? (s)->buf : (s)->heap)
+
+/* MultiGap is the gap between members k and k+1. */
+typedef struct {
+  unsigned int gap;
+  int k;
+} MultiGap;
+
+/* multi_alloc:
+ * Reallocate p to size bytes (p may be NULL); abort when out of memory.
+ */
+static void *multi_alloc(void *p, size_t size)
+{
+  p = realloc(p, (size > 0) ? size : 1);
+  if (p == NULL)
+  {
+    fprintf(stderr, "Error: Out of memory in interval multi.\n");
+    exit(1);
+  }
+  return (p);
+}
+
+/* cmp_infm:
+ * qsort() comparison function ordering intervals by their infimum.
+ */
+static int cmp_infm(const void *a, const void *b)
+{
+  const Interval *x = (const Interval *)a, *y = (const Interval *)b;
+
+  if (x->infm != y->infm)
+  {
+    return ((x->infm < y->infm) ? -1 : 1);
+  }
+  return ((x->supr > y->supr) - (x->supr < y->supr));
+}
+
+/* cmp_gap:
+ * qsort() comparison function ordering gaps by size, then by position.
+ */
+static int cmp_gap(const void *a, const void *b)
+{
+  const MultiGap *x = (const MultiGap *)a, *y = (const MultiGap *)b;
+
+  if (x->gap != y->gap)
+  {
+    return ((x->gap < y->gap) ? -1 : 1);
+  }
+  return (x->k - y->k);
+}
+
+/* multi_push:
+ * Append interval v (with v.infm not below the infimum of the last member) to
+ * the m members of t, coalescing it with the last member if they overlap or
+ * are adjacent. Returns the new number of members.
+ */
+static inline int multi_push(Interval *t, int m, Interval v)
+{
+  if (m > 0 && (long long)v.infm <= (long long)t[m-1].supr + 1)
+  {
+    t[m-1].supr = MAX(t[m-1].supr, v.supr);
+    return (m);
+  }
+  t[m] = v;
+  return (m + 1);
+}
+
+/* multi_cap:
+ * Reduce the n sorted, disjoint members of t to at most cap by merging the
+ * members separated by the n-cap smallest gaps. Returns the new number of
+ * members.
+ */
+static int multi_cap(Interval *t, int n, int cap)
+{
+  MultiGap local[MULTI_LOCAL], *g;
+  char *join;
+  int k, m;
+
+  if (n <= cap)
+  {
+    return (n);
+  }
+  g = (n <= MULTI_LOCAL) ? local : multi_alloc(NULL, n * sizeof(MultiGap));
+  join = multi_alloc(NULL, n);
+  for (k = 0; k < n - 1; k++)
+  {
+    g[k].gap = (unsigned int)t[k+1].infm - (unsigned int)t[k].supr;
+    g[k].k = k;
+    join[k] = 0;
+  }
+  qsort(g, n - 1, sizeof(MultiGap), cmp_gap);
+  for (k = 0; k < n - cap; k++)
+  {
+    join[g[k].k] = 1;
+  }
+  m = 0;
+  for (k = 0; k < n; k++)
+  {
+    if (k > 0 && join[k-1])
+    {
+      t[m-1].supr = t[k].supr;
+    }
+    else
+    {
+      t[m++] = t[k];
+    }
+  }
+  free(join);
+  if (g != local)
+  {
+    free(g);
+  }
+  return (m);
+}
+
+/* multi_normalize:
+ * Sort the n intervals of t, drop the empty ones, coalesce the overlapping or
+ * adjacent ones and reduce them to at most cap members. Returns the new number
+ * of members.
+ */
+static int multi_normalize(Interval *t, int n, int cap)
+{
+  int k, m = 0;
+
+  for (k = 0; k < n; k++)
+  {
+    if (t[k].infm <= t[k].supr)
+    {
+      t[m++] = t[k];
+    }
+  }
+  n = m;
+  qsort(t, n, sizeof(Interval), cmp_infm);
+  m = 0;
+  for (k = 0; k < n; k++)
+  {
+    m = multi_push(t, m, t[k]);
+  }
+  return (multi_cap(t, m, cap));
+}
+
+/* multi_store:
+ * Set the members of z to the n (at most z->cap) members of t.
+ */
+static void multi_store(IntervalMulti *z, const Interval *t, int n)
+{
+  if (n > INTERVAL_MULTI_INLINE)
+  {
+    if (z->alloc < n)
+    {
+      z->alloc = z->cap;
+      z->heap = multi_alloc(z->heap, z->alloc * sizeof(Interval));
+    }
+    memcpy(z->heap, t, n * sizeof(Interval));
+  }
+  else
+  {
+    memcpy(z->buf, t, n * sizeof(Interval));
+  }
+  z->n = n;
+}
+
+/* multi_union:
+ * Merge the xn members of xm and the yn members of ym into t. Returns the
+ * number of members of t.
+ */
+static int multi_union(Interval *t, const Interval *xm, int xn,
+  const Interval *ym, int yn)
+{
+  int i = 0, j = 0, m = 0;
+
+  while (i < xn || j < yn)
+  {
+    if (j >= yn || (i < xn && xm[i].infm <= ym[j].infm))
+    {
+      m = multi_push(t, m, xm[i++]);
+    }
+    else
+    {
+      m = multi_push(t, m, ym[j++]);
+    }
+  }
+  return (m);
+}
+
+/* IntervalMultiInit:
+ * Initialize s to the empty set, keeping at most cap members
+ * (INTERVAL_MULTI_CAP for cap <= 0, at most INTERVAL_MULTI_MAX_CAP).
+ */
+void IntervalMultiInit(IntervalMulti *s, int cap)
+{
+  if (cap <= 0)
+  {
+    cap = INTERVAL_MULTI_CAP;
+  }
+  s->cap = MIN(cap, INTERVAL_MULTI_MAX_CAP);
+  s->n = 0;
+  s->alloc = 0;
+  s->heap = NULL;
+}
+
+/* IntervalMultiFree:
+ * Free the memory of s, leaving it empty.
+ */
+void IntervalMultiFree(IntervalMulti *s)
+{
+  free(s->heap);
+  s->heap = NULL;
+  s->alloc = 0;
+  s->n = 0;
+}
+
+/* IntervalMultiCopy:
+ * Set z to x, merging members if x has more than z->cap.
+ */
+void IntervalMultiCopy(IntervalMulti *z, const IntervalMulti *x)
+{
+  Interval t[INTERVAL_MULTI_MAX_CAP];
+  int n = x->n;
+
+  if (z == x)
+  {
+    return;
+  }
+  memcpy(t, MULTI_MEMBERS(x), n * sizeof(Interval));
+  n = multi_cap(t, n, z->cap);
+  multi_store(z, t, n);
+}
+
+/* IntervalMultiFromInterval:
+ * Set z to the single interval x (or to the empty set if x is empty).
+ */
+void IntervalMultiFromInterval(IntervalMulti *z, Interval x)
+{
+  multi_store(z, &x, (x.infm <= x.supr) ? 1 : 0);
+}
+
+/* IntervalMultiInsert:
+ * Add interval x to s.
+ */
+void IntervalMultiInsert(IntervalMulti *s, Interval x)
+{
+  Interval t[INTERVAL_MULTI_MAX_CAP + 1];
+  int n;
+
+  if (x.infm > x.supr)
+  {
+    return;
+  }
+  n = multi_union(t, MULTI_MEMBERS(s), s->n, &x, 1);
+  n = multi_cap(t, n, s->cap);
+  multi_store(s, t, n);
+}
+
+/* IntervalMultiCount:
+ * Return the number of members of s.
+ */
+int IntervalMultiCount(const IntervalMulti *s)
+{
+  return (s->n);
+}
+
+/* IntervalMultiGet:
+ * Return member k of s (in increasing order).
+ */
+Interval IntervalMultiGet(const IntervalMulti *s, int k)
+{
+  return (MULTI_MEMBERS(s)[k]);
+}
+
+/* IntervalMultiHull:
+ * Return the smallest interval containing s.
+ */
+Interval IntervalMultiHull(const IntervalMulti *s)
+{
+  const Interval *m = MULTI_MEMBERS(s);
+
+  if (s->n == 0)
+  {
+    return (IntervalEmpty());
+  }
+  return (INTERVAL(m[0].infm, m[s->n - 1].supr));
+}
+
+/* IntervalMultiIsEmpty:
+ * Check if s is the empty set.
+ */
+int IntervalMultiIsEmpty(const IntervalMulti *s)
+{
+  return (s->n == 0);
+}
+
+/* ValueIsInIntervalMulti:
+ * Check if value v is a member of s, by binary search.
+ */
+int ValueIsInIntervalMulti(const IntervalMulti *s, int v)
+{
+  const Interval *m = MULTI_MEMBERS(s);
+  int lo = 0, hi = s->n, mid;
+
+  // Find the first member whose supremum is not below v.
+  while (lo < hi)
+  {
+    mid = (lo + hi) / 2;
+    if (m[mid].supr < v)
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+  return (lo < s->n && m[lo].infm <= v);
+}
+
+/* IntervalMultiUnion:
+ * Set z to the union of x and y, by merging their members.
+ */
+void IntervalMultiUnion(IntervalMulti *z, const IntervalMulti *x,
+       const IntervalMulti *y)
+{
+  Interval t[2 * INTERVAL_MULTI_MAX_CAP];
+  int n;
+
+  n = multi_union(t, MULTI_MEMBERS(x), x->n, MULTI_MEMBERS(y), y->n);
+  n = multi_cap(t, n, z->cap);
+  multi_store(z, t, n);
+}
+
+/* IntervalMultiIntersection:
+ * Set z to the intersection of x and y, by merging their members.
+ */
+void IntervalMultiIntersection(IntervalMulti *z, const IntervalMulti *x,
+       const IntervalMulti *y)
+{
+  Interval t[2 * INTERVAL_MULTI_MAX_CAP];
+  const Interval *xm = MULTI_MEMBERS(x), *ym = MULTI_MEMBERS(y);
+  int i = 0, j = 0, n = 0, lo, hi;
+
+  while (i < x->n && j < y->n)
+  {
+    lo = MAX(xm[i].infm, ym[j].infm);
+    hi = MIN(xm[i].supr, ym[j].supr);
+    if (lo <= hi)
+    {
+      t[n++] = INTERVAL(lo, hi);
+    }
+    if (xm[i].supr < ym[j].supr)
+    {
+      i++;
+    }
+    else
+    {
+      j++;
+    }
+  }
+  n = multi_cap(t, n, z->cap);
+  multi_store(z, t, n);
+}
+
+/* IntervalMultiEval:
+ * Set z to the result of operation op (see IntervalBatchEval) on x and y (y is
+ * ignored for unary operations and may then be NULL). MUX and UNION compute
+ * the union, INTERSECTION the intersection of the sets. Other operations are
+ * applied to every pair of members of x and y in a single batch call, and z
+ * is the union of the results. Pairs for which the operation fails are left
+ * out of z; their IntervalStatus flags are OR-ed into the return value. An
+ * empty operand gives the empty set and INTERVAL_ERR_EMPTY.
+ */
+int IntervalMultiEval(IntervalOpcode op, IntervalMulti *z,
+      const IntervalMulti *x, const IntervalMulti *y,
+      ArithType xtyp, ArithType ytyp)
+{
+  int local[4 * MULTI_LOCAL], *w;
+  Interval tlocal[MULTI_LOCAL], *t;
+  const Interval *xm, *ym;
+  int arity = IntervalOpcodeArity(op);
+  int i, j, k, xn, yn, np, status;
+
+  if (arity == 0 || (arity == 2 && y == NULL))
+  {
+    z->n = 0;
+    return (INTERVAL_ERR_INVALID);
+  }
+  if (op == INTERVAL_OP_MUX || op == INTERVAL_OP_UNION)
+  {
+    IntervalMultiUnion(z, x, y);
+    return (INTERVAL_OK);
+  }
+  if (op == INTERVAL_OP_INTERSECTION)
+  {
+    IntervalMultiIntersection(z, x, y);
+    return (INTERVAL_OK);
+  }
+  xn = x->n;
+  yn = (arity == 2) ? y->n : 1;
+  if (xn == 0 || yn == 0)
+  {
+    z->n = 0;
+    return (INTERVAL_ERR_EMPTY);
+  }
+
+  // Gather all pairs of members as structure-of-arrays; the results overwrite
+  // the x operands.
+  np = xn * yn;
+  w = (np <= MULTI_LOCAL) ? local : multi_alloc(NULL, 4 * np * sizeof(int));
+  t = (np <= MULTI_LOCAL) ? tlocal : multi_alloc(NULL, np * sizeof(Interval));
+  xm = MULTI_MEMBERS(x);
+  ym = (arity == 2) ? MULTI_MEMBERS(y) : NULL;
+  for (i = 0, k = 0; i < xn; i++)
+  {
+    for (j = 0; j < yn; j++, k++)
+    {
+      w[k] = xm[i].infm;
+      w[np + k] = xm[i].supr;
+      if (ym != NULL)
+      {
+        w[2 * np + k] = ym[j].infm;
+        w[3 * np + k] = ym[j].supr;
+      }
+    }
+  }
+  status = IntervalBatchEvalChecked(op, np, w, w + np,
+             (ym != NULL) ? w + 2 * np : NULL, (ym != NULL) ? w + 3 * np : NULL,
+             w, w + np, xtyp, ytyp, NULL);
+  // The NEG kernels follow IntervalNeg, which swaps the bounds.
+  for (k = 0; k < np; k++)
+  {
+    t[k] = (op == INTERVAL_OP_NEG) ? INTERVAL(w[np + k], w[k]) : 
+                                     INTERVAL(w[k], w[np + k]);
+  }
+  multi_store(z, t, multi_normalize(t, np, z->cap));
+  if (w != local)
+  {
+    free(w);
+    free(t);
+  }
+
+  return (status);
+}
+
+/* IntervalMultiPrint:
+ * Print the members of s to outfile, as in {[0,3],[8,9]}.
+ */
+void IntervalMultiPrint(FILE *outfile, const IntervalMulti *s)
+{
+  int k;
+
+  fprintf(outfile, "{");
+  for (k = 0; k < s->n; k++)
+  {
+    if (k > 0)
+    {
+      fprintf(outfile, ",");
+    }
+    IntervalPrint(outfile, MULTI_MEMBERS(s)[k]);
+  }
+  fprintf(outfile, "}");
+}
@@ -0,0 +1,71 @@
+/*
+ * Filename: interval-multi.h
+ * Purpose : Multi-interval (disjoint interval set) type.
+ *           Definitions and function prototypes.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.1 (26/10/16)
+ *           Added extern "C" guards for C++.
+ *           0.3.0 (26/10/16)
+ *           Initial version.
+ */
+#ifndef INTERVAL_MULTI_H
+#define INTERVAL_MULTI_H
+
+#include <stdio.h>
+#include "interval.h"
+#include "interval-batch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of members stored inline, without heap allocation. */
+#define INTERVAL_MULTI_INLINE   4
+
+/* Default and maximum number of members of a multi-interval. */
+#define INTERVAL_MULTI_CAP      8
+#define INTERVAL_MULTI_MAX_CAP  256
+
+/* IntervalMulti is a set of integers stored as a sorted array of disjoint,
+ * non-adjacent, non-empty member intervals. Up to INTERVAL_MULTI_INLINE
+ * members are kept in buf, more in heap. When an operation produces more
+ * than cap members, the members separated by the smallest gaps are merged;
+ * a cap of 1 thus reduces to the hull, as with IntervalUnion.
+ * Multi-intervals must be initialized with IntervalMultiInit and copied with
+ * IntervalMultiCopy, not by assignment.
+ */
+typedef struct {
+  int n;                                /* Number of members */
+  int cap;                              /* Maximum number of members */
+  int alloc;                            /* Number of entries of heap */
+  Interval *heap;                       /* Members, if n > INTERVAL_MULTI_INLINE */
+  Interval buf[INTERVAL_MULTI_INLINE];  /* Members, if n <= INTERVAL_MULTI_INLINE */
+} IntervalMulti;
+
+/* Interval multi API. */
+void IntervalMultiInit(IntervalMulti *s, int cap);
+void IntervalMultiFree(IntervalMulti *s);
+void IntervalMultiCopy(IntervalMulti *z, const IntervalMulti *x);
+void IntervalMultiFromInterval(IntervalMulti *z, Interval x);
+void IntervalMultiInsert(IntervalMulti *s, Interval x);
+int IntervalMultiCount(const IntervalMulti *s);
+Interval IntervalMultiGet(const IntervalMulti *s, int k);
+Interval IntervalMultiHull(const IntervalMulti *s);
+int IntervalMultiIsEmpty(const IntervalMulti *s);
+int ValueIsInIntervalMulti(const IntervalMulti *s, int v);
+void IntervalMultiUnion(IntervalMulti *z, const IntervalMulti *x,
+       const IntervalMulti *y);
+void IntervalMultiIntersection(IntervalMulti *z, const IntervalMulti *x,
+       const IntervalMulti *y);
+int IntervalMultiEval(IntervalOpcode op, IntervalMulti *z,
+      const IntervalMulti *x, const IntervalMulti *y,
+      ArithType xtyp, ArithType ytyp);
+void IntervalMultiPrint(FILE *outfile, const IntervalMulti *s);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INTERVAL_MULTI_H */
@@ -0,0 +1,342 @@
+/*
+ * Filename: interval-parallel.c
+ * Purpose : Implementation of the multi-threaded DAG evaluator. Each
+ *           topological level of the DAG is split into tasks (chunks of at
+ *           most chunk slots of the same group), which are dealt to the
+ *           per-worker deques; workers pop tasks from their own deque and
+ *           steal from the others when it runs empty. Levels are separated
+ *           by a barrier. Since every task writes a disjoint range of slots
+ *           and reads only results of earlier levels, the results do not
+ *           depend on the number of threads or the order of execution.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.0 (26/10/16)
+ *           Initial version.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "interval.h"
+#include "interval-batch.h"
+#include "interval-dag.h"
+#include "interval-parallel.h"
+
+/* PoolTask is a range of slots [s0,s1) of the same group. */
+typedef struct {
+  int s0, s1;
+} PoolTask;
+
+/* PoolDeque is the task deque of a worker: the owner pops from the bottom,
+ * thieves steal from the top.
+ */
+typedef struct {
+  pthread_mutex_t lock;
+  PoolTask *task;
+  int top, bottom, cap;
+} PoolDeque;
+
+/* PoolWorker is the argument of a worker thread. */
+typedef struct {
+  IntervalPool *pool;
+  int id;
+} PoolWorker;
+
+struct IntervalPool {
+  int nthreads;               /* Number of workers, including the caller */
+  int chunk;                  /* Maximum number of slots per task */
+  pthread_t *threads;         /* Worker threads 1 to nthreads-1 */
+  PoolWorker *workers;        /* Arguments of the worker threads */
+  PoolDeque *deque;           /* Task deque of each worker */
+  pthread_mutex_t lock;       /* Protects the fields below */
+  pthread_cond_t start;       /* Signalled when a level is ready */
+  pthread_cond_t done;        /* Signalled when the last worker finishes */
+  unsigned long generation;   /* Number of levels started */
+  int active;                 /* Worker threads still running the level */
+  int shutdown;               /* Whether the workers must exit */
+  int status;                 /* OR of the status flags of the level */
+  IntervalDag *g;             /* DAG being evaluated */
+};
+
+/* pool_alloc:
+ * Reallocate p to size bytes (p may be NULL); abort when out of memory.
+ */
+static void *pool_alloc(void *p, size_t size)
+{
+  p = realloc(p, (size > 0) ? size : 1);
+  if (p == NULL)
+  {
+    fprintf(stderr, "Error: Out of memory in interval thread pool.\n");
+    exit(1);
+  }
+  return (p);
+}
+
+/* pool_push:
+ * Push task [s0,s1) at the bottom of deque d. Only called while the workers
+ * are idle.
+ */
+static void pool_push(PoolDeque *d, int s0, int s1)
+{
+  if (d->bottom == d->cap)
+  {
+    d->cap = MAX(2 * d->cap, 64);
+    d->task = pool_alloc(d->task, d->cap * sizeof(PoolTask));
+  }
+  d->task[d->bottom].s0 = s0;
+  d->task[d->bottom].s1 = s1;
+  d->bottom++;
+}
+
+/* pool_take:
+ * Take a task from deque d: from the bottom if owner is set, else from the
+ * top. Returns 0 if the deque is empty.
+ */
+static int pool_take(PoolDeque *d, int owner, PoolTask *t)
+{
+  int found = 0;
+
+  pthread_mutex_lock(&d->lock);
+  if (d->top < d->bottom)
+  {
+    *t = owner ? d->task[--d->bottom] : d->task[d->top++];
+    found = 1;
+  }
+  pthread_mutex_unlock(&d->lock);
+  return (found);
+}
+
+/* pool_next:
+ * Get the next task of worker id: from the bottom of its own deque or, if that
+ * is empty, stolen from the top of another one. Returns 0 if all deques are
+ * empty.
+ */
+static int pool_next(IntervalPool *p, int id, PoolTask *t)
+{
+  int k;
+
+  if (pool_take(&p->deque[id], 1, t))
+  {
+    return (1);
+  }
+  for (k = 1; k < p->nthreads; k++)
+  {
+    if (pool_take(&p->deque[(id + k) % p->nthreads], 0, t))
+    {
+      return (1);
+    }
+  }
+  return (0);
+}
+
+/* pool_run:
+ * Run tasks as worker id until all deques are empty. Returns the OR of the
+ * status flags of the tasks run.
+ */
+static int pool_run(IntervalPool *p, int id)
+{
+  PoolTask t;
+  int status = INTERVAL_OK;
+
+  while (pool_next(p, id, &t))
+  {
+    status |= IntervalDagEvalSlots(p->g, t.s0, t.s1);
+  }
+  return (status);
+}
+
+/* pool_worker:
+ * Main loop of worker threads: wait for a level, run tasks, report.
+ */
+static void *pool_worker(void *arg)
+{
+  PoolWorker *w = (PoolWorker *)arg;
+  IntervalPool *p = w->pool;
+  unsigned long seen = 0;
+  int status;
+
+  pthread_mutex_lock(&p->lock);
+  for (;;)
+  {
+    while (p->generation == seen && !p->shutdown)
+    {
+      pthread_cond_wait(&p->start, &p->lock);
+    }
+    if (p->shutdown)
+    {
+      break;
+    }
+    seen = p->generation;
+    pthread_mutex_unlock(&p->lock);
+    status = pool_run(p, w->id);
+    pthread_mutex_lock(&p->lock);
+    p->status |= status;
+    if (--p->active == 0)
+    {
+      pthread_cond_signal(&p->done);
+    }
+  }
+  pthread_mutex_unlock(&p->lock);
+  return (NULL);
+}
+
+/* IntervalPoolCreate:
+ * Create a pool of nthreads workers (the calling thread being one of them);
+ * for nthreads <= 0, one per online processor. Tasks consist of at most chunk
+ * DAG slots (INTERVAL_POOL_CHUNK for chunk <= 0).
+ */
+IntervalPool *IntervalPoolCreate(int nthreads, int chunk)
+{
+  IntervalPool *p = pool_alloc(NULL, sizeof(IntervalPool));
+  int k;
+
+  if (nthreads <= 0)
+  {
+    nthreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    nthreads = MAX(nthreads, 1);
+  }
+  memset(p, 0, sizeof(IntervalPool));
+  p->nthreads = nthreads;
+  p->chunk = (chunk > 0) ? chunk : INTERVAL_POOL_CHUNK;
+  p->threads = pool_alloc(NULL, nthreads * sizeof(pthread_t));
+  p->workers = pool_alloc(NULL, nthreads * sizeof(PoolWorker));
+  p->deque = pool_alloc(NULL, nthreads * sizeof(PoolDeque));
+  memset(p->deque, 0, nthreads * sizeof(PoolDeque));
+  pthread_mutex_init(&p->lock, NULL);
+  pthread_cond_init(&p->start, NULL);
+  pthread_cond_init(&p->done, NULL);
+  // Select the batch instruction set before any worker uses it.
+  IntervalBatchGetIsa();
+  for (k = 0; k < nthreads; k++)
+  {
+    pthread_mutex_init(&p->deque[k].lock, NULL);
+    p->workers[k].pool = p;
+    p->workers[k].id = k;
+  }
+  for (k = 1; k < nthreads; k++)
+  {
+    if (pthread_create(&p->threads[k], NULL, pool_worker, &p->workers[k]) != 0)
+    {
+      fprintf(stderr, "Error: Unable to create worker thread.\n");
+      exit(1);
+    }
+  }
+
+  return (p);
+}
+
+/* IntervalPoolDestroy:
+ * Stop the workers of pool p and free all of its memory.
+ */
+void IntervalPoolDestroy(IntervalPool *p)
+{
+  int k;
+
+  if (p == NULL)
+  {
+    return;
+  }
+  pthread_mutex_lock(&p->lock);
+  p->shutdown = 1;
+  pthread_cond_broadcast(&p->start);
+  pthread_mutex_unlock(&p->lock);
+  for (k = 1; k < p->nthreads; k++)
+  {
+    pthread_join(p->threads[k], NULL);
+  }
+  for (k = 0; k < p->nthreads; k++)
+  {
+    pthread_mutex_destroy(&p->deque[k].lock);
+    free(p->deque[k].task);
+  }
+  pthread_mutex_destroy(&p->lock);
+  pthread_cond_destroy(&p->start);
+  pthread_cond_destroy(&p->done);
+  free(p->threads);
+  free(p->workers);
+  free(p->deque);
+  free(p);
+}
+
+/* IntervalPoolThreads:
+ * Return the number of workers of pool p.
+ */
+int IntervalPoolThreads(const IntervalPool *p)
+{
+  return (p->nthreads);
+}
+
+/* IntervalDagEvalParallel:
+ * Parallel version of IntervalDagEval using the workers of pool p. Every
+ * level is split into tasks of at most chunk slots of the same group; the
+ * tasks are dealt to the workers in contiguous runs, so that neighbouring
+ * slots are evaluated by the same worker unless stolen. Levels of fewer than
+ * two chunks are evaluated by the calling thread alone. The results are the
+ * same as those of IntervalDagEval, for any number of threads.
+ */
+int IntervalDagEvalParallel(IntervalDag *g, IntervalPool *p)
+{
+  int l, k, s, ntasks, t, w, status = INTERVAL_OK;
+  int first, last, s1;
+
+  IntervalDagPrepare(g);
+  p->g = g;
+  for (l = 0; l < g->nlevels; l++)
+  {
+    first = g->level_group[l];
+    last = g->level_group[l + 1];
+    if (p->nthreads == 1 ||
+        g->group_start[last] - g->group_start[first] < 2 * p->chunk)
+    {
+      for (k = first; k < last; k++)
+      {
+        status |= IntervalDagEvalSlots(g, g->group_start[k], g->group_start[k+1]);
+      }
+      continue;
+    }
+
+    // Count the tasks, then deal them in contiguous runs.
+    ntasks = 0;
+    for (k = first; k < last; k++)
+    {
+      ntasks += (g->group_start[k+1] - g->group_start[k] + p->chunk - 1) / p->chunk;
+    }
+    for (w = 0; w < p->nthreads; w++)
+    {
+      p->deque[w].top = p->deque[w].bottom = 0;
+    }
+    t = 0;
+    for (k = first; k < last; k++)
+    {
+      for (s = g->group_start[k]; s < g->group_start[k+1]; s = s1)
+      {
+        s1 = MIN(s + p->chunk, g->group_start[k+1]);
+        w = (int)(((long)t * p->nthreads) / ntasks);
+        pool_push(&p->deque[w], s, s1);
+        t++;
+      }
+    }
+
+    pthread_mutex_lock(&p->lock);
+    p->status = INTERVAL_OK;
+    p->active = p->nthreads - 1;
+    p->generation++;
+    pthread_cond_broadcast(&p->start);
+    pthread_mutex_unlock(&p->lock);
+    status |= pool_run(p, 0);
+    pthread_mutex_lock(&p->lock);
+    while (p->active > 0)
+    {
+      pthread_cond_wait(&p->done, &p->lock);
+    }
+    status |= p->status;
+    pthread_mutex_unlock(&p->lock);
+  }
+  p->g = NULL;
+  g->evaluated = 1;
+
+  return (status);
+}
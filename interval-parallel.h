@@ -0,0 +1,42 @@
+/*
+ * Filename: interval-parallel.h
+ * Purpose : Multi-threaded evaluation of interval expression DAGs with a
+ *           work-stealing thread pool. Definitions and function prototypes.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.1 (26/10/16)
+ *           Added extern "C" guards for C++.
+ *           0.3.0 (26/10/16)
+ *           Initial version.
+ */
+#ifndef INTERVAL_PARALLEL_H
+#define INTERVAL_PARALLEL_H
+
+#include <stdio.h>
+#include "interval.h"
+#include "interval-dag.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Default number of DAG slots per task. */
+#define INTERVAL_POOL_CHUNK  512
+
+/* IntervalPool is a pool of worker threads, each with its own task deque;
+ * idle workers steal tasks from the deques of the others.
+ */
+typedef struct IntervalPool IntervalPool;
+
+/* Interval parallel evaluation API. */
+IntervalPool *IntervalPoolCreate(int nthreads, int chunk);
+void IntervalPoolDestroy(IntervalPool *p);
+int IntervalPoolThreads(const IntervalPool *p);
+int IntervalDagEvalParallel(IntervalDag *g, IntervalPool *p);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INTERVAL_PARALLEL_H */
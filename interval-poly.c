@@ -0,0 +1,367 @@
+/*
+ * Filename: interval-poly.c
+ * Purpose : Implementation of the polynomial range evaluation. The
+ *           polynomial is evaluated in Horner form with one interval
+ *           multiplication and addition per coefficient, on 64-bit
+ *           intermediates, so that overflow is detected exactly. With the
+ *           monotonic split, the range of the derivative is computed the same
+ *           way: where it does not contain zero the polynomial is monotonic
+ *           and its exact range is given by the values at the bounds;
+ *           elsewhere x is halved, up to a number of segments. Batches are
+ *           evaluated with an AVX2 kernel when the host processor supports
+ *           it.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.0 (26/10/16)
+ *           Initial version.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include "interval.h"
+#include "interval-batch.h"
+#include "interval-poly.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define INTERVAL_POLY_X86
+#include <immintrin.h>
+#endif
+
+/* Whether a 64-bit intermediate fits in an int. */
+#define POLY_FITS(v)  ((v) >= INT_MIN && (v) <= INT_MAX)
+
+/* poly_coefs:
+ * Widen the coefficients of the polynomial into c and store the
+ * coefficients of its derivative in d.
+ */
+static void poly_coefs(const int *coef, int degree, long long *c, long long *d)
+{
+  int k;
+
+  for (k = 0; k <= degree; k++)
+  {
+    c[k] = coef[k];
+  }
+  for (k = 0; k < degree; k++)
+  {
+    d[k] = (k + 1) * c[k + 1];
+  }
+}
+
+/* poly_horner:
+ * Store in [lo,hi] the range of the polynomial c of degree n over [a,b],
+ * evaluated in Horner form; [a,a] gives the exact value at a. Returns
+ * INTERVAL_ERR_OVERFLOW if a bound of an intermediate result does not fit in
+ * an int.
+ */
+static int poly_horner(const long long *c, int n, long long a, long long b,
+  long long *lo, long long *hi)
+{
+  long long l = c[n], h = c[n], p1, p2, p3, p4;
+  int k;
+
+  *lo = *hi = 0;
+  if (!POLY_FITS(l))
+  {
+    return (INTERVAL_ERR_OVERFLOW);
+  }
+  for (k = n - 1; k >= 0; k--)
+  {
+    p1 = l * a;
+    p2 = l * b;
+    p3 = h * a;
+    p4 = h * b;
+    l = MIN(MIN(p1, p2), MIN(p3, p4)) + c[k];
+    h = MAX(MAX(p1, p2), MAX(p3, p4)) + c[k];
+    if (!POLY_FITS(l) || !POLY_FITS(h))
+    {
+      return (INTERVAL_ERR_OVERFLOW);
+    }
+  }
+  *lo = l;
+  *hi = h;
+  return (INTERVAL_OK);
+}
+
+/* poly_split:
+ * Store in [lo,hi] the range of the polynomial c of degree n (with the
+ * derivative d) over [a,b], examining at most segments sub-intervals. A
+ * sub-interval over which the derivative has a constant sign gets the exact
+ * range, from the values at its bounds; if the segments are used up, it
+ * gets the Horner range. Returns the OR of the status flags.
+ */
+static int poly_split(const long long *c, const long long *d, int n,
+  long long a, long long b, int segments, long long *lo, long long *hi)
+{
+  long long u, v, w;
+  int status;
+
+  if (a == b || segments <= 0)
+  {
+    return (poly_horner(c, n, a, b, lo, hi));
+  }
+  if (n == 0 || (poly_horner(d, n - 1, a, b, &u, &v) == INTERVAL_OK &&
+                 (u >= 0 || v <= 0)))
+  {
+    status = poly_horner(c, n, a, a, &u, &w) | poly_horner(c, n, b, b, &v, &w);
+    *lo = MIN(u, v);
+    *hi = MAX(u, v);
+    return (status);
+  }
+  if (segments == 1)
+  {
+    return (poly_horner(c, n, a, b, lo, hi));
+  }
+  w = a + (b - a) / 2;
+  status = poly_split(c, d, n, a, w, segments / 2, lo, hi) |
+           poly_split(c, d, n, w + 1, b, segments - segments / 2, &u, &v);
+  *lo = MIN(*lo, u);
+  *hi = MAX(*hi, v);
+  return (status);
+}
+
+#ifdef INTERVAL_POLY_X86
+/* min_avx2, max_avx2:
+ * Minimum and maximum of 4 lanes of 64 bits.
+ */
+__attribute__((target("avx2")))
+static inline __m256i min_avx2(__m256i a, __m256i b)
+{
+  return (_mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b)));
+}
+
+__attribute__((target("avx2")))
+static inline __m256i max_avx2(__m256i a, __m256i b)
+{
+  return (_mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b)));
+}
+
+/* horner_avx2:
+ * poly_horner on 4 lanes of 64 bits holding int values; the lanes where a
+ * bound of an intermediate result does not fit in an int are set in *ovf.
+ * The products take the low 32 bits of each lane, which hold the whole
+ * value until a lane overflows.
+ */
+__attribute__((target("avx2")))
+static inline void horner_avx2(const long long *c, int n, __m256i a, __m256i b,
+  __m256i *lo, __m256i *hi, __m256i *ovf)
+{
+  __m256i imax = _mm256_set1_epi64x(INT_MAX), imin = _mm256_set1_epi64x(INT_MIN);
+  __m256i l, h, p1, p2, p3, p4, ck, o = _mm256_setzero_si256();
+  int k;
+
+  l = h = _mm256_set1_epi64x(c[n]);
+  for (k = n - 1; k >= 0; k--)
+  {
+    ck = _mm256_set1_epi64x(c[k]);
+    p1 = _mm256_mul_epi32(l, a);
+    p2 = _mm256_mul_epi32(l, b);
+    p3 = _mm256_mul_epi32(h, a);
+    p4 = _mm256_mul_epi32(h, b);
+    l = _mm256_add_epi64(min_avx2(min_avx2(p1, p2), min_avx2(p3, p4)), ck);
+    h = _mm256_add_epi64(max_avx2(max_avx2(p1, p2), max_avx2(p3, p4)), ck);
+    o = _mm256_or_si256(o, _mm256_or_si256(_mm256_cmpgt_epi64(imin, l),
+                                           _mm256_cmpgt_epi64(h, imax)));
+  }
+  *lo = l;
+  *hi = h;
+  *ovf = o;
+}
+
+/* value_avx2:
+ * Value of the polynomial c of degree n at a, on 4 lanes of 64 bits, with
+ * the overflowing lanes set in *ovf.
+ */
+__attribute__((target("avx2")))
+static inline __m256i value_avx2(const long long *c, int n, __m256i a,
+  __m256i *ovf)
+{
+  __m256i imax = _mm256_set1_epi64x(INT_MAX), imin = _mm256_set1_epi64x(INT_MIN);
+  __m256i v = _mm256_set1_epi64x(c[n]), o = _mm256_setzero_si256();
+  int k;
+
+  for (k = n - 1; k >= 0; k--)
+  {
+    v = _mm256_add_epi64(_mm256_mul_epi32(v, a), _mm256_set1_epi64x(c[k]));
+    o = _mm256_or_si256(o, _mm256_or_si256(_mm256_cmpgt_epi64(imin, v),
+                                           _mm256_cmpgt_epi64(v, imax)));
+  }
+  *ovf = o;
+  return (v);
+}
+
+/* poly_avx2:
+ * Evaluate the leading multiple-of-8 part of a batch using AVX2, as two
+ * halves of 4 lanes of 64 bits. If d is NULL, the Horner range is computed;
+ * otherwise, only where the derivative d has a constant sign, from the
+ * values at the bounds. Returns the number of elements processed, stopping
+ * before the first group of 8 holding an overflow or (with d) a lane that
+ * is not monotonic, which is left to the scalar code.
+ */
+__attribute__((target("avx2")))
+static int poly_avx2(int n, const int *xinfm, const int *xsupr,
+  const long long *c, const long long *d, int degree, int *zinfm, int *zsupr)
+{
+  __m256i idx = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+  __m256i z = _mm256_setzero_si256();
+  __m256i xi, xs, a, b, u, v, w, lo[2], hi[2], o[2], emp;
+  int i, h;
+
+  for (i = 0; i + 8 <= n; i += 8)
+  {
+    xi = _mm256_loadu_si256((const __m256i *)(xinfm + i));
+    xs = _mm256_loadu_si256((const __m256i *)(xsupr + i));
+    emp = _mm256_cmpgt_epi32(xi, xs);
+    for (h = 0; h < 2; h++)
+    {
+      a = _mm256_cvtepi32_epi64((h == 0) ? _mm256_castsi256_si128(xi)
+                                         : _mm256_extracti128_si256(xi, 1));
+      b = _mm256_cvtepi32_epi64((h == 0) ? _mm256_castsi256_si128(xs)
+                                         : _mm256_extracti128_si256(xs, 1));
+      if (d == NULL)
+      {
+        horner_avx2(c, degree, a, b, &lo[h], &hi[h], &o[h]);
+      }
+      else
+      {
+        // Not monotonic: the derivative overflows or takes both signs
+        horner_avx2(d, degree - 1, a, b, &u, &v, &w);
+        o[h] = _mm256_or_si256(w, _mm256_and_si256(_mm256_cmpgt_epi64(z, u),
+                                                   _mm256_cmpgt_epi64(v, z)));
+        u = value_avx2(c, degree, a, &w);
+        o[h] = _mm256_or_si256(o[h], w);
+        v = value_avx2(c, degree, b, &w);
+        o[h] = _mm256_or_si256(o[h], w);
+        lo[h] = min_avx2(u, v);
+        hi[h] = max_avx2(u, v);
+      }
+      // Narrow to the low 32 bits of each lane
+      lo[h] = _mm256_permutevar8x32_epi32(lo[h], idx);
+      hi[h] = _mm256_permutevar8x32_epi32(hi[h], idx);
+      o[h] = _mm256_permutevar8x32_epi32(o[h], idx);
+    }
+    u = _mm256_inserti128_si256(lo[0], _mm256_castsi256_si128(lo[1]), 1);
+    v = _mm256_inserti128_si256(hi[0], _mm256_castsi256_si128(hi[1]), 1);
+    w = _mm256_inserti128_si256(o[0], _mm256_castsi256_si128(o[1]), 1);
+    if (_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_andnot_si256(emp, w))) != 0)
+    {
+      break;
+    }
+    u = _mm256_blendv_epi8(u, _mm256_set1_epi32(1), emp);
+    v = _mm256_andnot_si256(emp, v);
+    _mm256_storeu_si256((__m256i *)(zinfm + i), u);
+    _mm256_storeu_si256((__m256i *)(zsupr + i), v);
+  }
+
+  return (i);
+}
+#endif /* INTERVAL_POLY_X86 */
+
+/* IntervalPolyChecked:
+ * Non-aborting version of IntervalPoly. The interval is returned in z;
+ * INTERVAL_OK, INTERVAL_ERR_INVALID (coef is NULL or degree is outside
+ * [0,INTERVAL_POLY_MAX_DEGREE]) or INTERVAL_ERR_OVERFLOW is returned. An
+ * empty x gives the empty interval.
+ */
+int IntervalPolyChecked(Interval *z, Interval x, const int *coef, int degree,
+      int segments)
+{
+  long long c[INTERVAL_POLY_MAX_DEGREE + 1], d[INTERVAL_POLY_MAX_DEGREE];
+  long long lo, hi;
+
+  *z = IntervalEmpty();
+  if (coef == NULL || degree < 0 || degree > INTERVAL_POLY_MAX_DEGREE)
+  {
+    return (INTERVAL_ERR_INVALID);
+  }
+  if (IntervalIsEmpty(x))
+  {
+    return (INTERVAL_OK);
+  }
+  poly_coefs(coef, degree, c, d);
+  if (poly_split(c, d, degree, x.infm, x.supr, segments, &lo, &hi) != INTERVAL_OK)
+  {
+    return (INTERVAL_ERR_OVERFLOW);
+  }
+  *z = INTERVAL((int)lo, (int)hi);
+  return (INTERVAL_OK);
+}
+
+/* IntervalPoly:
+ * Return the interval of the result of z = coef[degree] * x**degree + ... +
+ * coef[1] * x + coef[0], evaluated in Horner form, which keeps the
+ * correlation between the terms that a sum of separate powers loses. With
+ * segments > 0, the sub-intervals of x (at most segments) over which the
+ * polynomial is monotonic get their exact range.
+ */
+Interval IntervalPoly(Interval x, const int *coef, int degree, int segments)
+{
+  Interval z;
+  int status = IntervalPolyChecked(&z, x, coef, degree, segments);
+
+  if (status == INTERVAL_ERR_INVALID)
+  {
+    fprintf(stderr, "Error: Invalid polynomial in IntervalPoly.\n");
+    exit(1);
+  }
+  if (status != INTERVAL_OK)
+  {
+    fprintf(stderr, "Error: Result of IntervalPoly overflows the int range.\n");
+    exit(1);
+  }
+
+  return (z);
+}
+
+/* IntervalPolyBatch:
+ * Non-aborting batch version of IntervalPoly, evaluating the polynomial
+ * coef of the given degree over every interval [xinfm[i],xsupr[i]]. The
+ * status flags of the i-th element are OR-ed into err[i] (err may be NULL);
+ * elements in error receive the empty interval [1,0]. Returns the OR of the
+ * flags of all elements.
+ */
+int IntervalPolyBatch(int n, const int *xinfm, const int *xsupr,
+      const int *coef, int degree, int segments, int *zinfm, int *zsupr,
+      int *err)
+{
+  long long c[INTERVAL_POLY_MAX_DEGREE + 1], d[INTERVAL_POLY_MAX_DEGREE];
+  Interval z;
+  int i, j, f, mask = INTERVAL_OK, vec = 0;
+
+  // The vector kernel needs valid coefficients, and a derivative whose
+  // leading coefficient fits in an int
+  if (coef != NULL && degree >= 0 && degree <= INTERVAL_POLY_MAX_DEGREE)
+  {
+    poly_coefs(coef, degree, c, d);
+    vec = (segments <= 0 || degree == 0 || POLY_FITS(d[degree - 1]));
+  }
+  for (i = 0; i < n; i = j)
+  {
+#ifdef INTERVAL_POLY_X86
+    if (vec && IntervalBatchGetIsa() >= INTERVAL_ISA_AVX2)
+    {
+      i += poly_avx2(n - i, xinfm + i, xsupr + i, c,
+             (segments > 0 && degree > 0) ? d : NULL, degree, zinfm + i, zsupr + i);
+    }
+#else
+    (void)vec;
+#endif
+    // The group where the kernel stopped (or the tail) is evaluated here
+    for (j = MIN(i + 8, n); i < j; i++)
+    {
+      f = IntervalPolyChecked(&z, INTERVAL(xinfm[i], xsupr[i]), coef, degree,
+            segments);
+      zinfm[i] = z.infm;
+      zsupr[i] = z.supr;
+      if (err != NULL)
+      {
+        err[i] |= f;
+      }
+      mask |= f;
+    }
+  }
+
+  return (mask);
+}
@@ -0,0 +1,43 @@
+/*
+ * Filename: interval-poly.h
+ * Purpose : Range of polynomials over intervals, by Horner evaluation with
+ *           an optional split into monotonic segments. Definitions and
+ *           function prototypes.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.0 (26/10/16)
+ *           Initial version.
+ */
+#ifndef INTERVAL_POLY_H
+#define INTERVAL_POLY_H
+
+#include <stdio.h>
+#include "interval.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Maximum degree of a polynomial. */
+#define INTERVAL_POLY_MAX_DEGREE  32
+
+/* Suggested number of segments for the monotonic split. */
+#define INTERVAL_POLY_SEGMENTS    16
+
+/* Interval polynomial API. coef[k] is the coefficient of x**k, for k in
+ * [0,degree]. At most segments sub-intervals of x are examined for
+ * monotonicity; 0 gives the plain Horner evaluation.
+ */
+Interval IntervalPoly(Interval x, const int *coef, int degree, int segments);
+int IntervalPolyChecked(Interval *z, Interval x, const int *coef, int degree,
+      int segments);
+int IntervalPolyBatch(int n, const int *xinfm, const int *xsupr,
+      const int *coef, int degree, int segments, int *zinfm, int *zsupr,
+      int *err);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INTERVAL_POLY_H */
@@ -0,0 +1,260 @@
+/*
+ * Filename: interval-probe.c
+ * Purpose : Implementation of the runtime value-range profiler. Every thread
+ *           records into a private, cache-line aligned buffer of running
+ *           ranges, attached by its first probe and kept in a global list
+ *           after the thread exits, so that a probe costs three compares
+ *           (one for the generation of the buffer) and two stores to a line
+ *           no other thread writes. The buffers are merged into Intervals at
+ *           the end of a run.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.1 (26/10/16)
+ *           Replace the buffers freed by IntervalProbeShutdown in every
+ *           thread, by a generation count.
+ *           0.3.0 (26/10/16)
+ *           Initial version.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <pthread.h>
+#include "interval.h"
+#include "interval-probe.h"
+
+/* ProbeBuffer is the buffer of a thread, in the list of all buffers. */
+typedef struct ProbeBuffer {
+  struct ProbeBuffer *next;   /* Next buffer */
+  IntervalProbeSlot *slot;    /* Running ranges of the probes */
+} ProbeBuffer;
+
+__thread IntervalProbeSlot *interval_probe_tls = NULL;
+__thread unsigned int interval_probe_tls_gen = 0;
+unsigned int interval_probe_gen = 0;
+
+static pthread_mutex_t probe_lock = PTHREAD_MUTEX_INITIALIZER;
+static ProbeBuffer *probe_buffers = NULL;
+static int probe_n = 0;
+
+/* probe_clear:
+ * Set the n slots of s to no values.
+ */
+static void probe_clear(IntervalProbeSlot *s, int n)
+{
+  int k;
+
+  for (k = 0; k < n; k++)
+  {
+    s[k].infm = INT_MAX;
+    s[k].supr = INT_MIN;
+  }
+}
+
+/* IntervalProbeInit:
+ * Set up the profiler for nprobes probes, with ids 0 to nprobes-1. Returns
+ * INTERVAL_OK, or INTERVAL_ERR_INVALID if nprobes is not positive or the
+ * profiler is already set up.
+ */
+int IntervalProbeInit(int nprobes)
+{
+  int status = INTERVAL_OK;
+
+  pthread_mutex_lock(&probe_lock);
+  if (nprobes <= 0 || probe_n > 0)
+  {
+    status = INTERVAL_ERR_INVALID;
+  }
+  else
+  {
+    probe_n = nprobes;
+  }
+  pthread_mutex_unlock(&probe_lock);
+  return (status);
+}
+
+/* IntervalProbeShutdown:
+ * Free all thread buffers, so that the profiler may be set up again. Must
+ * not run concurrently with probes; threads that record probes afterwards
+ * (once the profiler is set up again) attach new buffers.
+ */
+void IntervalProbeShutdown(void)
+{
+  ProbeBuffer *b, *next;
+
+  pthread_mutex_lock(&probe_lock);
+  for (b = probe_buffers; b != NULL; b = next)
+  {
+    next = b->next;
+    free(b->slot);
+    free(b);
+  }
+  probe_buffers = NULL;
+  probe_n = 0;
+  interval_probe_gen++;
+  interval_probe_tls = NULL;
+  pthread_mutex_unlock(&probe_lock);
+}
+
+/* IntervalProbeCount:
+ * Return the number of probes (0 if the profiler is not set up).
+ */
+int IntervalProbeCount(void)
+{
+  int n;
+
+  pthread_mutex_lock(&probe_lock);
+  n = probe_n;
+  pthread_mutex_unlock(&probe_lock);
+  return (n);
+}
+
+/* IntervalProbeAttach:
+ * Allocate the buffer of the calling thread, called by its first probe and
+ * by its first probe after IntervalProbeShutdown. Aborts if the profiler is
+ * not set up or memory is exhausted.
+ */
+IntervalProbeSlot *IntervalProbeAttach(void)
+{
+  ProbeBuffer *b;
+  size_t size;
+  void *p = NULL;
+
+  if (interval_probe_tls != NULL && interval_probe_tls_gen == interval_probe_gen)
+  {
+    return (interval_probe_tls);
+  }
+  pthread_mutex_lock(&probe_lock);
+  if (probe_n == 0)
+  {
+    fprintf(stderr, "Error: Interval probe recorded before IntervalProbeInit.\n");
+    exit(1);
+  }
+  size = (probe_n * sizeof(IntervalProbeSlot) + INTERVAL_PROBE_LINE - 1) /
+         INTERVAL_PROBE_LINE * INTERVAL_PROBE_LINE;
+  b = malloc(sizeof(ProbeBuffer));
+  if (b == NULL || posix_memalign(&p, INTERVAL_PROBE_LINE, size) != 0)
+  {
+    fprintf(stderr, "Error: Out of memory in interval probe.\n");
+    exit(1);
+  }
+  b->slot = (IntervalProbeSlot *)p;
+  probe_clear(b->slot, probe_n);
+  b->next = probe_buffers;
+  probe_buffers = b;
+  interval_probe_tls_gen = interval_probe_gen;
+  pthread_mutex_unlock(&probe_lock);
+
+  interval_probe_tls = b->slot;
+  return (b->slot);
+}
+
+/* IntervalProbeReset:
+ * Clear the ranges recorded by all threads. Must not run concurrently with
+ * probes.
+ */
+void IntervalProbeReset(void)
+{
+  ProbeBuffer *b;
+
+  pthread_mutex_lock(&probe_lock);
+  for (b = probe_buffers; b != NULL; b = b->next)
+  {
+    probe_clear(b->slot, probe_n);
+  }
+  pthread_mutex_unlock(&probe_lock);
+}
+
+/* IntervalProbeMerge:
+ * Merge the ranges recorded by all threads into z[k], for the first n
+ * probes; probes that recorded no values get IntervalEmpty(). To be called
+ * once the probing threads have finished (e.g. after pthread_join). Returns
+ * the number of intervals stored.
+ */
+int IntervalProbeMerge(Interval *z, int n)
+{
+  ProbeBuffer *b;
+  int k;
+
+  pthread_mutex_lock(&probe_lock);
+  n = MIN(n, probe_n);
+  for (k = 0; k < n; k++)
+  {
+    z[k] = INTERVAL(INT_MAX, INT_MIN);
+  }
+  for (b = probe_buffers; b != NULL; b = b->next)
+  {
+    for (k = 0; k < n; k++)
+    {
+      z[k].infm = MIN(z[k].infm, b->slot[k].infm);
+      z[k].supr = MAX(z[k].supr, b->slot[k].supr);
+    }
+  }
+  pthread_mutex_unlock(&probe_lock);
+  for (k = 0; k < n; k++)
+  {
+    if (z[k].infm > z[k].supr)
+    {
+      z[k] = IntervalEmpty();
+    }
+  }
+  return (MAX(n, 0));
+}
+
+/* IntervalProbeDump:
+ * Write the n intervals of z (e.g. from IntervalProbeMerge) to outfile as
+ * text: the INTERVAL_PROBE_MAGIC line, a line with n, then a line with the
+ * id, infimum and supremum of every non-empty interval. Returns INTERVAL_OK
+ * or INTERVAL_ERR_DOMAIN if writing failed.
+ */
+int IntervalProbeDump(FILE *outfile, const Interval *z, int n)
+{
+  int k;
+
+  fprintf(outfile, "%s\n%d\n", INTERVAL_PROBE_MAGIC, n);
+  for (k = 0; k < n; k++)
+  {
+    if (z[k].infm <= z[k].supr)
+    {
+      fprintf(outfile, "%d %d %d\n", k, z[k].infm, z[k].supr);
+    }
+  }
+  return ((fflush(outfile) == 0 && !ferror(outfile)) ? INTERVAL_OK : INTERVAL_ERR_DOMAIN);
+}
+
+/* IntervalProbeLoad:
+ * Read a file written by IntervalProbeDump into the n intervals of z; z[k] is
+ * IntervalEmpty() for probes absent from the file and ids beyond n are
+ * skipped. Returns the number of probes of the file, or -1 if it is not a
+ * probe dump.
+ */
+int IntervalProbeLoad(FILE *infile, Interval *z, int n)
+{
+  char line[64];
+  int k, m, id, u, v, r;
+
+  for (k = 0; k < n; k++)
+  {
+    z[k] = IntervalEmpty();
+  }
+  if (fgets(line, sizeof(line), infile) == NULL ||
+      strncmp(line, INTERVAL_PROBE_MAGIC, strlen(INTERVAL_PROBE_MAGIC)) != 0 ||
+      fscanf(infile, "%d", &m) != 1 || m < 0)
+  {
+    return (-1);
+  }
+  while ((r = fscanf(infile, "%d %d %d", &id, &u, &v)) == 3)
+  {
+    if (id < 0 || id >= m || u > v)
+    {
+      return (-1);
+    }
+    if (id < n)
+    {
+      z[id] = INTERVAL(u, v);
+    }
+  }
+  return ((r == EOF) ? m : -1);
+}
@@ -0,0 +1,85 @@
+/*
+ * Filename: interval-probe.h
+ * Purpose : Runtime value-range profiler for instrumented C code.
+ *           Definitions, probe macro and function prototypes.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.2 (26/10/16)
+ *           Replace the buffers freed by IntervalProbeShutdown in every
+ *           thread, by a generation count.
+ *           0.3.1 (26/10/16)
+ *           Added extern "C" guards for C++.
+ *           0.3.0 (26/10/16)
+ *           Initial version.
+ */
+#ifndef INTERVAL_PROBE_H
+#define INTERVAL_PROBE_H
+
+#include <stdio.h>
+#include "interval.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Size of a cache line; every thread buffer starts at a line boundary and
+ * spans whole lines.
+ */
+#define INTERVAL_PROBE_LINE     64
+
+/* First line of the dump file format. */
+#define INTERVAL_PROBE_MAGIC    "# interval-probe 1"
+
+/* IntervalProbeSlot is the running range of a probe in a thread buffer;
+ * [INT_MAX,INT_MIN] until the probe records a value.
+ */
+typedef struct {
+  int infm, supr;
+} IntervalProbeSlot;
+
+/* The buffer of the calling thread, attached by its first probe, and the
+ * generation of the profiler it was attached in. A buffer of an earlier
+ * generation has been freed by IntervalProbeShutdown and is replaced.
+ */
+extern __thread IntervalProbeSlot *interval_probe_tls;
+extern __thread unsigned int interval_probe_tls_gen;
+extern unsigned int interval_probe_gen;
+
+/* INTERVAL_PROBE records value v for probe id (0 <= id < the number of
+ * probes given to IntervalProbeInit, unchecked) in the buffer of the calling
+ * thread. Defining INTERVAL_PROBE_DISABLE compiles probes out.
+ */
+#ifdef INTERVAL_PROBE_DISABLE
+#define INTERVAL_PROBE(id, v)  ((void)0)
+#else
+#define INTERVAL_PROBE(id, v) \
+  do { \
+    IntervalProbeSlot *probe_s_ = interval_probe_tls; \
+    int probe_v_ = (v); \
+    if (__builtin_expect(probe_s_ == NULL || \
+                         interval_probe_tls_gen != interval_probe_gen, 0)) \
+    { \
+      probe_s_ = IntervalProbeAttach(); \
+    } \
+    probe_s_ += (id); \
+    probe_s_->infm = (probe_v_ < probe_s_->infm) ? probe_v_ : probe_s_->infm; \
+    probe_s_->supr = (probe_v_ > probe_s_->supr) ? probe_v_ : probe_s_->supr; \
+  } while (0)
+#endif
+
+/* Interval probe API. */
+int IntervalProbeInit(int nprobes);
+void IntervalProbeShutdown(void);
+int IntervalProbeCount(void);
+IntervalProbeSlot *IntervalProbeAttach(void);
+void IntervalProbeReset(void);
+int IntervalProbeMerge(Interval *z, int n);
+int IntervalProbeDump(FILE *outfile, const Interval *z, int n);
+int IntervalProbeLoad(FILE *infile, Interval *z, int n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INTERVAL_PROBE_H */
@@ -0,0 +1,398 @@
+/*
+ * Filename: interval-trace.c
+ * Purpose : Implementation of the streaming trace reducer. The frames of a
+ *           trace are split into contiguous chunks, one per thread; every
+ *           thread folds its frames into private per-signal minimum and
+ *           maximum arrays with SIMD kernels, reading the file through a
+ *           shared mapping (releasing the pages it has consumed) or through
+ *           a fixed-size buffer. The per-thread results are merged at the
+ *           end, so memory use does not depend on the length of the trace.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.0 (26/10/16)
+ *           Initial version.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "interval.h"
+#include "interval-batch.h"
+#include "interval-trace.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define INTERVAL_TRACE_X86
+#include <immintrin.h>
+#endif
+
+/* TraceWorker is the state of one thread of a reduction. */
+typedef struct {
+  int fd;                     /* Trace file */
+  const char *map;            /* Mapping of the whole file, or NULL */
+  long pagesize;              /* Page size, for releasing mapped pages */
+  int nsignals;               /* Number of signals */
+  long long f0, f1;           /* Frames [f0,f1) of this thread */
+  int *vmin, *vmax;           /* Per-signal minimum and maximum */
+  int error;                  /* Whether a read failed */
+} TraceWorker;
+
+/* trace_alloc:
+ * Allocate size bytes; abort when out of memory.
+ */
+static void *trace_alloc(size_t size)
+{
+  void *p = malloc((size > 0) ? size : 1);
+
+  if (p == NULL)
+  {
+    fprintf(stderr, "Error: Out of memory in interval trace reducer.\n");
+    exit(1);
+  }
+  return (p);
+}
+
+#ifdef INTERVAL_TRACE_X86
+/* fold_avx2:
+ * Fold the leading multiple-of-8 signals of the nf frames of v into vmin and
+ * vmax using AVX2. Returns the number of signals processed.
+ */
+__attribute__((target("avx2")))
+static int fold_avx2(const int *v, long nf, int ns, int *vmin, int *vmax)
+{
+  __m256i x, mn, mx;
+  long f;
+  int j;
+
+  for (j = 0; j + 8 <= ns; j += 8)
+  {
+    mn = _mm256_loadu_si256((const __m256i *)(vmin + j));
+    mx = _mm256_loadu_si256((const __m256i *)(vmax + j));
+    for (f = 0; f < nf; f++)
+    {
+      x = _mm256_loadu_si256((const __m256i *)(v + f * ns + j));
+      mn = _mm256_min_epi32(mn, x);
+      mx = _mm256_max_epi32(mx, x);
+    }
+    _mm256_storeu_si256((__m256i *)(vmin + j), mn);
+    _mm256_storeu_si256((__m256i *)(vmax + j), mx);
+  }
+  return (j);
+}
+
+/* fold_sse41:
+ * SSE4.1 version of fold_avx2, for the leading multiple-of-4 signals.
+ */
+__attribute__((target("sse4.1")))
+static int fold_sse41(const int *v, long nf, int ns, int *vmin, int *vmax)
+{
+  __m128i x, mn, mx;
+  long f;
+  int j;
+
+  for (j = 0; j + 4 <= ns; j += 4)
+  {
+    mn = _mm_loadu_si128((const __m128i *)(vmin + j));
+    mx = _mm_loadu_si128((const __m128i *)(vmax + j));
+    for (f = 0; f < nf; f++)
+    {
+      x = _mm_loadu_si128((const __m128i *)(v + f * ns + j));
+      mn = _mm_min_epi32(mn, x);
+      mx = _mm_max_epi32(mx, x);
+    }
+    _mm_storeu_si128((__m128i *)(vmin + j), mn);
+    _mm_storeu_si128((__m128i *)(vmax + j), mx);
+  }
+  return (j);
+}
+#endif /* INTERVAL_TRACE_X86 */
+
+/* trace_fold:
+ * Fold the nf frames of ns signals at v into vmin and vmax. Each vector of
+ * signals stays in registers across all frames of the block. A single signal
+ * is reduced as a flat array by IntervalViolationsMinMaxBatch.
+ */
+static void trace_fold(const int *v, long nf, int ns, int *vmin, int *vmax)
+{
+  Interval r;
+  long f;
+  int j = 0;
+
+  if (ns == 1)
+  {
+    if (nf > 0)
+    {
+      IntervalViolationsMinMaxBatch(INTERVAL(INT_MIN, INT_MAX), (int)nf, v,
+        NULL, &r);
+      vmin[0] = MIN(vmin[0], r.infm);
+      vmax[0] = MAX(vmax[0], r.supr);
+    }
+    return;
+  }
+#ifdef INTERVAL_TRACE_X86
+  switch (IntervalBatchGetIsa())
+  {
+    case INTERVAL_ISA_AVX512:
+    case INTERVAL_ISA_AVX2:
+      j = fold_avx2(v, nf, ns, vmin, vmax);
+      break;
+    case INTERVAL_ISA_SSE41:
+      j = fold_sse41(v, nf, ns, vmin, vmax);
+      break;
+    default:
+      break;
+  }
+#endif
+  for (; j < ns; j++)
+  {
+    for (f = 0; f < nf; f++)
+    {
+      vmin[j] = MIN(vmin[j], v[f * ns + j]);
+      vmax[j] = MAX(vmax[j], v[f * ns + j]);
+    }
+  }
+}
+
+/* trace_read:
+ * Read size bytes at offset off of file fd into buf. Returns 0 on success.
+ */
+static int trace_read(int fd, char *buf, size_t size, off_t off)
+{
+  ssize_t r;
+
+  while (size > 0)
+  {
+    r = pread(fd, buf, size, off);
+    if (r <= 0)
+    {
+      return (-1);
+    }
+    buf += r;
+    size -= (size_t)r;
+    off += r;
+  }
+  return (0);
+}
+
+/* trace_worker:
+ * Reduce frames [f0,f1) of a trace, one buffer of frames at a time.
+ */
+static void *trace_worker(void *arg)
+{
+  TraceWorker *w = (TraceWorker *)arg;
+  size_t fsize = (size_t)w->nsignals * sizeof(int);
+  long long f, nf, block;
+  off_t off;
+  uintptr_t p0, p1;
+  char *buf = NULL;
+
+  block = MAX(INTERVAL_TRACE_BUFFER / (long long)fsize, 1);
+  if (w->map == NULL)
+  {
+    buf = trace_alloc((size_t)block * fsize);
+  }
+  for (f = w->f0; f < w->f1 && !w->error; f += nf)
+  {
+    nf = MIN(block, w->f1 - f);
+    off = INTERVAL_TRACE_HEADER + (off_t)f * (off_t)fsize;
+    if (w->map != NULL)
+    {
+      trace_fold((const int *)(w->map + off), (long)nf, w->nsignals,
+        w->vmin, w->vmax);
+      // Release the whole pages consumed, to bound the resident set. This
+      // needs madvise: glibc makes POSIX_MADV_DONTNEED a no-op.
+      p0 = ((uintptr_t)(w->map + off) + w->pagesize - 1) & ~(uintptr_t)(w->pagesize - 1);
+      p1 = (uintptr_t)(w->map + off + nf * fsize) & ~(uintptr_t)(w->pagesize - 1);
+      if (p1 > p0)
+      {
+        madvise((void *)p0, p1 - p0, MADV_DONTNEED);
+      }
+    }
+    else if (trace_read(w->fd, buf, (size_t)nf * fsize, off) == 0)
+    {
+      trace_fold((const int *)buf, (long)nf, w->nsignals, w->vmin, w->vmax);
+    }
+    else
+    {
+      w->error = 1;
+    }
+  }
+  free(buf);
+  return (NULL);
+}
+
+/* IntervalTraceWriteHeader:
+ * Write the header of a trace of nsignals signals to outfile; the frames are
+ * to be written after it. Returns INTERVAL_OK, INTERVAL_ERR_INVALID for
+ * nsignals <= 0, or INTERVAL_ERR_DOMAIN if writing failed.
+ */
+int IntervalTraceWriteHeader(FILE *outfile, int nsignals)
+{
+  int h[3];
+
+  if (nsignals <= 0)
+  {
+    return (INTERVAL_ERR_INVALID);
+  }
+  h[0] = INTERVAL_TRACE_VERSION;
+  h[1] = nsignals;
+  h[2] = 0;
+  if (fwrite(INTERVAL_TRACE_MAGIC, 1, 4, outfile) != 4 ||
+      fwrite(h, sizeof(int), 3, outfile) != 3)
+  {
+    return (INTERVAL_ERR_DOMAIN);
+  }
+  return (INTERVAL_OK);
+}
+
+/* IntervalTraceReduce:
+ * Compute the range of every signal of the trace file at path, and its
+ * bitwidth for arithmetic type xtyp, using nthreads threads (one per online
+ * processor for nthreads <= 0, fewer for short traces). The file is mapped
+ * unless flags has INTERVAL_TRACE_READ or mapping fails, in which case it is
+ * read through buffers of INTERVAL_TRACE_BUFFER bytes. An incomplete last
+ * frame is ignored. Returns NULL if the file cannot be opened or read, or is
+ * not a trace.
+ */
+IntervalTrace *IntervalTraceReduce(const char *path, int nthreads,
+                 ArithType xtyp, int flags)
+{
+  IntervalTrace *t;
+  TraceWorker *w;
+  pthread_t *threads;
+  struct stat st;
+  char magic[4];
+  int h[3], k, j, fd, error = 0;
+  void *map = MAP_FAILED;
+
+  fd = open(path, O_RDONLY);
+  if (fd < 0)
+  {
+    return (NULL);
+  }
+  if (fstat(fd, &st) != 0 || st.st_size < INTERVAL_TRACE_HEADER ||
+      trace_read(fd, magic, 4, 0) != 0 || trace_read(fd, (char *)h, sizeof(h), 4) != 0 ||
+      memcmp(magic, INTERVAL_TRACE_MAGIC, 4) != 0 ||
+      h[0] != INTERVAL_TRACE_VERSION || h[1] <= 0)
+  {
+    close(fd);
+    return (NULL);
+  }
+  t = trace_alloc(sizeof(IntervalTrace));
+  t->nsignals = h[1];
+  t->nframes = (long long)(st.st_size - INTERVAL_TRACE_HEADER) /
+               ((long long)t->nsignals * sizeof(int));
+  t->infm = trace_alloc(t->nsignals * sizeof(int));
+  t->supr = trace_alloc(t->nsignals * sizeof(int));
+  t->bw = trace_alloc(t->nsignals * sizeof(int));
+
+  if (nthreads <= 0)
+  {
+    nthreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  }
+  nthreads = (int)MIN((long long)nthreads, st.st_size / INTERVAL_TRACE_CHUNK);
+  nthreads = (int)MIN((long long)MAX(nthreads, 1), MAX(t->nframes, 1));
+  if (!(flags & INTERVAL_TRACE_READ) && t->nframes > 0)
+  {
+    map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+
+  // Deal contiguous chunks of frames; worker 0 runs in the calling thread.
+  w = trace_alloc(nthreads * sizeof(TraceWorker));
+  threads = trace_alloc(nthreads * sizeof(pthread_t));
+  for (k = 0; k < nthreads; k++)
+  {
+    w[k].fd = fd;
+    w[k].map = (map != MAP_FAILED) ? (const char *)map : NULL;
+    w[k].pagesize = sysconf(_SC_PAGESIZE);
+    w[k].nsignals = t->nsignals;
+    w[k].f0 = t->nframes * k / nthreads;
+    w[k].f1 = t->nframes * (k + 1) / nthreads;
+    w[k].vmin = (k == 0) ? t->infm : trace_alloc(t->nsignals * sizeof(int));
+    w[k].vmax = (k == 0) ? t->supr : trace_alloc(t->nsignals * sizeof(int));
+    w[k].error = 0;
+    for (j = 0; j < t->nsignals; j++)
+    {
+      w[k].vmin[j] = INT_MAX;
+      w[k].vmax[j] = INT_MIN;
+    }
+  }
+  for (k = 1; k < nthreads; k++)
+  {
+    if (pthread_create(&threads[k], NULL, trace_worker, &w[k]) != 0)
+    {
+      fprintf(stderr, "Error: Unable to create trace reducer thread.\n");
+      exit(1);
+    }
+  }
+  trace_worker(&w[0]);
+  error = w[0].error;
+  for (k = 1; k < nthreads; k++)
+  {
+    pthread_join(threads[k], NULL);
+    error |= w[k].error;
+    for (j = 0; j < t->nsignals; j++)
+    {
+      t->infm[j] = MIN(t->infm[j], w[k].vmin[j]);
+      t->supr[j] = MAX(t->supr[j], w[k].vmax[j]);
+    }
+    free(w[k].vmin);
+    free(w[k].vmax);
+  }
+  free(w);
+  free(threads);
+  if (map != MAP_FAILED)
+  {
+    munmap(map, (size_t)st.st_size);
+  }
+  close(fd);
+  if (error)
+  {
+    IntervalTraceDestroy(t);
+    return (NULL);
+  }
+
+  // Without frames, no signal has a value: give each the empty range [1,0].
+  if (t->nframes == 0)
+  {
+    for (j = 0; j < t->nsignals; j++)
+    {
+      t->infm[j] = 1;
+      t->supr[j] = 0;
+    }
+  }
+  IntervalToIntegerBitwidthBatchChecked(t->nsignals, t->infm, t->supr, xtyp,
+    t->bw, NULL);
+
+  return (t);
+}
+
+/* IntervalTraceDestroy:
+ * Free all memory of trace t.
+ */
+void IntervalTraceDestroy(IntervalTrace *t)
+{
+  if (t == NULL)
+  {
+    return;
+  }
+  free(t->infm);
+  free(t->supr);
+  free(t->bw);
+  free(t);
+}
+
+/* IntervalTraceRange:
+ * Return the range of signal k of trace t.
+ */
+Interval IntervalTraceRange(const IntervalTrace *t, int k)
+{
+  return (INTERVAL(t->infm[k], t->supr[k]));
+}
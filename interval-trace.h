@@ -0,0 +1,60 @@
+/*
+ * Filename: interval-trace.h
+ * Purpose : Streaming reducer of binary value traces to per-signal intervals.
+ *           Definitions and function prototypes.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.1 (26/10/16)
+ *           Added extern "C" guards for C++.
+ *           0.3.0 (26/10/16)
+ *           Initial version.
+ */
+#ifndef INTERVAL_TRACE_H
+#define INTERVAL_TRACE_H
+
+#include <stdio.h>
+#include "interval.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* A trace file consists of a 16-byte header followed by frames. The header
+ * holds the magic "ITRC", then the version, the number of signals and a
+ * reserved word, as 32-bit integers. Every frame holds one 32-bit value per
+ * signal. All integers are in host byte order.
+ */
+#define INTERVAL_TRACE_MAGIC    "ITRC"
+#define INTERVAL_TRACE_VERSION  1
+#define INTERVAL_TRACE_HEADER   16
+
+/* Bytes of a trace read (or released, when mapped) at a time per thread. */
+#define INTERVAL_TRACE_BUFFER   (1 << 20)
+
+/* Minimum number of bytes given to each thread. */
+#define INTERVAL_TRACE_CHUNK    (4 << 20)
+
+/* Flags of IntervalTraceReduce. */
+#define INTERVAL_TRACE_READ     0x01    /* Use buffered reads instead of mmap */
+
+/* IntervalTrace holds the range and bitwidth of every signal of a trace. */
+typedef struct {
+  int nsignals;               /* Number of signals */
+  long long nframes;          /* Number of (complete) frames */
+  int *infm, *supr;           /* Range of each signal ([1,0] if no frames) */
+  int *bw;                    /* Bitwidth of each signal (0 if no frames) */
+} IntervalTrace;
+
+/* Interval trace API. */
+int IntervalTraceWriteHeader(FILE *outfile, int nsignals);
+IntervalTrace *IntervalTraceReduce(const char *path, int nthreads,
+                 ArithType xtyp, int flags);
+void IntervalTraceDestroy(IntervalTrace *t);
+Interval IntervalTraceRange(const IntervalTrace *t, int k);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INTERVAL_TRACE_H */
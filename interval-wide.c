@@ -0,0 +1,1263 @@
+/*
+ * Filename: interval-wide.c
+ * Purpose : Implementation of the intervals with 64-bit, 128-bit and
+ *           arbitrary-precision bounds. The 64-bit and 128-bit operations use
+ *           the overflow-checking builtins of GCC/Clang and saturate bounds
+ *           that overflow. The arbitrary-precision bounds keep values that
+ *           fit in 64 bits inline and operate on them natively, falling back
+ *           to sign-magnitude arithmetic on 32-bit limbs only when a result
+ *           does not fit.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.0 (26/10/16)
+ *           Initial version.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "interval.h"
+#include "interval-wide.h"
+
+#ifdef INTERVAL_HAVE_INT128
+#define INT128_MAX_  ((IntervalInt128)(((unsigned __int128)1 << 127) - 1))
+#define INT128_MIN_  (-INT128_MAX_ - 1)
+#endif
+
+/* Limbs of a wide IntervalBigInt. */
+#define BIG_LIMBS(a)  (((a)->n <= INTERVAL_BIG_INLINE) ? (a)->buf : (a)->heap)
+
+/* Limbs of the temporaries on the stack; larger ones are allocated. */
+#define BIG_STACK  (2 * INTERVAL_BIG_INLINE + 2)
+
+/* wide_alloc:
+ * Reallocate p to size bytes; abort when out of memory.
+ */
+static void *wide_alloc(void *p, size_t size)
+{
+  p = realloc(p, (size > 0) ? size : 1);
+  if (p == NULL)
+  {
+    fprintf(stderr, "Error: Out of memory in wide interval.\n");
+    exit(1);
+  }
+  return (p);
+}
+
+/* wide_bitlen64:
+ * Return the number of significant bits of u (0 for 0).
+ */
+static inline int wide_bitlen64(uint64_t u)
+{
+#if defined(__GNUC__)
+  return ((u == 0) ? 0 : 64 - __builtin_clzll(u));
+#else
+  int n = 0;
+  while (u != 0)
+  {
+    u >>= 1;
+    n++;
+  }
+  return (n);
+#endif
+}
+
+/* Saturating 64-bit arithmetic: on overflow, the bound is saturated and
+ * INTERVAL_ERR_OVERFLOW is OR-ed into *status.
+ */
+static inline int64_t sat_add64(int64_t a, int64_t b, int *status)
+{
+  int64_t r;
+
+  if (__builtin_add_overflow(a, b, &r))
+  {
+    *status |= INTERVAL_ERR_OVERFLOW;
+    r = (b > 0) ? INT64_MAX : INT64_MIN;
+  }
+  return (r);
+}
+
+static inline int64_t sat_sub64(int64_t a, int64_t b, int *status)
+{
+  int64_t r;
+
+  if (__builtin_sub_overflow(a, b, &r))
+  {
+    *status |= INTERVAL_ERR_OVERFLOW;
+    r = (b < 0) ? INT64_MAX : INT64_MIN;
+  }
+  return (r);
+}
+
+static inline int64_t sat_mul64(int64_t a, int64_t b, int *status)
+{
+  int64_t r;
+
+  if (__builtin_mul_overflow(a, b, &r))
+  {
+    *status |= INTERVAL_ERR_OVERFLOW;
+    r = ((a < 0) != (b < 0)) ? INT64_MIN : INT64_MAX;
+  }
+  return (r);
+}
+
+static inline int64_t sat_div64(int64_t a, int64_t b, int *status)
+{
+  if (a == INT64_MIN && b == -1)
+  {
+    *status |= INTERVAL_ERR_OVERFLOW;
+    return (INT64_MAX);
+  }
+  return (a / b);
+}
+
+/* INTERVAL64:
+ * Construct the interval [u,v] with 64-bit bounds.
+ */
+Interval64 INTERVAL64(int64_t u, int64_t v)
+{
+  Interval64 z;
+  z.infm = u;
+  z.supr = v;
+  return (z);
+}
+
+/* Interval64FromInterval:
+ * Widen interval x to 64-bit bounds.
+ */
+Interval64 Interval64FromInterval(Interval x)
+{
+  return (INTERVAL64(x.infm, x.supr));
+}
+
+/* Interval64ToInterval:
+ * Narrow interval x to int bounds in z; returns INTERVAL_OK, or
+ * INTERVAL_ERR_OVERFLOW if a bound was saturated.
+ */
+int Interval64ToInterval(Interval *z, Interval64 x)
+{
+  int status = INTERVAL_OK;
+
+  if (x.infm < INT32_MIN || x.infm > INT32_MAX || x.supr < INT32_MIN || x.supr > INT32_MAX)
+  {
+    status = INTERVAL_ERR_OVERFLOW;
+  }
+  z->infm = (int)((x.infm < INT32_MIN) ? INT32_MIN : (x.infm > INT32_MAX) ? INT32_MAX : x.infm);
+  z->supr = (int)((x.supr < INT32_MIN) ? INT32_MIN : (x.supr > INT32_MAX) ? INT32_MAX : x.supr);
+  return (status);
+}
+
+/* Interval64Universe:
+ * Return in z the range of bw-bit integers: [0,2**bw-1] for unsigned (bw up
+ * to 63) or [-2**(bw-1),2**(bw-1)-1] for signed (bw up to 64) arithmetic.
+ * Returns INTERVAL_OK, INTERVAL_ERR_BITWIDTH or INTERVAL_ERR_ARITH_TYPE.
+ */
+int Interval64Universe(Interval64 *z, int bw, ArithType ztyp)
+{
+  uint64_t m = UINT64_MAX;
+
+  *z = INTERVAL64(1, 0);
+  if (ztyp == UNSIGNED_ARITH && bw > 0 && bw < 64)
+  {
+    *z = INTERVAL64(0, (int64_t)(m >> (64 - bw)));
+  }
+  else if (ztyp == SIGNED_ARITH && bw > 0 && bw <= 64)
+  {
+    m = (m >> (64 - bw)) >> 1;
+    *z = INTERVAL64(~(int64_t)m, (int64_t)m);
+  }
+  else
+  {
+    return ((ztyp == UNSIGNED_ARITH || ztyp == SIGNED_ARITH) ?
+      INTERVAL_ERR_BITWIDTH : INTERVAL_ERR_ARITH_TYPE);
+  }
+  return (INTERVAL_OK);
+}
+
+/* Interval64Add, Interval64Sub, Interval64Neg:
+ * Interval addition, subtraction and negation with 64-bit bounds.
+ */
+int Interval64Add(Interval64 *z, Interval64 x, Interval64 y)
+{
+  int status = INTERVAL_OK;
+
+  z->infm = sat_add64(x.infm, y.infm, &status);
+  z->supr = sat_add64(x.supr, y.supr, &status);
+  return (status);
+}
+
+int Interval64Sub(Interval64 *z, Interval64 x, Interval64 y)
+{
+  int status = INTERVAL_OK;
+  int64_t u = sat_sub64(x.infm, y.supr, &status);
+
+  z->supr = sat_sub64(x.supr, y.infm, &status);
+  z->infm = u;
+  return (status);
+}
+
+int Interval64Neg(Interval64 *z, Interval64 x)
+{
+  int status = INTERVAL_OK;
+
+  z->infm = sat_sub64(0, x.supr, &status);
+  z->supr = sat_sub64(0, x.infm, &status);
+  return (status);
+}
+
+/* Interval64Mul:
+ * Interval multiplication with 64-bit bounds, from the four products of the
+ * bounds (for any signs).
+ */
+int Interval64Mul(Interval64 *z, Interval64 x, Interval64 y)
+{
+  int status = INTERVAL_OK;
+  int64_t a = sat_mul64(x.infm, y.infm, &status);
+  int64_t b = sat_mul64(x.infm, y.supr, &status);
+  int64_t c = sat_mul64(x.supr, y.infm, &status);
+  int64_t d = sat_mul64(x.supr, y.supr, &status);
+
+  z->infm = MIN(MIN(a, b), MIN(c, d));
+  z->supr = MAX(MAX(a, b), MAX(c, d));
+  return (status);
+}
+
+/* Interval64Div:
+ * Interval division (quotient only) with 64-bit bounds. Returns
+ * INTERVAL_ERR_EMPTY if x or y is empty, or INTERVAL_ERR_DIV_ZERO if y 
+ * contains zero, with the empty interval.
+ */
+int Interval64Div(Interval64 *z, Interval64 x, Interval64 y)
+{
+  int status = INTERVAL_OK;
+  int64_t a, b, c, d;
+
+  if (Interval64IsEmpty(x) || Interval64IsEmpty(y))
+  {
+    *z = INTERVAL64(1, 0);
+    return (INTERVAL_ERR_EMPTY);
+  }
+  if (y.infm <= 0 && 0 <= y.supr)
+  {
+    *z = INTERVAL64(1, 0);
+    return (INTERVAL_ERR_DIV_ZERO);
+  }
+  a = sat_div64(x.infm, y.infm, &status);
+  b = sat_div64(x.infm, y.supr, &status);
+  c = sat_div64(x.supr, y.infm, &status);
+  d = sat_div64(x.supr, y.supr, &status);
+  z->infm = MIN(MIN(a, b), MIN(c, d));
+  z->supr = MAX(MAX(a, b), MAX(c, d));
+  return (status);
+}
+
+/* Interval64Union, Interval64Intersection:
+ * Interval hull and intersection ([1,0] if disjoint) with 64-bit bounds.
+ */
+Interval64 Interval64Union(Interval64 x, Interval64 y)
+{
+  return (INTERVAL64(MIN(x.infm, y.infm), MAX(x.supr, y.supr)));
+}
+
+Interval64 Interval64Intersection(Interval64 x, Interval64 y)
+{
+  if (Interval64IsEmpty(x) || Interval64IsEmpty(y) || x.supr < y.infm || y.supr < x.infm)
+  {
+    return (INTERVAL64(1, 0));
+  }
+  return (INTERVAL64(MAX(x.infm, y.infm), MIN(x.supr, y.supr)));
+}
+
+/* Interval64IsEmpty, ValueIsInInterval64:
+ * Queries with 64-bit bounds; 1 if true, 0 otherwise.
+ */
+int Interval64IsEmpty(Interval64 x)
+{
+  return (x.infm > x.supr);
+}
+
+int ValueIsInInterval64(Interval64 x, int64_t v)
+{
+  return (x.infm <= v && v <= x.supr);
+}
+
+/* Interval64ToIntegerBitwidth:
+ * Return in n the bitwidth of interval x (at most 64), as by
+ * IntervalToIntegerBitwidth. Returns INTERVAL_OK, INTERVAL_ERR_EMPTY or
+ * INTERVAL_ERR_ARITH_TYPE (with n = 0).
+ */
+int Interval64ToIntegerBitwidth(int *n, Interval64 x, ArithType xtyp)
+{
+  *n = 0;
+  if (Interval64IsEmpty(x))
+  {
+    return (INTERVAL_ERR_EMPTY);
+  }
+  if (xtyp != UNSIGNED_ARITH && xtyp != SIGNED_ARITH)
+  {
+    return (INTERVAL_ERR_ARITH_TYPE);
+  }
+  *n = wide_bitlen64((uint64_t)x.supr - (uint64_t)x.infm);
+  return (INTERVAL_OK);
+}
+
+/* Interval64Print:
+ * Print interval x to outfile.
+ */
+void Interval64Print(FILE *outfile, Interval64 x)
+{
+  fprintf(outfile, "[%" PRId64 ",%" PRId64 "]", x.infm, x.supr);
+}
+
+/* mag_norm:
+ * Return the number of limbs of the magnitude m[0...n-1] without leading
+ * zero limbs.
+ */
+static int mag_norm(const uint32_t *m, int n)
+{
+  while (n > 0 && m[n-1] == 0)
+  {
+    n--;
+  }
+  return (n);
+}
+
+/* mag_cmp:
+ * Compare the normalized magnitudes a and b; returns -1, 0 or 1.
+ */
+static int mag_cmp(const uint32_t *a, int na, const uint32_t *b, int nb)
+{
+  int i;
+
+  if (na != nb)
+  {
+    return ((na < nb) ? -1 : 1);
+  }
+  for (i = na - 1; i >= 0; i--)
+  {
+    if (a[i] != b[i])
+    {
+      return ((a[i] < b[i]) ? -1 : 1);
+    }
+  }
+  return (0);
+}
+
+/* mag_add:
+ * Store a + b in z (of MAX(na,nb)+1 limbs); returns the number of limbs.
+ */
+static int mag_add(uint32_t *z, const uint32_t *a, int na, const uint32_t *b, int nb)
+{
+  uint64_t c = 0;
+  int i, n = MAX(na, nb);
+
+  for (i = 0; i < n; i++)
+  {
+    c += (uint64_t)((i < na) ? a[i] : 0) + ((i < nb) ? b[i] : 0);
+    z[i] = (uint32_t)c;
+    c >>= 32;
+  }
+  z[n] = (uint32_t)c;
+  return (mag_norm(z, n + 1));
+}
+
+/* mag_sub:
+ * Store a - b (a >= b) in z (of na limbs); returns the number of limbs.
+ */
+static int mag_sub(uint32_t *z, const uint32_t *a, int na, const uint32_t *b, int nb)
+{
+  int64_t c = 0;
+  int i;
+
+  for (i = 0; i < na; i++)
+  {
+    c += (int64_t)a[i] - ((i < nb) ? b[i] : 0);
+    z[i] = (uint32_t)c;
+    c = (c < 0) ? -1 : 0;
+  }
+  return (mag_norm(z, na));
+}
+
+/* mag_mul:
+ * Store a * b in z (of na+nb limbs); returns the number of limbs.
+ */
+static int mag_mul(uint32_t *z, const uint32_t *a, int na, const uint32_t *b, int nb)
+{
+  uint64_t c;
+  int i, j;
+
+  memset(z, 0, (size_t)(na + nb) * sizeof(uint32_t));
+  for (i = 0; i < na; i++)
+  {
+    c = 0;
+    for (j = 0; j < nb; j++)
+    {
+      c += (uint64_t)a[i] * b[j] + z[i + j];
+      z[i + j] = (uint32_t)c;
+      c >>= 32;
+    }
+    z[i + nb] = (uint32_t)c;
+  }
+  return (mag_norm(z, na + nb));
+}
+
+/* mag_print:
+ * Print the signed magnitude m[0...n-1] in decimal, by repeated division by
+ * 10**9; m is overwritten.
+ */
+static void mag_print(FILE *outfile, int neg, uint32_t *m, int n)
+{
+  uint32_t *d = wide_alloc(NULL, (size_t)(2 * n + 1) * sizeof(uint32_t));
+  uint64_t r;
+  int i, k = 0;
+
+  n = mag_norm(m, n);
+  do
+  {
+    r = 0;
+    for (i = n - 1; i >= 0; i--)
+    {
+      r = (r << 32) | m[i];
+      m[i] = (uint32_t)(r / 1000000000U);
+      r %= 1000000000U;
+    }
+    d[k++] = (uint32_t)r;
+    n = mag_norm(m, n);
+  } while (n > 0);
+  fprintf(outfile, "%s%" PRIu32, neg ? "-" : "", d[--k]);
+  while (k > 0)
+  {
+    fprintf(outfile, "%09" PRIu32, d[--k]);
+  }
+  free(d);
+}
+
+#ifdef INTERVAL_HAVE_INT128
+/* Saturating 128-bit arithmetic, as for 64 bits. */
+static inline IntervalInt128 sat_add128(IntervalInt128 a, IntervalInt128 b, int *status)
+{
+  IntervalInt128 r;
+
+  if (__builtin_add_overflow(a, b, &r))
+  {
+    *status |= INTERVAL_ERR_OVERFLOW;
+    r = (b > 0) ? INT128_MAX_ : INT128_MIN_;
+  }
+  return (r);
+}
+
+static inline IntervalInt128 sat_sub128(IntervalInt128 a, IntervalInt128 b, int *status)
+{
+  IntervalInt128 r;
+
+  if (__builtin_sub_overflow(a, b, &r))
+  {
+    *status |= INTERVAL_ERR_OVERFLOW;
+    r = (b < 0) ? INT128_MAX_ : INT128_MIN_;
+  }
+  return (r);
+}
+
+static inline IntervalInt128 sat_mul128(IntervalInt128 a, IntervalInt128 b, int *status)
+{
+  IntervalInt128 r;
+
+  if (__builtin_mul_overflow(a, b, &r))
+  {
+    *status |= INTERVAL_ERR_OVERFLOW;
+    r = ((a < 0) != (b < 0)) ? INT128_MIN_ : INT128_MAX_;
+  }
+  return (r);
+}
+
+static inline IntervalInt128 sat_div128(IntervalInt128 a, IntervalInt128 b, int *status)
+{
+  if (a == INT128_MIN_ && b == -1)
+  {
+    *status |= INTERVAL_ERR_OVERFLOW;
+    return (INT128_MAX_);
+  }
+  return (a / b);
+}
+
+/* INTERVAL128:
+ * Construct the interval [u,v] with 128-bit bounds.
+ */
+Interval128 INTERVAL128(IntervalInt128 u, IntervalInt128 v)
+{
+  Interval128 z;
+  z.infm = u;
+  z.supr = v;
+  return (z);
+}
+
+/* Interval128FromInterval64:
+ * Widen interval x to 128-bit bounds.
+ */
+Interval128 Interval128FromInterval64(Interval64 x)
+{
+  return (INTERVAL128(x.infm, x.supr));
+}
+
+/* Interval128ToInterval64:
+ * Narrow interval x to 64-bit bounds in z; returns INTERVAL_OK, or
+ * INTERVAL_ERR_OVERFLOW if a bound was saturated.
+ */
+int Interval128ToInterval64(Interval64 *z, Interval128 x)
+{
+  int status = INTERVAL_OK;
+
+  if (x.infm < INT64_MIN || x.infm > INT64_MAX || x.supr < INT64_MIN || x.supr > INT64_MAX)
+  {
+    status = INTERVAL_ERR_OVERFLOW;
+  }
+  z->infm = (int64_t)((x.infm < INT64_MIN) ? INT64_MIN : (x.infm > INT64_MAX) ? INT64_MAX : x.infm);
+  z->supr = (int64_t)((x.supr < INT64_MIN) ? INT64_MIN : (x.supr > INT64_MAX) ? INT64_MAX : x.supr);
+  return (status);
+}
+
+/* Interval128Universe:
+ * Return in z the range of bw-bit integers, for bw up to 127 (unsigned) or
+ * 128 (signed), as Interval64Universe.
+ */
+int Interval128Universe(Interval128 *z, int bw, ArithType ztyp)
+{
+  unsigned __int128 m = ~(unsigned __int128)0;
+
+  *z = INTERVAL128(1, 0);
+  if (ztyp == UNSIGNED_ARITH && bw > 0 && bw < 128)
+  {
+    *z = INTERVAL128(0, (IntervalInt128)(m >> (128 - bw)));
+  }
+  else if (ztyp == SIGNED_ARITH && bw > 0 && bw <= 128)
+  {
+    m = (m >> (128 - bw)) >> 1;
+    *z = INTERVAL128(~(IntervalInt128)m, (IntervalInt128)m);
+  }
+  else
+  {
+    return ((ztyp == UNSIGNED_ARITH || ztyp == SIGNED_ARITH) ?
+      INTERVAL_ERR_BITWIDTH : INTERVAL_ERR_ARITH_TYPE);
+  }
+  return (INTERVAL_OK);
+}
+
+/* Interval128Add, Interval128Sub, Interval128Neg:
+ * Interval addition, subtraction and negation with 128-bit bounds.
+ */
+int Interval128Add(Interval128 *z, Interval128 x, Interval128 y)
+{
+  int status = INTERVAL_OK;
+
+  z->infm = sat_add128(x.infm, y.infm, &status);
+  z->supr = sat_add128(x.supr, y.supr, &status);
+  return (status);
+}
+
+int Interval128Sub(Interval128 *z, Interval128 x, Interval128 y)
+{
+  int status = INTERVAL_OK;
+  IntervalInt128 u = sat_sub128(x.infm, y.supr, &status);
+
+  z->supr = sat_sub128(x.supr, y.infm, &status);
+  z->infm = u;
+  return (status);
+}
+
+int Interval128Neg(Interval128 *z, Interval128 x)
+{
+  int status = INTERVAL_OK;
+
+  z->infm = sat_sub128(0, x.supr, &status);
+  z->supr = sat_sub128(0, x.infm, &status);
+  return (status);
+}
+
+/* Interval128Mul:
+ * Interval multiplication with 128-bit bounds.
+ */
+int Interval128Mul(Interval128 *z, Interval128 x, Interval128 y)
+{
+  int status = INTERVAL_OK;
+  IntervalInt128 a = sat_mul128(x.infm, y.infm, &status);
+  IntervalInt128 b = sat_mul128(x.infm, y.supr, &status);
+  IntervalInt128 c = sat_mul128(x.supr, y.infm, &status);
+  IntervalInt128 d = sat_mul128(x.supr, y.supr, &status);
+
+  z->infm = MIN(MIN(a, b), MIN(c, d));
+  z->supr = MAX(MAX(a, b), MAX(c, d));
+  return (status);
+}
+
+/* Interval128Div:
+ * Interval division (quotient only) with 128-bit bounds. Returns
+ * INTERVAL_ERR_EMPTY if x or y is empty, or INTERVAL_ERR_DIV_ZERO if y 
+ * contains zero, with the empty interval.
+ */
+int Interval128Div(Interval128 *z, Interval128 x, Interval128 y)
+{
+  int status = INTERVAL_OK;
+  IntervalInt128 a, b, c, d;
+
+  if (Interval128IsEmpty(x) || Interval128IsEmpty(y))
+  {
+    *z = INTERVAL128(1, 0);
+    return (INTERVAL_ERR_EMPTY);
+  }
+  if (y.infm <= 0 && 0 <= y.supr)
+  {
+    *z = INTERVAL128(1, 0);
+    return (INTERVAL_ERR_DIV_ZERO);
+  }
+  a = sat_div128(x.infm, y.infm, &status);
+  b = sat_div128(x.infm, y.supr, &status);
+  c = sat_div128(x.supr, y.infm, &status);
+  d = sat_div128(x.supr, y.supr, &status);
+  z->infm = MIN(MIN(a, b), MIN(c, d));
+  z->supr = MAX(MAX(a, b), MAX(c, d));
+  return (status);
+}
+
+/* Interval128Union, Interval128Intersection:
+ * Interval hull and intersection ([1,0] if disjoint) with 128-bit bounds.
+ */
+Interval128 Interval128Union(Interval128 x, Interval128 y)
+{
+  return (INTERVAL128(MIN(x.infm, y.infm), MAX(x.supr, y.supr)));
+}
+
+Interval128 Interval128Intersection(Interval128 x, Interval128 y)
+{
+  if (Interval128IsEmpty(x) || Interval128IsEmpty(y) || x.supr < y.infm || y.supr < x.infm)
+  {
+    return (INTERVAL128(1, 0));
+  }
+  return (INTERVAL128(MAX(x.infm, y.infm), MIN(x.supr, y.supr)));
+}
+
+/* Interval128IsEmpty, ValueIsInInterval128:
+ * Queries with 128-bit bounds; 1 if true, 0 otherwise.
+ */
+int Interval128IsEmpty(Interval128 x)
+{
+  return (x.infm > x.supr);
+}
+
+int ValueIsInInterval128(Interval128 x, IntervalInt128 v)
+{
+  return (x.infm <= v && v <= x.supr);
+}
+
+/* Interval128ToIntegerBitwidth:
+ * Return in n the bitwidth of interval x (at most 128), as
+ * Interval64ToIntegerBitwidth.
+ */
+int Interval128ToIntegerBitwidth(int *n, Interval128 x, ArithType xtyp)
+{
+  unsigned __int128 r;
+
+  *n = 0;
+  if (Interval128IsEmpty(x))
+  {
+    return (INTERVAL_ERR_EMPTY);
+  }
+  if (xtyp != UNSIGNED_ARITH && xtyp != SIGNED_ARITH)
+  {
+    return (INTERVAL_ERR_ARITH_TYPE);
+  }
+  r = (unsigned __int128)x.supr - (unsigned __int128)x.infm;
+  *n = ((r >> 64) != 0) ? 64 + wide_bitlen64((uint64_t)(r >> 64)) : wide_bitlen64((uint64_t)r);
+  return (INTERVAL_OK);
+}
+
+/* int128_mag:
+ * Store the magnitude of v in m (4 limbs); returns whether v is negative.
+ */
+static int int128_mag(IntervalInt128 v, uint32_t *m)
+{
+  unsigned __int128 u = (v < 0) ? -(unsigned __int128)v : (unsigned __int128)v;
+  int i;
+
+  for (i = 0; i < 4; i++)
+  {
+    m[i] = (uint32_t)(u >> (32 * i));
+  }
+  return (v < 0);
+}
+
+/* Interval128Print:
+ * Print interval x to outfile.
+ */
+void Interval128Print(FILE *outfile, Interval128 x)
+{
+  uint32_t m[4];
+  int neg;
+
+  fprintf(outfile, "[");
+  neg = int128_mag(x.infm, m);
+  mag_print(outfile, neg, m, 4);
+  fprintf(outfile, ",");
+  neg = int128_mag(x.supr, m);
+  mag_print(outfile, neg, m, 4);
+  fprintf(outfile, "]");
+}
+#endif /* INTERVAL_HAVE_INT128 */
+
+/* big_init, big_free:
+ * Initialize a to zero and free its memory.
+ */
+static void big_init(IntervalBigInt *a)
+{
+  a->v = 0;
+  a->n = 0;
+  a->neg = 0;
+  a->cap = 0;
+  a->heap = NULL;
+}
+
+static void big_free(IntervalBigInt *a)
+{
+  free(a->heap);
+  big_init(a);
+}
+
+/* big_sign:
+ * Return 1 if a is negative.
+ */
+static inline int big_sign(const IntervalBigInt *a)
+{
+  return ((a->n == 0) ? (a->v < 0) : a->neg);
+}
+
+/* big_mag:
+ * Return the normalized magnitude of a, in its limbs or (for a small value)
+ * in tmp (2 limbs), through m; returns the number of limbs.
+ */
+static int big_mag(const IntervalBigInt *a, uint32_t *tmp, const uint32_t **m)
+{
+  uint64_t u;
+
+  if (a->n == 0)
+  {
+    u = (a->v < 0) ? 0 - (uint64_t)a->v : (uint64_t)a->v;
+    tmp[0] = (uint32_t)u;
+    tmp[1] = (uint32_t)(u >> 32);
+    *m = tmp;
+    return (mag_norm(tmp, 2));
+  }
+  *m = BIG_LIMBS(a);
+  return (a->n);
+}
+
+/* big_pack:
+ * Set a to the signed magnitude m[0...n-1], which must not be stored in a;
+ * the value is kept small if it fits in 64 bits.
+ */
+static void big_pack(IntervalBigInt *a, int neg, const uint32_t *m, int n)
+{
+  uint64_t u;
+
+  n = mag_norm(m, n);
+  if (n <= 2)
+  {
+    u = ((n > 0) ? m[0] : 0) | ((uint64_t)((n > 1) ? m[1] : 0) << 32);
+    if (u <= (uint64_t)INT64_MAX || (neg && u == (uint64_t)INT64_MAX + 1))
+    {
+      a->n = 0;
+      a->v = neg ? (int64_t)(0 - u) : (int64_t)u;
+      return;
+    }
+  }
+  if (n > INTERVAL_BIG_INLINE && n > a->cap)
+  {
+    a->heap = wide_alloc(a->heap, (size_t)n * sizeof(uint32_t));
+    a->cap = n;
+  }
+  a->n = n;
+  a->neg = neg;
+  memcpy(BIG_LIMBS(a), m, (size_t)n * sizeof(uint32_t));
+}
+
+/* big_tmp:
+ * Return a temporary of n limbs: stack if large enough, else allocated.
+ */
+static uint32_t *big_tmp(uint32_t *stack, int n)
+{
+  return ((n <= BIG_STACK) ? stack : (uint32_t *)wide_alloc(NULL, (size_t)n * sizeof(uint32_t)));
+}
+
+/* big_copy:
+ * Set z to a.
+ */
+static void big_copy(IntervalBigInt *z, const IntervalBigInt *a)
+{
+  if (z == a)
+  {
+    return;
+  }
+  if (a->n == 0)
+  {
+    z->n = 0;
+    z->v = a->v;
+    return;
+  }
+  big_pack(z, a->neg, BIG_LIMBS(a), a->n);
+}
+
+/* big_cmp:
+ * Compare a and b; returns -1, 0 or 1.
+ */
+static int big_cmp(const IntervalBigInt *a, const IntervalBigInt *b)
+{
+  uint32_t ta[2], tb[2];
+  const uint32_t *ma, *mb;
+  int na, nb, sa = big_sign(a), sb = big_sign(b), c;
+
+  if (a->n == 0 && b->n == 0)
+  {
+    return ((a->v > b->v) - (a->v < b->v));
+  }
+  if (sa != sb)
+  {
+    return (sa ? -1 : 1);
+  }
+  na = big_mag(a, ta, &ma);
+  nb = big_mag(b, tb, &mb);
+  c = mag_cmp(ma, na, mb, nb);
+  return (sa ? -c : c);
+}
+
+/* big_add:
+ * Set z to a + b, or to a - b if sub is set. Small operands are added
+ * natively unless the result overflows.
+ */
+static void big_add(IntervalBigInt *z, const IntervalBigInt *a, const IntervalBigInt *b, int sub)
+{
+  uint32_t ta[2], tb[2], stack[BIG_STACK], *t;
+  const uint32_t *ma, *mb;
+  int na, nb, nz, sa, sb, neg;
+  int64_t r;
+
+  if (a->n == 0 && b->n == 0 &&
+      !(sub ? __builtin_sub_overflow(a->v, b->v, &r) : __builtin_add_overflow(a->v, b->v, &r)))
+  {
+    z->n = 0;
+    z->v = r;
+    return;
+  }
+  na = big_mag(a, ta, &ma);
+  nb = big_mag(b, tb, &mb);
+  sa = big_sign(a);
+  sb = big_sign(b) ^ sub;
+  t = big_tmp(stack, MAX(na, nb) + 1);
+  if (sa == sb)
+  {
+    nz = mag_add(t, ma, na, mb, nb);
+    neg = sa;
+  }
+  else if (mag_cmp(ma, na, mb, nb) >= 0)
+  {
+    nz = mag_sub(t, ma, na, mb, nb);
+    neg = sa;
+  }
+  else
+  {
+    nz = mag_sub(t, mb, nb, ma, na);
+    neg = sb;
+  }
+  big_pack(z, neg, t, nz);
+  if (t != stack)
+  {
+    free(t);
+  }
+}
+
+/* big_mul:
+ * Set z to a * b. Small operands are multiplied natively unless the product
+ * overflows.
+ */
+static void big_mul(IntervalBigInt *z, const IntervalBigInt *a, const IntervalBigInt *b)
+{
+  uint32_t ta[2], tb[2], stack[BIG_STACK], *t;
+  const uint32_t *ma, *mb;
+  int na, nb, nz;
+  int64_t r;
+
+  if (a->n == 0 && b->n == 0 && !__builtin_mul_overflow(a->v, b->v, &r))
+  {
+    z->n = 0;
+    z->v = r;
+    return;
+  }
+  na = big_mag(a, ta, &ma);
+  nb = big_mag(b, tb, &mb);
+  t = big_tmp(stack, na + nb);
+  nz = mag_mul(t, ma, na, mb, nb);
+  big_pack(z, big_sign(a) ^ big_sign(b), t, nz);
+  if (t != stack)
+  {
+    free(t);
+  }
+}
+
+/* big_pow2:
+ * Set z to 2**k - 1 (if minus1 is set) or -(2**k).
+ */
+static void big_pow2(IntervalBigInt *z, int k, int minus1)
+{
+  uint32_t stack[BIG_STACK], *t, one = 1;
+  int n = k / 32 + 1;
+
+  t = big_tmp(stack, n);
+  memset(t, 0, (size_t)n * sizeof(uint32_t));
+  t[k / 32] = (uint32_t)1 << (k % 32);
+  if (minus1)
+  {
+    n = mag_sub(t, t, n, &one, 1);
+  }
+  big_pack(z, !minus1, t, n);
+  if (t != stack)
+  {
+    free(t);
+  }
+}
+
+/* big_bitlen:
+ * Return the number of significant bits of the magnitude of a.
+ */
+static int big_bitlen(const IntervalBigInt *a)
+{
+  uint32_t tmp[2];
+  const uint32_t *m;
+  int n = big_mag(a, tmp, &m);
+
+  return ((n == 0) ? 0 : 32 * (n - 1) + wide_bitlen64(m[n-1]));
+}
+
+/* big_print:
+ * Print a in decimal to outfile.
+ */
+static void big_print(FILE *outfile, const IntervalBigInt *a)
+{
+  uint32_t *m;
+
+  if (a->n == 0)
+  {
+    fprintf(outfile, "%" PRId64, a->v);
+    return;
+  }
+  m = wide_alloc(NULL, (size_t)a->n * sizeof(uint32_t));
+  memcpy(m, BIG_LIMBS(a), (size_t)a->n * sizeof(uint32_t));
+  mag_print(outfile, a->neg, m, a->n);
+  free(m);
+}
+
+/* IntervalBigInit, IntervalBigFree:
+ * Initialize z to [0,0] and free its memory (z may be initialized again).
+ */
+void IntervalBigInit(IntervalBig *z)
+{
+  big_init(&z->infm);
+  big_init(&z->supr);
+}
+
+void IntervalBigFree(IntervalBig *z)
+{
+  big_free(&z->infm);
+  big_free(&z->supr);
+}
+
+/* IntervalBigSet:
+ * Set z to [u,v].
+ */
+void IntervalBigSet(IntervalBig *z, int64_t u, int64_t v)
+{
+  z->infm.n = 0;
+  z->infm.v = u;
+  z->supr.n = 0;
+  z->supr.v = v;
+}
+
+/* IntervalBigCopy:
+ * Set z to x.
+ */
+void IntervalBigCopy(IntervalBig *z, const IntervalBig *x)
+{
+  big_copy(&z->infm, &x->infm);
+  big_copy(&z->supr, &x->supr);
+}
+
+/* IntervalBigToInterval64:
+ * Narrow interval x to 64-bit bounds in z; returns INTERVAL_OK, or
+ * INTERVAL_ERR_OVERFLOW if a bound was saturated.
+ */
+int IntervalBigToInterval64(Interval64 *z, const IntervalBig *x)
+{
+  int status = INTERVAL_OK;
+
+  z->infm = x->infm.v;
+  z->supr = x->supr.v;
+  if (x->infm.n > 0)
+  {
+    z->infm = x->infm.neg ? INT64_MIN : INT64_MAX;
+    status = INTERVAL_ERR_OVERFLOW;
+  }
+  if (x->supr.n > 0)
+  {
+    z->supr = x->supr.neg ? INT64_MIN : INT64_MAX;
+    status = INTERVAL_ERR_OVERFLOW;
+  }
+  return (status);
+}
+
+#ifdef INTERVAL_HAVE_INT128
+/* big_from128, big_to128:
+ * Conversions between 128-bit integers and IntervalBigInt; big_to128
+ * saturates and sets *status on overflow.
+ */
+static void big_from128(IntervalBigInt *a, IntervalInt128 v)
+{
+  uint32_t m[4];
+  int neg = int128_mag(v, m);
+
+  big_pack(a, neg, m, 4);
+}
+
+static IntervalInt128 big_to128(const IntervalBigInt *a, int *status)
+{
+  uint32_t tmp[2];
+  const uint32_t *m;
+  unsigned __int128 u = 0;
+  int i, n;
+
+  if (a->n == 0)
+  {
+    return (a->v);
+  }
+  n = big_mag(a, tmp, &m);
+  for (i = 0; i < n && i < 4; i++)
+  {
+    u |= (unsigned __int128)m[i] << (32 * i);
+  }
+  if (n > 4 || u > (unsigned __int128)INT128_MAX_ + a->neg)
+  {
+    *status = INTERVAL_ERR_OVERFLOW;
+    return (a->neg ? INT128_MIN_ : INT128_MAX_);
+  }
+  return (a->neg ? (IntervalInt128)(0 - u) : (IntervalInt128)u);
+}
+
+/* IntervalBigFromInterval128:
+ * Set z to interval x.
+ */
+void IntervalBigFromInterval128(IntervalBig *z, Interval128 x)
+{
+  big_from128(&z->infm, x.infm);
+  big_from128(&z->supr, x.supr);
+}
+
+/* IntervalBigToInterval128:
+ * Narrow interval x to 128-bit bounds in z; returns INTERVAL_OK, or
+ * INTERVAL_ERR_OVERFLOW if a bound was saturated.
+ */
+int IntervalBigToInterval128(Interval128 *z, const IntervalBig *x)
+{
+  int status = INTERVAL_OK;
+
+  z->infm = big_to128(&x->infm, &status);
+  z->supr = big_to128(&x->supr, &status);
+  return (status);
+}
+#endif /* INTERVAL_HAVE_INT128 */
+
+/* IntervalBigUniverse:
+ * Set z to the range of bw-bit integers (any bw >= 1): [0,2**bw-1] for
+ * unsigned or [-2**(bw-1),2**(bw-1)-1] for signed arithmetic. Returns
+ * INTERVAL_OK, INTERVAL_ERR_BITWIDTH or INTERVAL_ERR_ARITH_TYPE.
+ */
+int IntervalBigUniverse(IntervalBig *z, int bw, ArithType ztyp)
+{
+  if ((ztyp != UNSIGNED_ARITH && ztyp != SIGNED_ARITH) || bw <= 0)
+  {
+    IntervalBigSet(z, 1, 0);
+    return ((ztyp == UNSIGNED_ARITH || ztyp == SIGNED_ARITH) ?
+      INTERVAL_ERR_BITWIDTH : INTERVAL_ERR_ARITH_TYPE);
+  }
+  if (ztyp == UNSIGNED_ARITH)
+  {
+    z->infm.n = 0;
+    z->infm.v = 0;
+    big_pow2(&z->supr, bw, 1);
+  }
+  else
+  {
+    big_pow2(&z->infm, bw - 1, 0);
+    big_pow2(&z->supr, bw - 1, 1);
+  }
+  return (INTERVAL_OK);
+}
+
+/* IntervalBigAdd, IntervalBigSub, IntervalBigNeg:
+ * Interval addition, subtraction and negation with arbitrary-precision
+ * bounds; z may be the same as x or y.
+ */
+void IntervalBigAdd(IntervalBig *z, const IntervalBig *x, const IntervalBig *y)
+{
+  big_add(&z->infm, &x->infm, &y->infm, 0);
+  big_add(&z->supr, &x->supr, &y->supr, 0);
+}
+
+void IntervalBigSub(IntervalBig *z, const IntervalBig *x, const IntervalBig *y)
+{
+  IntervalBigInt t;
+  int64_t u, v;
+
+  if ((x->infm.n | x->supr.n | y->infm.n | y->supr.n) == 0 &&
+      !__builtin_sub_overflow(x->infm.v, y->supr.v, &u) &&
+      !__builtin_sub_overflow(x->supr.v, y->infm.v, &v))
+  {
+    IntervalBigSet(z, u, v);
+    return;
+  }
+  big_init(&t);
+  big_add(&t, &x->infm, &y->supr, 1);
+  big_add(&z->supr, &x->supr, &y->infm, 1);
+  big_copy(&z->infm, &t);
+  big_free(&t);
+}
+
+void IntervalBigNeg(IntervalBig *z, const IntervalBig *x)
+{
+  IntervalBigInt zero, t;
+
+  if ((x->infm.n | x->supr.n) == 0 && x->infm.v != INT64_MIN && x->supr.v != INT64_MIN)
+  {
+    IntervalBigSet(z, -x->supr.v, -x->infm.v);
+    return;
+  }
+  big_init(&zero);
+  big_init(&t);
+  big_add(&t, &zero, &x->supr, 1);
+  big_add(&z->supr, &zero, &x->infm, 1);
+  big_copy(&z->infm, &t);
+  big_free(&t);
+}
+
+/* IntervalBigMul:
+ * Interval multiplication with arbitrary-precision bounds, from the four
+ * products of the bounds; z may be the same as x or y. Small bounds whose
+ * products do not overflow are multiplied natively.
+ */
+void IntervalBigMul(IntervalBig *z, const IntervalBig *x, const IntervalBig *y)
+{
+  IntervalBigInt p[4];
+  int64_t a, b, c, d;
+  int k, lo = 0, hi = 0;
+
+  if ((x->infm.n | x->supr.n | y->infm.n | y->supr.n) == 0 &&
+      !__builtin_mul_overflow(x->infm.v, y->infm.v, &a) &&
+      !__builtin_mul_overflow(x->infm.v, y->supr.v, &b) &&
+      !__builtin_mul_overflow(x->supr.v, y->infm.v, &c) &&
+      !__builtin_mul_overflow(x->supr.v, y->supr.v, &d))
+  {
+    IntervalBigSet(z, MIN(MIN(a, b), MIN(c, d)), MAX(MAX(a, b), MAX(c, d)));
+    return;
+  }
+  for (k = 0; k < 4; k++)
+  {
+    big_init(&p[k]);
+  }
+  big_mul(&p[0], &x->infm, &y->infm);
+  big_mul(&p[1], &x->infm, &y->supr);
+  big_mul(&p[2], &x->supr, &y->infm);
+  big_mul(&p[3], &x->supr, &y->supr);
+  for (k = 1; k < 4; k++)
+  {
+    lo = (big_cmp(&p[k], &p[lo]) < 0) ? k : lo;
+    hi = (big_cmp(&p[k], &p[hi]) > 0) ? k : hi;
+  }
+  big_copy(&z->infm, &p[lo]);
+  big_copy(&z->supr, &p[hi]);
+  for (k = 0; k < 4; k++)
+  {
+    big_free(&p[k]);
+  }
+}
+
+/* IntervalBigUnion, IntervalBigIntersection:
+ * Interval hull and intersection ([1,0] if disjoint) with arbitrary-precision
+ * bounds; z may be the same as x or y.
+ */
+void IntervalBigUnion(IntervalBig *z, const IntervalBig *x, const IntervalBig *y)
+{
+  big_copy(&z->infm, (big_cmp(&y->infm, &x->infm) < 0) ? &y->infm : &x->infm);
+  big_copy(&z->supr, (big_cmp(&y->supr, &x->supr) > 0) ? &y->supr : &x->supr);
+}
+
+void IntervalBigIntersection(IntervalBig *z, const IntervalBig *x, const IntervalBig *y)
+{
+  if (IntervalBigIsEmpty(x) || IntervalBigIsEmpty(y) ||
+      big_cmp(&x->supr, &y->infm) < 0 || big_cmp(&y->supr, &x->infm) < 0)
+  {
+    IntervalBigSet(z, 1, 0);
+    return;
+  }
+  big_copy(&z->infm, (big_cmp(&y->infm, &x->infm) > 0) ? &y->infm : &x->infm);
+  big_copy(&z->supr, (big_cmp(&y->supr, &x->supr) < 0) ? &y->supr : &x->supr);
+}
+
+/* IntervalBigIsEmpty, ValueIsInIntervalBig:
+ * Queries with arbitrary-precision bounds; 1 if true, 0 otherwise.
+ */
+int IntervalBigIsEmpty(const IntervalBig *x)
+{
+  return (big_cmp(&x->infm, &x->supr) > 0);
+}
+
+int ValueIsInIntervalBig(const IntervalBig *x, int64_t v)
+{
+  IntervalBigInt a;
+
+  big_init(&a);
+  a.v = v;
+  return (big_cmp(&x->infm, &a) <= 0 && big_cmp(&a, &x->supr) <= 0);
+}
+
+/* IntervalBigToIntegerBitwidth:
+ * Return in n the bitwidth of interval x, the number of significant bits of
+ * supr - infm, as by IntervalToIntegerBitwidth. Returns INTERVAL_OK,
+ * INTERVAL_ERR_EMPTY or INTERVAL_ERR_ARITH_TYPE (with n = 0).
+ */
+int IntervalBigToIntegerBitwidth(int *n, const IntervalBig *x, ArithType xtyp)
+{
+  IntervalBigInt r;
+
+  *n = 0;
+  if (IntervalBigIsEmpty(x))
+  {
+    return (INTERVAL_ERR_EMPTY);
+  }
+  if (xtyp != UNSIGNED_ARITH && xtyp != SIGNED_ARITH)
+  {
+    return (INTERVAL_ERR_ARITH_TYPE);
+  }
+  big_init(&r);
+  big_add(&r, &x->supr, &x->infm, 1);
+  *n = big_bitlen(&r);
+  big_free(&r);
+  return (INTERVAL_OK);
+}
+
+/* IntervalBigPrint:
+ * Print interval x to outfile.
+ */
+void IntervalBigPrint(FILE *outfile, const IntervalBig *x)
+{
+  fprintf(outfile, "[");
+  big_print(outfile, &x->infm);
+  fprintf(outfile, ",");
+  big_print(outfile, &x->supr);
+  fprintf(outfile, "]");
+}
@@ -0,0 +1,128 @@
+/*
+ * Filename: interval-wide.h
+ * Purpose : Intervals with 64-bit, 128-bit and arbitrary-precision bounds.
+ *           Definitions and function prototypes.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.0 (26/10/16)
+ *           Initial version.
+ */
+#ifndef INTERVAL_WIDE_H
+#define INTERVAL_WIDE_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include "interval.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Interval64 is an interval with 64-bit bounds. */
+typedef struct {
+  int64_t supr;               /* Maximum (supremum) value bound */
+  int64_t infm;               /* Minimum (infimum) value bound */
+} Interval64;
+
+/* Interval128 is an interval with 128-bit bounds, where the compiler
+ * provides a 128-bit integer type (INTERVAL_HAVE_INT128 is then defined).
+ */
+#ifdef __SIZEOF_INT128__
+#define INTERVAL_HAVE_INT128
+typedef __int128 IntervalInt128;
+typedef struct {
+  IntervalInt128 supr;        /* Maximum (supremum) value bound */
+  IntervalInt128 infm;        /* Minimum (infimum) value bound */
+} Interval128;
+#endif
+
+/* Number of 32-bit limbs stored inline in an IntervalBigInt. */
+#define INTERVAL_BIG_INLINE  4
+
+/* IntervalBigInt is an arbitrary-precision integer. A value that fits in 64
+ * bits is held in v (n = 0) and operated on natively; wider values are held
+ * as a sign and a magnitude of n 32-bit limbs (least significant first),
+ * stored in buf up to INTERVAL_BIG_INLINE limbs and on the heap beyond.
+ */
+typedef struct {
+  int64_t v;                  /* Value, if n = 0 */
+  int n;                      /* Number of limbs of a wide value; 0 if small */
+  int neg;                    /* Sign of a wide value */
+  int cap;                    /* Number of limbs allocated in heap */
+  uint32_t *heap;             /* Limbs, if n > INTERVAL_BIG_INLINE */
+  uint32_t buf[INTERVAL_BIG_INLINE];  /* Limbs, if n <= INTERVAL_BIG_INLINE */
+} IntervalBigInt;
+
+/* IntervalBig is an interval with arbitrary-precision bounds. It must be
+ * initialized with IntervalBigInit and released with IntervalBigFree.
+ */
+typedef struct {
+  IntervalBigInt supr;        /* Maximum (supremum) value bound */
+  IntervalBigInt infm;        /* Minimum (infimum) value bound */
+} IntervalBig;
+
+/* Wide interval API. The functions returning int return an IntervalStatus
+ * code and their result through the first argument, as the checked API;
+ * bounds that overflow are saturated and INTERVAL_ERR_OVERFLOW is returned.
+ */
+Interval64 INTERVAL64(int64_t u, int64_t v);
+Interval64 Interval64FromInterval(Interval x);
+int Interval64ToInterval(Interval *z, Interval64 x);
+int Interval64Universe(Interval64 *z, int bw, ArithType ztyp);
+int Interval64Add(Interval64 *z, Interval64 x, Interval64 y);
+int Interval64Sub(Interval64 *z, Interval64 x, Interval64 y);
+int Interval64Neg(Interval64 *z, Interval64 x);
+int Interval64Mul(Interval64 *z, Interval64 x, Interval64 y);
+int Interval64Div(Interval64 *z, Interval64 x, Interval64 y);
+Interval64 Interval64Union(Interval64 x, Interval64 y);
+Interval64 Interval64Intersection(Interval64 x, Interval64 y);
+int Interval64IsEmpty(Interval64 x);
+int ValueIsInInterval64(Interval64 x, int64_t v);
+int Interval64ToIntegerBitwidth(int *n, Interval64 x, ArithType xtyp);
+void Interval64Print(FILE *outfile, Interval64 x);
+
+#ifdef INTERVAL_HAVE_INT128
+Interval128 INTERVAL128(IntervalInt128 u, IntervalInt128 v);
+Interval128 Interval128FromInterval64(Interval64 x);
+int Interval128ToInterval64(Interval64 *z, Interval128 x);
+int Interval128Universe(Interval128 *z, int bw, ArithType ztyp);
+int Interval128Add(Interval128 *z, Interval128 x, Interval128 y);
+int Interval128Sub(Interval128 *z, Interval128 x, Interval128 y);
+int Interval128Neg(Interval128 *z, Interval128 x);
+int Interval128Mul(Interval128 *z, Interval128 x, Interval128 y);
+int Interval128Div(Interval128 *z, Interval128 x, Interval128 y);
+Interval128 Interval128Union(Interval128 x, Interval128 y);
+Interval128 Interval128Intersection(Interval128 x, Interval128 y);
+int Interval128IsEmpty(Interval128 x);
+int ValueIsInInterval128(Interval128 x, IntervalInt128 v);
+int Interval128ToIntegerBitwidth(int *n, Interval128 x, ArithType xtyp);
+void Interval128Print(FILE *outfile, Interval128 x);
+#endif
+
+void IntervalBigInit(IntervalBig *z);
+void IntervalBigFree(IntervalBig *z);
+void IntervalBigSet(IntervalBig *z, int64_t u, int64_t v);
+void IntervalBigCopy(IntervalBig *z, const IntervalBig *x);
+int IntervalBigToInterval64(Interval64 *z, const IntervalBig *x);
+#ifdef INTERVAL_HAVE_INT128
+void IntervalBigFromInterval128(IntervalBig *z, Interval128 x);
+int IntervalBigToInterval128(Interval128 *z, const IntervalBig *x);
+#endif
+int IntervalBigUniverse(IntervalBig *z, int bw, ArithType ztyp);
+void IntervalBigAdd(IntervalBig *z, const IntervalBig *x, const IntervalBig *y);
+void IntervalBigSub(IntervalBig *z, const IntervalBig *x, const IntervalBig *y);
+void IntervalBigNeg(IntervalBig *z, const IntervalBig *x);
+void IntervalBigMul(IntervalBig *z, const IntervalBig *x, const IntervalBig *y);
+void IntervalBigUnion(IntervalBig *z, const IntervalBig *x, const IntervalBig *y);
+void IntervalBigIntersection(IntervalBig *z, const IntervalBig *x, const IntervalBig *y);
+int IntervalBigIsEmpty(const IntervalBig *x);
+int ValueIsInIntervalBig(const IntervalBig *x, int64_t v);
+int IntervalBigToIntegerBitwidth(int *n, const IntervalBig *x, ArithType xtyp);
+void IntervalBigPrint(FILE *outfile, const IntervalBig *x);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INTERVAL_WIDE_H */
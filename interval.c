@@ -6,8 +6,39 @@
  *           by H. Yamashita, H. Yasuura, F.N. Eko and C. Yun.
  * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
  *                                  2016
- * Date    : 20-Sep-2014
- * Revision: 0.2.0 (20/09/14)
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.6 (26/10/16)
+ *           IntervalExpInteger and IntervalSqrt are computed in integer 
+ *           arithmetic (exponentiation by squaring with overflow detection, 
+ *           bit-by-bit square root); IntervalExpInteger returns [0,max] for 
+ *           an even power of an interval containing zero. Added 
+ *           IntervalExpIntegerChecked.
+ *           0.3.5 (26/10/16)
+ *           Added the shift and bit-field operations: IntervalShl, IntervalShr, 
+ *           IntervalSra, IntervalTrunc, IntervalSext, IntervalZext, 
+ *           IntervalSlice and IntervalConcat, with their checked versions.
+ *           0.3.4 (26/10/16)
+ *           IntervalAnd, IntervalIor and IntervalXor return tight bounds, 
+ *           computed in constant time from the leading ones of the bounds 
+ *           (Warren's minOR/maxOR/minAND/maxAND); IntervalNot implemented.
+ *           0.3.3 (26/10/16)
+ *           Added the non-aborting (checked) API: IntervalUniverseChecked, 
+ *           IntervalMulChecked, IntervalDivChecked, IntervalModChecked, 
+ *           IntervalSetChecked, IntervalSqrtChecked, IntervalBalancedChecked, 
+ *           IntervalToIntegerBitwidthChecked, log2ceilChecked and 
+ *           IntervalStatusString. The aborting functions are implemented on 
+ *           top of them. IntervalUniverse now returns the computed interval.
+ *           0.3.2 (26/10/16)
+ *           log2ceil, ipow, IntervalBalanced, IntervalIsBalanced, 
+ *           IntegerBitwidthToInterval and IntervalToIntegerBitwidth are 
+ *           computed in constant time using count-leading-zeros and shifts.
+ *           0.3.1 (26/10/16)
+ *           Added IntervalAddWide, IntervalSubWide, IntervalNegWide, 
+ *           IntervalMulWide (64-bit intermediates with saturation).
+ *           0.3.0 (26/10/16)
+ *           All functions are declared INTERVAL_API, so that the file can be 
+ *           included by "interval.h" in INTERVAL_INLINE mode.
+ *           0.2.0 (20/09/14)
  *           Updated for github; self-contained version not depending on 
  *           external files (genmacros.h, utils.c, utils.h).
  *           0.1.2 (11/08/09)
@@ -31,14 +62,60 @@
 
 #include <stdio.h>
 #include <stdlib.h>
-#include <math.h>
+#include <limits.h>
+#include <stdint.h>
 #include "interval.h"
 
+/* Clz32: 
+ * Count the leading zero bits of a non-zero 32-bit value.
+ */
+static inline int Clz32(unsigned int v)
+{
+#if defined(__GNUC__)
+  return (__builtin_clz(v));
+#else
+  int n = 0;
+  if (v <= 0x0000FFFFU) { n += 16; v <<= 16; }
+  if (v <= 0x00FFFFFFU) { n +=  8; v <<=  8; }
+  if (v <= 0x0FFFFFFFU) { n +=  4; v <<=  4; }
+  if (v <= 0x3FFFFFFFU) { n +=  2; v <<=  2; }
+  if (v <= 0x7FFFFFFFU) { n +=  1; }
+  return (n);
+#endif
+}
+
+/* Smear32, Top32: 
+ * Return v with every bit below its leading one set, and the leading one of 
+ * v alone (0 for 0).
+ */
+static inline unsigned int Smear32(unsigned int v)
+{
+  return ((v == 0) ? 0U : 0xFFFFFFFFU >> Clz32(v));
+}
+
+static inline unsigned int Top32(unsigned int v)
+{
+  return ((v == 0) ? 0U : 0x80000000U >> Clz32(v));
+}
+
+/* Pow2: 
+ * Return 2**k as an unsigned value, with the same wrap-around behavior as 
+ * ipow(2,k) (1 for k <= 0, 0 for k >= 32).
+ */
+static inline unsigned int Pow2(int k)
+{
+  if (k <= 0)
+  {
+    return (1U);
+  }
+  return ((k < 32) ? (1U << k) : 0U);
+}
+
 /* INTERVAL: 
  * Construct an interval specified by a minimum (u) and a maximum (v) integer 
  * value. Values u and v are considered to be included in the interval. 
  */
-Interval INTERVAL(int u, int v)
+INTERVAL_API Interval INTERVAL(int u, int v)
 {
   Interval RV;
   RV.infm = u;
@@ -49,7 +126,7 @@ Interval INTERVAL(int u, int v)
 /* IntervalCopy: 
  * Return a copy of the given input interval.
  */
-Interval IntervalCopy(Interval x)
+INTERVAL_API Interval IntervalCopy(Interval x)
 {
   Interval z;
   z.supr = x.supr;
@@ -60,7 +137,7 @@ Interval IntervalCopy(Interval x)
 /* IntervalEmpty: 
  * Return an empty interval; interval [1,0] is produced.
  */
-Interval IntervalEmpty(void)
+INTERVAL_API Interval IntervalEmpty(void)
 {
   Interval z;
   z.supr = 0;
@@ -68,19 +145,31 @@ Interval IntervalEmpty(void)
   return (z);
 }
 
+/* IntervalUniverseChecked: 
+ * Non-aborting version of IntervalUniverse. The interval is returned in z; 
+ * INTERVAL_OK or INTERVAL_ERR_BITWIDTH (for a bitwidth outside [1,32]) is 
+ * returned.
+ */
+INTERVAL_API int IntervalUniverseChecked(Interval *z, int bw, ArithType ztyp)
+{
+  if (bw > 0 && bw <= 32)
+  {
+    *z = IntegerBitwidthToInterval(bw, ztyp);
+    return (INTERVAL_OK);
+  }
+  *z = IntervalEmpty();
+  return (INTERVAL_ERR_BITWIDTH);
+}
+
 /* IntervalUniverse: 
  * Returns the entire interval for a given arithmetic representation type (ztyp) 
  * and for the specified bitwidth (bw).
  */
-Interval IntervalUniverse(int bw, ArithType ztyp)
+INTERVAL_API Interval IntervalUniverse(int bw, ArithType ztyp)
 {
   Interval z;
   
-  if (bw > 0 && bw <= 32)
-  {
-    IntegerBitwidthToInterval(bw, ztyp);
-  }
-  else
+  if (IntervalUniverseChecked(&z, bw, ztyp) != INTERVAL_OK)
   {
     fprintf(stderr, "Error: Given maximum bitwidth should be less than or equal 32.\n");
     exit(1);
@@ -93,7 +182,7 @@ Interval IntervalUniverse(int bw, ArithType ztyp)
  * Return a saturated version of the given interval for the specified lower (lo)
  * and higher (hi) bounds.
  */
-Interval IntervalClamp(Interval x, int lo, int hi)
+INTERVAL_API Interval IntervalClamp(Interval x, int lo, int hi)
 {
   Interval z;
   z.supr = MIN(x.supr, hi);
@@ -104,7 +193,7 @@ Interval IntervalClamp(Interval x, int lo, int hi)
 /* IntervalAdd: 
  * Return the interval of the result of adding the intervals of two integers.
  */
-Interval IntervalAdd(Interval x, Interval y)
+INTERVAL_API Interval IntervalAdd(Interval x, Interval y)
 {
   Interval z;
   z.supr = x.supr + y.supr;
@@ -116,7 +205,7 @@ Interval IntervalAdd(Interval x, Interval y)
  * Return the interval of the result of performing subtraction on two integer 
  * intervals.
  */
-Interval IntervalSub(Interval x, Interval y)
+INTERVAL_API Interval IntervalSub(Interval x, Interval y)
 {
   Interval z;
   z.supr = x.supr - y.infm;
@@ -127,7 +216,7 @@ Interval IntervalSub(Interval x, Interval y)
 /* IntervalNeg: 
  * Return a negated interval by negating the supremum and infimum fields.
  */
-Interval IntervalNeg(Interval x)
+INTERVAL_API Interval IntervalNeg(Interval x)
 {
   Interval z;
   z.supr = -x.supr;
@@ -135,40 +224,56 @@ Interval IntervalNeg(Interval x)
   return (z);
 }
 
-/* IntervalMul: 
- * Return the interval of the result of performing multiplication on two integer 
- * intervals. The result is not truncated. xtyp, ytyp provide the arithmetic 
- * representation type for x and y, respectively.
+/* IntervalMulChecked: 
+ * Non-aborting version of IntervalMul. The product interval is returned in z; 
+ * INTERVAL_OK or INTERVAL_ERR_ARITH_TYPE is returned.
  */
-Interval IntervalMul(Interval x, Interval y, ArithType xtyp, ArithType ytyp)
+INTERVAL_API int IntervalMulChecked(Interval *z, Interval x, Interval y, ArithType xtyp, 
+  ArithType ytyp)
 {
-  Interval z;
-  
   if ((xtyp == UNSIGNED_ARITH) && 
       (ytyp == UNSIGNED_ARITH))
   {
-    z.supr = x.supr * y.supr;
-    z.infm = x.infm * y.infm;
+    z->supr = x.supr * y.supr;
+    z->infm = x.infm * y.infm;
   }
   else if ((xtyp == UNSIGNED_ARITH) && 
            (ytyp == SIGNED_ARITH || ytyp == SIGNED_POS_ARITH || ytyp == SIGNED_NEG_ARITH))
   {
-    z.supr = MAX(x.supr * y.supr, x.infm * y.supr);
-    z.infm = MIN(x.supr * y.infm, x.infm * y.infm);    
+    z->supr = MAX(x.supr * y.supr, x.infm * y.supr);
+    z->infm = MIN(x.supr * y.infm, x.infm * y.infm);    
   }
   else if ((xtyp == SIGNED_ARITH || xtyp == SIGNED_POS_ARITH || xtyp == SIGNED_NEG_ARITH) && 
            (ytyp == UNSIGNED_ARITH))
   {
-    z.supr = MAX(x.supr * y.supr, x.supr * y.infm);
-    z.infm = MIN(x.infm * y.supr, x.infm * y.infm);
+    z->supr = MAX(x.supr * y.supr, x.supr * y.infm);
+    z->infm = MIN(x.infm * y.supr, x.infm * y.infm);
   }
   else if ((xtyp == SIGNED_ARITH || xtyp == SIGNED_POS_ARITH || xtyp == SIGNED_NEG_ARITH) && 
            (ytyp == SIGNED_ARITH || ytyp == SIGNED_POS_ARITH || ytyp == SIGNED_NEG_ARITH))
   {
-    z.supr = MAX4(x.infm * y.infm, x.infm * y.supr, x.supr * y.infm, x.supr * y.supr);
-    z.infm = MIN4(x.infm * y.infm, x.infm * y.supr, x.supr * y.infm, x.supr * y.supr);
+    z->supr = MAX4(x.infm * y.infm, x.infm * y.supr, x.supr * y.infm, x.supr * y.supr);
+    z->infm = MIN4(x.infm * y.infm, x.infm * y.supr, x.supr * y.infm, x.supr * y.supr);
   }
   else
+  {
+    *z = IntervalEmpty();
+    return (INTERVAL_ERR_ARITH_TYPE);
+  }
+  
+  return (INTERVAL_OK);
+}
+
+/* IntervalMul: 
+ * Return the interval of the result of performing multiplication on two integer 
+ * intervals. The result is not truncated. xtyp, ytyp provide the arithmetic 
+ * representation type for x and y, respectively.
+ */
+INTERVAL_API Interval IntervalMul(Interval x, Interval y, ArithType xtyp, ArithType ytyp)
+{
+  Interval z;
+  
+  if (IntervalMulChecked(&z, x, y, xtyp, ytyp) != INTERVAL_OK)
   {
     fprintf(stderr, "Error: Unknown ArithType arithmetic representation.\n");
     exit(1);
@@ -177,33 +282,219 @@ Interval IntervalMul(Interval x, Interval y, ArithType xtyp, ArithType ytyp)
   return (z);
 }
 
+/* Helpers for the widened (64-bit intermediate) arithmetic kernels. The 
+ * min/max selections are computed with masks so that no branches are 
+ * generated in hot loops.
+ */
+static inline int64_t Min64(int64_t a, int64_t b)
+{
+  return (b ^ ((a ^ b) & -(int64_t)(a < b)));
+}
+
+static inline int64_t Max64(int64_t a, int64_t b)
+{
+  return (a ^ ((a ^ b) & -(int64_t)(a < b)));
+}
+
+/* SaturateInt64: 
+ * Saturate a 64-bit intermediate value to the range of int. ovf is set to 1 
+ * if the value had to be saturated; it is left unchanged otherwise.
+ */
+static inline int SaturateInt64(int64_t v, int *ovf)
+{
+  int64_t r = Max64(Min64(v, INT_MAX), INT_MIN);
+  *ovf |= (r != v);
+  return ((int)r);
+}
+
+/* IntervalAddWide: 
+ * Overflow-safe version of IntervalAdd. The bounds are computed with 64-bit 
+ * intermediates; a bound that does not fit in an int is saturated to INT_MIN 
+ * or INT_MAX. If ovf is not NULL, *ovf is set to 1 if any bound was 
+ * saturated and to 0 if the returned interval is exact.
+ */
+INTERVAL_API Interval IntervalAddWide(Interval x, Interval y, int *ovf)
+{
+  Interval z;
+  int o = 0;
+  z.supr = SaturateInt64((int64_t)x.supr + y.supr, &o);
+  z.infm = SaturateInt64((int64_t)x.infm + y.infm, &o);
+  if (ovf != NULL)
+  {
+    *ovf = o;
+  }
+  return (z);
+}
+
+/* IntervalSubWide: 
+ * Overflow-safe version of IntervalSub. See IntervalAddWide for the 
+ * semantics of ovf.
+ */
+INTERVAL_API Interval IntervalSubWide(Interval x, Interval y, int *ovf)
+{
+  Interval z;
+  int o = 0;
+  z.supr = SaturateInt64((int64_t)x.supr - y.infm, &o);
+  z.infm = SaturateInt64((int64_t)x.infm - y.supr, &o);
+  if (ovf != NULL)
+  {
+    *ovf = o;
+  }
+  return (z);
+}
+
+/* IntervalNegWide: 
+ * Overflow-safe version of IntervalNeg, returning [-supr,-infm]; -INT_MIN is 
+ * saturated to INT_MAX. See IntervalAddWide for the semantics of ovf.
+ */
+INTERVAL_API Interval IntervalNegWide(Interval x, int *ovf)
+{
+  Interval z;
+  int o = 0;
+  z.supr = SaturateInt64(-(int64_t)x.infm, &o);
+  z.infm = SaturateInt64(-(int64_t)x.supr, &o);
+  if (ovf != NULL)
+  {
+    *ovf = o;
+  }
+  return (z);
+}
+
+/* IntervalMulWide: 
+ * Overflow-safe version of IntervalMul. The partial products are computed 
+ * exactly in 64 bits and combined without branches; the resulting bounds are 
+ * saturated to the range of int. See IntervalAddWide for the semantics of 
+ * ovf. xtyp, ytyp provide the arithmetic representation type for x and y, 
+ * respectively; for an unknown ArithType, the empty interval is returned and 
+ * *ovf is set to 1.
+ */
+INTERVAL_API Interval IntervalMulWide(Interval x, Interval y, ArithType xtyp, ArithType ytyp, 
+  int *ovf)
+{
+  Interval z;
+  int64_t pii, pis, psi, pss, zs, zi;
+  int xsigned, ysigned;
+  int o = 0;
+
+  xsigned = (xtyp == SIGNED_ARITH || xtyp == SIGNED_POS_ARITH || xtyp == SIGNED_NEG_ARITH);
+  ysigned = (ytyp == SIGNED_ARITH || ytyp == SIGNED_POS_ARITH || ytyp == SIGNED_NEG_ARITH);
+  if ((!xsigned && xtyp != UNSIGNED_ARITH) || (!ysigned && ytyp != UNSIGNED_ARITH))
+  {
+    if (ovf != NULL)
+    {
+      *ovf = 1;
+    }
+    return (IntervalEmpty());
+  }
+
+  pii = (int64_t)x.infm * y.infm;
+  pis = (int64_t)x.infm * y.supr;
+  psi = (int64_t)x.supr * y.infm;
+  pss = (int64_t)x.supr * y.supr;
+
+  if (xsigned && ysigned)
+  {
+    zs = Max64(Max64(pii, pis), Max64(psi, pss));
+    zi = Min64(Min64(pii, pis), Min64(psi, pss));
+  }
+  else if (xsigned)
+  {
+    zs = Max64(pss, psi);
+    zi = Min64(pis, pii);
+  }
+  else if (ysigned)
+  {
+    zs = Max64(pss, pis);
+    zi = Min64(psi, pii);
+  }
+  else
+  {
+    zs = pss;
+    zi = pii;
+  }
+
+  z.supr = SaturateInt64(zs, &o);
+  z.infm = SaturateInt64(zi, &o);
+  if (ovf != NULL)
+  {
+    *ovf = o;
+  }
+  return (z);
+}
+
+/* IntervalDivChecked: 
+ * Non-aborting version of IntervalDiv. The quotient interval is returned in z; 
+ * INTERVAL_OK, INTERVAL_ERR_EMPTY (x or y is empty), INTERVAL_ERR_DIV_ZERO 
+ * (y contains zero), INTERVAL_ERR_OVERFLOW (INT_MIN / -1 is reachable) or 
+ * INTERVAL_ERR_ARITH_TYPE is returned.
+ */
+INTERVAL_API int IntervalDivChecked(Interval *z, Interval x, Interval y, ArithType xtyp, 
+  ArithType ytyp)
+{
+  int usgn = (xtyp == UNSIGNED_ARITH) && (ytyp == UNSIGNED_ARITH);
+  int sgn = (xtyp == SIGNED_ARITH || xtyp == SIGNED_POS_ARITH || xtyp == SIGNED_NEG_ARITH) && 
+            (ytyp == SIGNED_ARITH || ytyp == SIGNED_POS_ARITH || ytyp == SIGNED_NEG_ARITH);
+
+  *z = IntervalEmpty();
+  if (x.infm > x.supr || y.infm > y.supr)
+  {
+    return (INTERVAL_ERR_EMPTY);
+  }
+  else if (ValueIsInInterval(y, 0) == 1)
+  {
+    return (INTERVAL_ERR_DIV_ZERO);
+  }
+  else if (!usgn && !sgn)
+  {
+    return (INTERVAL_ERR_ARITH_TYPE);
+  }
+  else if (x.infm == INT_MIN && ValueIsInInterval(y, -1) == 1)
+  {
+    // INT_MIN / -1 does not fit in an int and traps on most targets.
+    return (INTERVAL_ERR_OVERFLOW);
+  }
+  
+  if (usgn)
+  {
+    z->infm = x.infm / y.supr;
+    z->supr = x.supr / y.infm;
+  }
+  else
+  {
+    z->supr = 
+      MAX4(x.infm / y.infm, x.infm / y.supr, x.supr / y.infm, x.supr / y.supr);
+    z->infm = 
+      MIN4(x.infm / y.infm, x.infm / y.supr, x.supr / y.infm, x.supr / y.supr);
+  }
+  
+  return (INTERVAL_OK);
+}
+
 /* IntervalDiv: 
  * Return the interval of the result of performing division (quotient only) 
  * between two integer intervals. xtyp, ytyp provide the arithmetic 
  * representation type for x and y, respectively.
  */
-Interval IntervalDiv(Interval x, Interval y, ArithType xtyp, ArithType ytyp)
+INTERVAL_API Interval IntervalDiv(Interval x, Interval y, ArithType xtyp, ArithType ytyp)
 {
   Interval z;
+  int status = IntervalDivChecked(&z, x, y, xtyp, ytyp);
   
-  if (ValueIsInInterval(y, 0) == 1)
+  if (status == INTERVAL_ERR_DIV_ZERO)
   {
     fprintf(stderr,"Error: Division with zero in IntervalDiv.\n");
     exit(1);
-  } else if ((xtyp == UNSIGNED_ARITH) && (ytyp == UNSIGNED_ARITH))
+  }
+  else if (status == INTERVAL_ERR_EMPTY)
   {
-    z.supr = x.infm / y.supr;
-    z.infm = x.supr / y.infm;
+    return (z);
   }
-  else if ((xtyp == SIGNED_ARITH || xtyp == SIGNED_POS_ARITH || xtyp == SIGNED_NEG_ARITH) && 
-           (ytyp == SIGNED_ARITH || ytyp == SIGNED_POS_ARITH || ytyp == SIGNED_NEG_ARITH))
+  else if (status == INTERVAL_ERR_OVERFLOW)
   {
-    z.supr = 
-      MAX4(x.infm / y.infm, x.infm / y.supr, x.supr / y.infm, x.supr / y.supr);
-    z.infm = 
-      MIN4(x.infm / y.infm, x.infm / y.supr, x.supr / y.infm, x.supr / y.supr);
+    fprintf(stderr,"Error: Division of INT_MIN by -1 in IntervalDiv.\n");
+    exit(1);
   }
-  else
+  else if (status != INTERVAL_OK)
   {
     fprintf(stderr, "Error: Unknown ArithType arithmetic representation.\n");
     exit(1);
@@ -212,25 +503,40 @@ Interval IntervalDiv(Interval x, Interval y, ArithType xtyp, ArithType ytyp)
   return (z);
 }
 
-/* IntervalMod: 
- * Return the interval of the result of performing the modulus on two integer 
- * intervals. xtyp provides the arithmetic representation type for x.
+/* IntervalModChecked: 
+ * Non-aborting version of IntervalMod. The interval is returned in z; 
+ * INTERVAL_OK or INTERVAL_ERR_ARITH_TYPE is returned.
  */
-Interval IntervalMod(Interval x, Interval y, ArithType xtyp)
+INTERVAL_API int IntervalModChecked(Interval *z, Interval x, Interval y, ArithType xtyp)
 {
-  Interval z;
-  
   if (xtyp == UNSIGNED_ARITH)
   {
-    z.supr = MAX(x.supr, MAX(y.supr,-y.infm)-1);
-    z.infm = 0;
+    z->supr = MAX(x.supr, MAX(y.supr,-y.infm)-1);
+    z->infm = 0;
   }
   else if (xtyp == SIGNED_ARITH)
   {
-    z.supr = MAX(MAX(x.supr,-x.infm),MAX(y.supr,-y.infm)-1);
-    z.infm = -MIN(MAX(x.supr,-x.infm),MAX(y.supr,-y.infm)-1);
+    z->supr = MAX(MAX(x.supr,-x.infm),MAX(y.supr,-y.infm)-1);
+    z->infm = -MIN(MAX(x.supr,-x.infm),MAX(y.supr,-y.infm)-1);
   }
   else
+  {
+    *z = IntervalEmpty();
+    return (INTERVAL_ERR_ARITH_TYPE);
+  }
+  
+  return (INTERVAL_OK);
+}
+
+/* IntervalMod: 
+ * Return the interval of the result of performing the modulus on two integer 
+ * intervals. xtyp provides the arithmetic representation type for x.
+ */
+INTERVAL_API Interval IntervalMod(Interval x, Interval y, ArithType xtyp)
+{
+  Interval z;
+  
+  if (IntervalModChecked(&z, x, y, xtyp) != INTERVAL_OK)
   {
     fprintf(stderr, "Error: Unknown ArithType arithmetic representation.\n");
     exit(1);
@@ -246,7 +552,7 @@ Interval IntervalMod(Interval x, Interval y, ArithType xtyp)
  * "<" (muxlt), "<=" (muxle), 
  * ">" (muxgt), ">=" (muxge)
  */
-Interval IntervalMux(Interval x, Interval y)
+INTERVAL_API Interval IntervalMux(Interval x, Interval y)
 {
   Interval z;
   z.supr = MAX(x.supr, y.supr);
@@ -254,6 +560,21 @@ Interval IntervalMux(Interval x, Interval y)
   return (z);
 }
 
+/* IntervalSetChecked: 
+ * Non-aborting version of IntervalSet. The interval is returned in z; 
+ * INTERVAL_OK or INTERVAL_ERR_EMPTY is returned.
+ */
+INTERVAL_API int IntervalSetChecked(Interval *z, Interval x, Interval y)
+{
+  if ((IntervalIsEmpty(x) == 0) && (IntervalIsEmpty(y) == 0))
+  {
+    *z = INTERVAL(0, 1);
+    return (INTERVAL_OK);
+  }
+  *z = IntervalEmpty();
+  return (INTERVAL_ERR_EMPTY);
+}
+
 /* IntervalSet: 
  * Return the interval of the result of z = x relop y, where relop is a 
  * relational operator: 
@@ -261,15 +582,11 @@ Interval IntervalMux(Interval x, Interval y)
  * "<" (setlt), "<=" (setle), 
  * ">" (setgt), ">=" (setge)
  */
-Interval IntervalSet(Interval x, Interval y)
+INTERVAL_API Interval IntervalSet(Interval x, Interval y)
 {
   Interval z;
 
-  if ((IntervalIsEmpty(x) == 0) && (IntervalIsEmpty(y) == 0))
-  {
-    z = INTERVAL(0, 1);
-  }
-  else
+  if (IntervalSetChecked(&z, x, y) != INTERVAL_OK)
   {
     fprintf(stderr, "Error: Empty input interval(s).\n");
     exit(1);
@@ -278,93 +595,702 @@ Interval IntervalSet(Interval x, Interval y)
   return (z);
 }
 
-/* IntervalAnd: 
- * Return the interval of the result of z = x AND y.
+/* The bounds of x OP y, for x in [a,b] and y in [c,d] with unsigned bounds, 
+ * follow H.S. Warren, "Hacker's Delight", section 4-3. Warren scans the bits 
+ * from the left for the first position where a bound can be changed; such a 
+ * position of a bound of x lies at or below the leading one of a ^ b (where 
+ * x leaves the common prefix of its bounds), so the scan reduces to the 
+ * leading one of a mask of candidate bits.
+ */
+
+/* MinOr32: 
+ * Minimum of x IOR y, for x in [a,b] and y in [c,d] (unsigned).
+ */
+static inline unsigned int MinOr32(unsigned int a, unsigned int b, 
+  unsigned int c, unsigned int d)
+{
+  unsigned int p = ~a & c & Smear32(a ^ b), q = a & ~c & Smear32(c ^ d);
+  unsigned int m = Top32(p | q), k = (m != 0) ? 0U - m : ~0U;
+
+  return (((p & m) ? (a & k) : a) | ((q & m) ? (c & k) : c));
+}
+
+/* MaxOr32: 
+ * Maximum of x IOR y, for x in [a,b] and y in [c,d] (unsigned).
+ */
+static inline unsigned int MaxOr32(unsigned int a, unsigned int b, 
+  unsigned int c, unsigned int d)
+{
+  unsigned int m = Top32(b & d & (Smear32(a ^ b) | Smear32(c ^ d)));
+
+  return (b | d | ((m != 0) ? m - 1 : 0U));
+}
+
+/* MinAnd32: 
+ * Minimum of x AND y, for x in [a,b] and y in [c,d] (unsigned).
+ */
+static inline unsigned int MinAnd32(unsigned int a, unsigned int b, 
+  unsigned int c, unsigned int d)
+{
+  unsigned int m = Top32(~a & ~c & (Smear32(a ^ b) | Smear32(c ^ d)));
+
+  return (a & c & ((m != 0) ? 0U - m : ~0U));
+}
+
+/* MaxAnd32: 
+ * Maximum of x AND y, for x in [a,b] and y in [c,d] (unsigned).
+ */
+static inline unsigned int MaxAnd32(unsigned int a, unsigned int b, 
+  unsigned int c, unsigned int d)
+{
+  unsigned int p = b & ~d & Smear32(a ^ b), q = ~b & d & Smear32(c ^ d);
+  unsigned int m = Top32(p | q);
+
+  return ((b | ((p & m) ? m - 1 : 0U)) & (d | ((q & m) ? m - 1 : 0U)));
+}
+
+/* IntervalBitwise: 
+ * Return the interval of z = x AND y (op = 0), x IOR y (op = 1) or x XOR y 
+ * (op = 2), or the empty interval if x or y is empty. The operands are split 
+ * into their negative and non-negative parts, within which the signed and 
+ * unsigned orders agree, and the bounds for every pair of parts are joined; 
+ * for intervals of non-negative (unsigned) values, a single pair remains.
  */
-Interval IntervalAnd(Interval x, Interval y)
+static inline Interval IntervalBitwise(Interval x, Interval y, int op)
 {
+  unsigned int xl[2], xh[2], yl[2], yh[2], lo, hi;
+  int i, j, nx = 0, ny = 0;
   Interval z;
-  z.supr = MAX(x.supr, y.supr);
-  z.infm = MIN(x.infm, y.infm);
+
+  if (x.infm > x.supr || y.infm > y.supr)
+  {
+    return (IntervalEmpty());
+  }
+  if (x.infm < 0)
+  {
+    xl[nx] = x.infm;
+    xh[nx++] = MIN(x.supr, -1);
+  }
+  if (x.supr >= 0)
+  {
+    xl[nx] = MAX(x.infm, 0);
+    xh[nx++] = x.supr;
+  }
+  if (y.infm < 0)
+  {
+    yl[ny] = y.infm;
+    yh[ny++] = MIN(y.supr, -1);
+  }
+  if (y.supr >= 0)
+  {
+    yl[ny] = MAX(y.infm, 0);
+    yh[ny++] = y.supr;
+  }
+  z.infm = INT_MAX;
+  z.supr = INT_MIN;
+  for (i = 0; i < nx; i++)
+  {
+    for (j = 0; j < ny; j++)
+    {
+      if (op == 0)
+      {
+        lo = MinAnd32(xl[i], xh[i], yl[j], yh[j]);
+        hi = MaxAnd32(xl[i], xh[i], yl[j], yh[j]);
+      }
+      else if (op == 1)
+      {
+        lo = MinOr32(xl[i], xh[i], yl[j], yh[j]);
+        hi = MaxOr32(xl[i], xh[i], yl[j], yh[j]);
+      }
+      else
+      {
+        // minXOR and maxXOR from the AND bounds of x AND NOT y and NOT x AND y
+        lo = MinAnd32(xl[i], xh[i], ~yh[j], ~yl[j]) | 
+             MinAnd32(~xh[i], ~xl[i], yl[j], yh[j]);
+        hi = MaxOr32(0, MaxAnd32(xl[i], xh[i], ~yh[j], ~yl[j]), 
+                     0, MaxAnd32(~xh[i], ~xl[i], yl[j], yh[j]));
+      }
+      z.infm = MIN(z.infm, (int)lo);
+      z.supr = MAX(z.supr, (int)hi);
+    }
+  }
   return (z);
 }
 
+/* IntervalAnd: 
+ * Return the interval of the result of z = x AND y. The bounds are tight, 
+ * for signed and unsigned (non-negative) intervals.
+ */
+INTERVAL_API Interval IntervalAnd(Interval x, Interval y)
+{
+  return (IntervalBitwise(x, y, 0));
+}
+
 /* IntervalIor: 
- * Return the interval of the result of z = x IOR y.
+ * Return the interval of the result of z = x IOR y. The bounds are tight, 
+ * for signed and unsigned (non-negative) intervals.
+ */
+INTERVAL_API Interval IntervalIor(Interval x, Interval y)
+{
+  return (IntervalBitwise(x, y, 1));
+}
+
+/* IntervalXor: 
+ * Return the interval of the result of z = x XOR y. The bounds are tight, 
+ * for signed and unsigned (non-negative) intervals.
+ */
+INTERVAL_API Interval IntervalXor(Interval x, Interval y)
+{
+  return (IntervalBitwise(x, y, 2));
+}
+
+/* IntervalNot: 
+ * Return the interval of the result of z = NOT x, i.e. [~supr,~infm].
  */
-Interval IntervalIor(Interval x, Interval y)
+INTERVAL_API Interval IntervalNot(Interval x)
 {
   Interval z;
-  z.supr = MAX(x.supr, y.supr);
-  z.infm = MIN(x.infm, y.infm);
+  z.supr = ~x.infm;
+  z.infm = ~x.supr;
   return (z);
 }
 
-/* IntervalXor: 
- * Return the interval of the result of z = x XOR y.
+/* Sra32, Shl64: 
+ * Arithmetic shift right of v by k, and v * 2**k in 64 bits (0 <= k <= 31).
+ */
+static inline int Sra32(int v, int k)
+{
+  return ((v < 0) ? ~(~v >> k) : (v >> k));
+}
+
+static inline int64_t Shl64(int v, int k)
+{
+  return ((int64_t)v * ((int64_t)1 << k));
+}
+
+/* IntervalShlChecked: 
+ * Non-aborting version of IntervalShl. The interval is returned in z; 
+ * INTERVAL_OK, INTERVAL_ERR_DOMAIN (shift amounts outside [0,31]) or 
+ * INTERVAL_ERR_OVERFLOW (result outside the int range) is returned.
+ */
+INTERVAL_API int IntervalShlChecked(Interval *z, Interval x, Interval y)
+{
+  int64_t lo, hi;
+
+  if (x.infm > x.supr || y.infm > y.supr)
+  {
+    *z = IntervalEmpty();
+    return (INTERVAL_OK);
+  }
+  if (y.infm < 0 || y.supr > 31)
+  {
+    *z = IntervalEmpty();
+    return (INTERVAL_ERR_DOMAIN);
+  }
+  // The infimum is shifted by the largest amount if negative, and the 
+  // supremum if positive; a constant amount needs a single shift of each.
+  lo = Shl64(x.infm, (x.infm < 0) ? y.supr : y.infm);
+  hi = Shl64(x.supr, (x.supr > 0) ? y.supr : y.infm);
+  if (lo < INT_MIN || hi > INT_MAX)
+  {
+    *z = IntervalEmpty();
+    return (INTERVAL_ERR_OVERFLOW);
+  }
+  z->infm = (int)lo;
+  z->supr = (int)hi;
+  return (INTERVAL_OK);
+}
+
+/* IntervalShl: 
+ * Return the interval of the result of z = x << y (x * 2**y), for shift 
+ * amounts y within [0,31]. The result is not truncated.
  */
-Interval IntervalXor(Interval x, Interval y)
+INTERVAL_API Interval IntervalShl(Interval x, Interval y)
 {
   Interval z;
-  z.supr = MAX(x.supr, y.supr);
-  z.infm = MIN(x.infm, y.infm);
+  int status = IntervalShlChecked(&z, x, y);
+  
+  if (status == INTERVAL_ERR_DOMAIN)
+  {
+    fprintf(stderr, "Error: Shift amount outside [0,31] in IntervalShl.\n");
+    exit(1);
+  }
+  else if (status != INTERVAL_OK)
+  {
+    fprintf(stderr, "Error: Result of IntervalShl overflows the int range.\n");
+    exit(1);
+  }
+  
   return (z);
 }
 
-/* IntervalNot: 
- * Return the interval of the result of z = NOT x.
+/* IntervalSraChecked: 
+ * Non-aborting version of IntervalSra. The interval is returned in z; 
+ * INTERVAL_OK or INTERVAL_ERR_DOMAIN (shift amounts outside [0,31]) is 
+ * returned.
  */
-Interval IntervalNot(Interval x)
+INTERVAL_API int IntervalSraChecked(Interval *z, Interval x, Interval y)
+{
+  if (x.infm > x.supr || y.infm > y.supr)
+  {
+    *z = IntervalEmpty();
+    return (INTERVAL_OK);
+  }
+  if (y.infm < 0 || y.supr > 31)
+  {
+    *z = IntervalEmpty();
+    return (INTERVAL_ERR_DOMAIN);
+  }
+  z->infm = Sra32(x.infm, (x.infm < 0) ? y.infm : y.supr);
+  z->supr = Sra32(x.supr, (x.supr < 0) ? y.supr : y.infm);
+  return (INTERVAL_OK);
+}
+
+/* IntervalSra: 
+ * Return the interval of the result of the arithmetic shift right z = x >> y 
+ * (floor(x / 2**y)), for shift amounts y within [0,31].
+ */
+INTERVAL_API Interval IntervalSra(Interval x, Interval y)
 {
   Interval z;
+  
+  if (IntervalSraChecked(&z, x, y) != INTERVAL_OK)
+  {
+    fprintf(stderr, "Error: Shift amount outside [0,31] in IntervalSra.\n");
+    exit(1);
+  }
+  
   return (z);
 }
 
-/* IntervalExpInteger: 
- * Return the interval of the result of z = x ** n (n-th integer power of x). 
- * n is an integer and its interval representation is [n,n].
+/* IntervalShrChecked: 
+ * Non-aborting version of IntervalShr. The interval is returned in z; 
+ * INTERVAL_OK, INTERVAL_ERR_DOMAIN (shift amounts outside [0,31], or 
+ * negative values for UNSIGNED_ARITH or SIGNED_POS_ARITH) or 
+ * INTERVAL_ERR_ARITH_TYPE is returned.
+ */
+INTERVAL_API int IntervalShrChecked(Interval *z, Interval x, Interval y, ArithType xtyp)
+{
+  int k;
+
+  if (xtyp != UNSIGNED_ARITH && xtyp != SIGNED_ARITH && 
+      xtyp != SIGNED_POS_ARITH && xtyp != SIGNED_NEG_ARITH)
+  {
+    *z = IntervalEmpty();
+    return (INTERVAL_ERR_ARITH_TYPE);
+  }
+  if (x.infm > x.supr || y.infm > y.supr)
+  {
+    *z = IntervalEmpty();
+    return (INTERVAL_OK);
+  }
+  if (y.infm < 0 || y.supr > 31 || 
+      (x.infm < 0 && (xtyp == UNSIGNED_ARITH || xtyp == SIGNED_POS_ARITH)))
+  {
+    *z = IntervalEmpty();
+    return (INTERVAL_ERR_DOMAIN);
+  }
+  // Fast path: for non-negative values, the same as the arithmetic shift
+  if (x.infm >= 0)
+  {
+    z->infm = x.infm >> y.supr;
+    z->supr = x.supr >> y.infm;
+    return (INTERVAL_OK);
+  }
+  z->infm = INT_MAX;
+  z->supr = INT_MIN;
+  if (x.supr >= 0)
+  {
+    z->infm = 0;
+    z->supr = x.supr >> y.infm;
+  }
+  // Negative values are shifted as unsigned; their representation grows 
+  // with the value and a shift by 0 leaves them negative.
+  if (y.supr > 0)
+  {
+    k = MAX(y.infm, 1);
+    z->infm = MIN(z->infm, (int)((unsigned int)x.infm >> y.supr));
+    z->supr = MAX(z->supr, (int)((unsigned int)MIN(x.supr, -1) >> k));
+  }
+  if (y.infm == 0)
+  {
+    z->infm = MIN(z->infm, x.infm);
+    z->supr = MAX(z->supr, MIN(x.supr, -1));
+  }
+  return (INTERVAL_OK);
+}
+
+/* IntervalShr: 
+ * Return the interval of the result of the logical shift right z = x >>> y, 
+ * for shift amounts y within [0,31]. Negative values of a SIGNED_ARITH or 
+ * SIGNED_NEG_ARITH interval are shifted in their 32-bit representation; 
+ * those of an n-bit value are shifted as IntervalShr(IntervalZext(x, n), y, 
+ * UNSIGNED_ARITH).
  */
-Interval IntervalExpInteger(Interval x, int n)
+INTERVAL_API Interval IntervalShr(Interval x, Interval y, ArithType xtyp)
 {
   Interval z;
+  int status = IntervalShrChecked(&z, x, y, xtyp);
+  
+  if (status == INTERVAL_ERR_DOMAIN)
+  {
+    fprintf(stderr, "Error: Shift amount or operand out of domain in IntervalShr.\n");
+    exit(1);
+  }
+  else if (status != INTERVAL_OK)
+  {
+    fprintf(stderr, "Error: Unknown ArithType arithmetic representation.\n");
+    exit(1);
+  }
   
-  // if n is even and a >= 0 or if n is odd
-  if ((!IS_ODD(n) && (x.infm >= 0)) || IS_ODD(n))
+  return (z);
+}
+
+/* IntervalTruncChecked: 
+ * Non-aborting version of IntervalTrunc. The interval is returned in z; 
+ * INTERVAL_OK, INTERVAL_ERR_BITWIDTH (n outside [1,32], or [1,31] for 
+ * UNSIGNED_ARITH) or INTERVAL_ERR_ARITH_TYPE is returned.
+ */
+INTERVAL_API int IntervalTruncChecked(Interval *z, Interval x, int n, ArithType ztyp)
+{
+  Interval u;
+  int64_t m, lo, hi;
+
+  if (ztyp != UNSIGNED_ARITH && ztyp != SIGNED_ARITH)
   {
-    z.supr = pow(x.supr, n);
-    z.infm = pow(x.infm, n);
+    *z = IntervalEmpty();
+    return (INTERVAL_ERR_ARITH_TYPE);
   }
-  // if n is even and b <= 0
-  else if ((!IS_ODD(n) && (x.supr <= 0)) || IS_ODD(n))
+  if (n > ((ztyp == UNSIGNED_ARITH) ? 31 : 32) || 
+      IntervalUniverseChecked(&u, n, ztyp) != INTERVAL_OK)
   {
-    z.supr = pow(x.infm, n);
-    z.infm = pow(x.supr, n);
+    *z = IntervalEmpty();
+    return (INTERVAL_ERR_BITWIDTH);
+  }
+  if (x.infm > x.supr)
+  {
+    *z = IntervalEmpty();
+    return (INTERVAL_OK);
+  }
+  // Fast path: the values fit in n bits and are left unchanged
+  if (x.infm >= u.infm && x.supr <= u.supr)
+  {
+    *z = x;
+    return (INTERVAL_OK);
+  }
+  // Otherwise the bounds wrap around modulo 2**n; the result is contiguous 
+  // only if both wrap to the same period of the n-bit range.
+  m = (int64_t)1 << n;
+  lo = u.infm + (((int64_t)x.infm - u.infm) & (m - 1));
+  hi = u.infm + (((int64_t)x.supr - u.infm) & (m - 1));
+  if ((int64_t)x.supr - x.infm < m && lo <= hi)
+  {
+    z->infm = (int)lo;
+    z->supr = (int)hi;
   }
-  // otherwise
   else
   {
-//    z.supr = POS_INFINITY;     // This is the ENTIRE interval [-INF,+INF]
-//    z.infm = NEG_INFINITY;
+    *z = u;
+  }
+  return (INTERVAL_OK);
+}
+
+/* IntervalTrunc: 
+ * Return the interval of x truncated to n bits, i.e. of the n-bit integer 
+ * of representation ztyp (SIGNED_ARITH or UNSIGNED_ARITH) with the n least 
+ * significant bits of x. Values that fit in n bits are unchanged.
+ */
+INTERVAL_API Interval IntervalTrunc(Interval x, int n, ArithType ztyp)
+{
+  Interval z;
+  int status = IntervalTruncChecked(&z, x, n, ztyp);
+  
+  if (status == INTERVAL_ERR_BITWIDTH)
+  {
+    fprintf(stderr, "Error: Bitwidth out of range in IntervalTrunc.\n");
+    exit(1);
+  }
+  else if (status != INTERVAL_OK)
+  {
+    fprintf(stderr, "Error: Integer representation should be SIGNED_ARITH or UNSIGNED_ARITH.\n");
+    exit(1);
   }
   
   return (z);
 }
 
-/* IntervalSqrt: 
- * Return the interval of the result of z = sqrt(x).
+/* IntervalSext: 
+ * Return the interval of the sign extension of the n-bit values of x (given 
+ * as either signed or unsigned n-bit integers), i.e. IntervalTrunc(x, n, 
+ * SIGNED_ARITH).
+ */
+INTERVAL_API Interval IntervalSext(Interval x, int n)
+{
+  return (IntervalTrunc(x, n, SIGNED_ARITH));
+}
+
+/* IntervalZext: 
+ * Return the interval of the zero extension of the n-bit values of x (given 
+ * as either signed or unsigned n-bit integers), i.e. IntervalTrunc(x, n, 
+ * UNSIGNED_ARITH).
+ */
+INTERVAL_API Interval IntervalZext(Interval x, int n)
+{
+  return (IntervalTrunc(x, n, UNSIGNED_ARITH));
+}
+
+/* IntervalSliceChecked: 
+ * Non-aborting version of IntervalSlice. The interval is returned in z; 
+ * INTERVAL_OK or INTERVAL_ERR_BITWIDTH (unless 0 <= lo <= hi <= 31 and 
+ * hi - lo < 31) is returned.
+ */
+INTERVAL_API int IntervalSliceChecked(Interval *z, Interval x, int hi, int lo)
+{
+  if (lo < 0 || hi < lo || hi > 31 || hi - lo >= 31)
+  {
+    *z = IntervalEmpty();
+    return (INTERVAL_ERR_BITWIDTH);
+  }
+  if (x.infm <= x.supr)
+  {
+    x.infm = Sra32(x.infm, lo);
+    x.supr = Sra32(x.supr, lo);
+  }
+  return (IntervalTruncChecked(z, x, hi - lo + 1, UNSIGNED_ARITH));
+}
+
+/* IntervalSlice: 
+ * Return the interval of the bit field x[hi:lo] (bits lo to hi of x), as an 
+ * unsigned integer of hi - lo + 1 bits.
+ */
+INTERVAL_API Interval IntervalSlice(Interval x, int hi, int lo)
+{
+  Interval z;
+  
+  if (IntervalSliceChecked(&z, x, hi, lo) != INTERVAL_OK)
+  {
+    fprintf(stderr, "Error: Bit field [%d:%d] out of range in IntervalSlice.\n", hi, lo);
+    exit(1);
+  }
+  
+  return (z);
+}
+
+/* IntervalConcatChecked: 
+ * Non-aborting version of IntervalConcat. The interval is returned in z; 
+ * INTERVAL_OK, INTERVAL_ERR_BITWIDTH (n outside [1,31]) or 
+ * INTERVAL_ERR_OVERFLOW (result outside the int range) is returned.
+ */
+INTERVAL_API int IntervalConcatChecked(Interval *z, Interval x, Interval y, int n)
+{
+  int64_t lo, hi;
+
+  if (n < 1 || n > 31)
+  {
+    *z = IntervalEmpty();
+    return (INTERVAL_ERR_BITWIDTH);
+  }
+  if (x.infm > x.supr || y.infm > y.supr)
+  {
+    *z = IntervalEmpty();
+    return (INTERVAL_OK);
+  }
+  // The low part does not overlap the shifted high part, so that the 
+  // concatenation is a sum of independent terms
+  IntervalTruncChecked(&y, y, n, UNSIGNED_ARITH);
+  lo = Shl64(x.infm, n) + y.infm;
+  hi = Shl64(x.supr, n) + y.supr;
+  if (lo < INT_MIN || hi > INT_MAX)
+  {
+    *z = IntervalEmpty();
+    return (INTERVAL_ERR_OVERFLOW);
+  }
+  z->infm = (int)lo;
+  z->supr = (int)hi;
+  return (INTERVAL_OK);
+}
+
+/* IntervalConcat: 
+ * Return the interval of the concatenation {x, y[n-1:0]}, i.e. of x shifted 
+ * left by n bits with the n least significant bits of y (zero-extended) 
+ * below.
  */
-Interval IntervalSqrt(Interval x)
+INTERVAL_API Interval IntervalConcat(Interval x, Interval y, int n)
 {
   Interval z;
+  int status = IntervalConcatChecked(&z, x, y, n);
+  
+  if (status == INTERVAL_ERR_BITWIDTH)
+  {
+    fprintf(stderr, "Error: Bitwidth out of range in IntervalConcat.\n");
+    exit(1);
+  }
+  else if (status != INTERVAL_OK)
+  {
+    fprintf(stderr, "Error: Result of IntervalConcat overflows the int range.\n");
+    exit(1);
+  }
+  
+  return (z);
+}
+
+/* Pow32: 
+ * Compute v ** n for n >= 0 by exponentiation by squaring, with 64-bit 
+ * intermediates. Returns INTERVAL_ERR_OVERFLOW if the result does not fit in 
+ * 32 bits; r is then undefined.
+ */
+static int Pow32(int v, int n, int *r)
+{
+  long long z = 1, b = v;
+  
+  while (n > 0)
+  {
+    if (n & 1)
+    {
+      z *= b;
+      if (z < INT_MIN || z > INT_MAX)
+      {
+        return (INTERVAL_ERR_OVERFLOW);
+      }
+    }
+    n >>= 1;
+    if (n > 0)
+    {
+      // b*b is a factor of the result (which is non-zero, since b is)
+      b *= b;
+      if (b > INT_MAX)
+      {
+        return (INTERVAL_ERR_OVERFLOW);
+      }
+    }
+  }
+  *r = (int)z;
+  return (INTERVAL_OK);
+}
+
+/* Sqrt32: 
+ * Store in ru and rv the integer square roots floor(sqrt(u)) and 
+ * floor(sqrt(v)) of u <= v, computed bit by bit from the leading bit pair of 
+ * v. The two roots are found in the same steps, which select with masks 
+ * rather than branches, whose outcomes would be unpredictable.
+ */
+static void Sqrt32(unsigned int u, unsigned int v, unsigned int *ru, 
+  unsigned int *rv)
+{
+  unsigned int p = 0, q = 0, b, t, m;
+  
+  for (b = (v == 0) ? 0U : 1U << ((31 - Clz32(v)) & ~1); b != 0; b >>= 2)
+  {
+    t = p + b;
+    m = 0U - (unsigned int)(u >= t);
+    u -= t & m;
+    p = (p >> 1) + (b & m);
+    t = q + b;
+    m = 0U - (unsigned int)(v >= t);
+    v -= t & m;
+    q = (q >> 1) + (b & m);
+  }
+  *ru = p;
+  *rv = q;
+}
+
+/* IntervalExpIntegerChecked: 
+ * Non-aborting version of IntervalExpInteger. The interval is returned in z; 
+ * INTERVAL_OK, INTERVAL_ERR_DOMAIN (n < 0) or INTERVAL_ERR_OVERFLOW (a value 
+ * of the result does not fit in 32 bits) is returned. An empty x gives the 
+ * empty interval.
+ */
+INTERVAL_API int IntervalExpIntegerChecked(Interval *z, Interval x, int n)
+{
+  int u = 0, v = 0;
+  
+  *z = IntervalEmpty();
+  if (n < 0)
+  {
+    return (INTERVAL_ERR_DOMAIN);
+  }
+  if (IntervalIsEmpty(x))
+  {
+    return (INTERVAL_OK);
+  }
+  if (Pow32(x.infm, n, &u) != INTERVAL_OK || Pow32(x.supr, n, &v) != INTERVAL_OK)
+  {
+    return (INTERVAL_ERR_OVERFLOW);
+  }
+  // if n is odd (or zero) or a >= 0
+  if (IS_ODD(n) || n == 0 || x.infm >= 0)
+  {
+    *z = INTERVAL(u, v);
+  }
+  // if n is even and b <= 0
+  else if (x.supr <= 0)
+  {
+    *z = INTERVAL(v, u);
+  }
+  // otherwise, n is even and x contains zero
+  else
+  {
+    *z = INTERVAL(0, MAX(u, v));
+  }
+  return (INTERVAL_OK);
+}
+
+/* IntervalExpInteger: 
+ * Return the interval of the result of z = x ** n (n-th integer power of x). 
+ * n is an integer and its interval representation is [n,n].
+ */
+INTERVAL_API Interval IntervalExpInteger(Interval x, int n)
+{
+  Interval z;
+  int status = IntervalExpIntegerChecked(&z, x, n);
+  
+  if (status == INTERVAL_ERR_DOMAIN)
+  {
+    fprintf(stderr,"Error: Negative exponent in IntervalExpInteger.\n");
+    exit(1);
+  }
+  if (status != INTERVAL_OK)
+  {
+    fprintf(stderr,"Error: Result of IntervalExpInteger overflows the int range.\n");
+    exit(1);
+  }
+  
+  return (z);
+}
+
+/* IntervalSqrtChecked: 
+ * Non-aborting version of IntervalSqrt. The interval is returned in z; 
+ * INTERVAL_OK or INTERVAL_ERR_DOMAIN (negative values in x) is returned.
+ */
+INTERVAL_API int IntervalSqrtChecked(Interval *z, Interval x)
+{
+  unsigned int p, q, r;
   
   // if all values in interval x are >= 0
   if ((x.infm >=0) && (x.supr >= 0))
   {
-    z.supr = CEILING(sqrt(x.supr));
-    z.infm = FLOOR(sqrt(x.infm));
+    Sqrt32((unsigned int)MIN(x.infm, x.supr), (unsigned int)MAX(x.infm, x.supr), 
+      &p, &q);
+    r = (x.infm <= x.supr) ? q : p;
+    z->supr = (int)(r + (r * r != (unsigned int)x.supr));
+    z->infm = (int)((x.infm <= x.supr) ? p : q);
+    return (INTERVAL_OK);
   }
   // otherwise
-  else
+  *z = IntervalEmpty();
+  return (INTERVAL_ERR_DOMAIN);
+}
+
+/* IntervalSqrt: 
+ * Return the interval of the result of z = sqrt(x), i.e. 
+ * [floor(sqrt(x.infm)),ceil(sqrt(x.supr))], computed exactly in integer 
+ * arithmetic.
+ */
+INTERVAL_API Interval IntervalSqrt(Interval x)
+{
+  Interval z;
+  
+  if (IntervalSqrtChecked(&z, x) != INTERVAL_OK)
   {
     fprintf(stderr,"Error: Cannot compute IntervalSqrt for a non-positive interval.\n");
     exit(1);
@@ -378,7 +1304,7 @@ Interval IntervalSqrt(Interval x)
  * x: 
  * z = abs(x).
  */
-Interval IntervalAbs(Interval x)
+INTERVAL_API Interval IntervalAbs(Interval x)
 {
   Interval z;
   z.supr = MAX(ABS(x.supr), ABS(x.infm));
@@ -391,7 +1317,7 @@ Interval IntervalAbs(Interval x)
  * x and y: 
  * z = max(x, y).
  */
-Interval IntervalMax(Interval x, Interval y)
+INTERVAL_API Interval IntervalMax(Interval x, Interval y)
 {
   Interval z;
   z.supr = MAX(x.supr, y.supr);
@@ -404,7 +1330,7 @@ Interval IntervalMax(Interval x, Interval y)
  * x and y: 
  * z = min(x, y).
  */
-Interval IntervalMin(Interval x, Interval y)
+INTERVAL_API Interval IntervalMin(Interval x, Interval y)
 {
   Interval z;
   z.supr = MIN(x.supr, y.supr);
@@ -417,7 +1343,7 @@ Interval IntervalMin(Interval x, Interval y)
  * contiguous interval) of intervals x and y. The union operator formally 
  * produces two distinct intervals.
  */
-Interval IntervalUnion(Interval x, Interval y)
+INTERVAL_API Interval IntervalUnion(Interval x, Interval y)
 {
   Interval z;
   z.supr = MAX(x.supr, y.supr);
@@ -430,7 +1356,7 @@ Interval IntervalUnion(Interval x, Interval y)
  * x and y is the empty interval, the [1,0] interval (the default empty 
  * interval) is returned.
  */
-Interval IntervalIntersection(Interval x, Interval y)
+INTERVAL_API Interval IntervalIntersection(Interval x, Interval y)
 {
   Interval z = IntervalEmpty();
   
@@ -455,7 +1381,7 @@ Interval IntervalIntersection(Interval x, Interval y)
  * Query whether the given value v is in interval x or not.
  * Returns 1 if v is in x; 0 otherwise. 
  */
-int ValueIsInInterval(Interval x, int v)
+INTERVAL_API int ValueIsInInterval(Interval x, int v)
 {
   int v_found = 0;
   
@@ -471,7 +1397,7 @@ int ValueIsInInterval(Interval x, int v)
  * Query whether the given interval is an empty set (i.e. containing no values).
  * Returns 1 if the interval x is empty; 0 otherwise. 
  */
-int IntervalIsEmpty(Interval x)
+INTERVAL_API int IntervalIsEmpty(Interval x)
 {
   int is_empty = 0;
   if (x.infm > x.supr)
@@ -486,7 +1412,7 @@ int IntervalIsEmpty(Interval x)
  * domain of positive integers). The interval may contain integer ZERO.
  * Returns 1 if the interval x is positive; 0 otherwise. 
  */
-int IntervalIsPositive(Interval x)
+INTERVAL_API int IntervalIsPositive(Interval x)
 {
   int is_positive = 0;
   if ((x.infm >= 0) && (x.supr >= 0))
@@ -501,7 +1427,7 @@ int IntervalIsPositive(Interval x)
  * domain of negative integers). The interval may contain integer ZERO.
  * Returns 1 if the interval x is negative; 0 otherwise. 
  */
-int IntervalIsNegative(Interval x)
+INTERVAL_API int IntervalIsNegative(Interval x)
 {
   int is_negative = 0;
   if ((x.infm <= 0) && (x.supr <= 0))
@@ -515,12 +1441,53 @@ int IntervalIsNegative(Interval x)
  * Convert a given integer value v to a degenerate interval of the form [v,v].
  * Returns the computed interval. 
  */
-Interval ValueToInterval(int v)
+INTERVAL_API Interval ValueToInterval(int v)
 {
   Interval z = INTERVAL(v,v);
   return (z);
 }
 
+/* IntervalBalancedChecked: 
+ * Non-aborting version of IntervalBalanced. The interval is returned in z; 
+ * INTERVAL_OK, INTERVAL_ERR_DOMAIN (a zero bound, for which no enclosing power 
+ * of two exists) or INTERVAL_ERR_ARITH_TYPE is returned.
+ */
+INTERVAL_API int IntervalBalancedChecked(Interval *z, Interval x, ArithType xtyp)
+{
+  int n, m;
+  
+  if ((xtyp == UNSIGNED_ARITH) && (IntervalIsPositive(x) == 1))
+  {
+    if (log2ceilChecked(&n, x.supr) != INTERVAL_OK)
+    {
+      *z = IntervalEmpty();
+      return (INTERVAL_ERR_DOMAIN);
+    }
+    z->supr = (int)(Pow2(n) - 1);
+    z->infm = 0;
+  }
+  else if (xtyp == SIGNED_ARITH)
+  {
+    // 2**n is the larger of the powers of two enclosing |x.supr| and |x.infm|.
+    if (log2ceilChecked(&n, ABS(x.supr)) != INTERVAL_OK || 
+        log2ceilChecked(&m, ABS(x.infm)) != INTERVAL_OK)
+    {
+      *z = IntervalEmpty();
+      return (INTERVAL_ERR_DOMAIN);
+    }
+    n = MAX(n, m);
+    z->supr = (int)(Pow2(n) - 1);
+    z->infm = (int)(-(int64_t)Pow2(n));
+  }
+  else
+  {
+    *z = IntervalEmpty();
+    return (INTERVAL_ERR_ARITH_TYPE);
+  }
+  
+  return (INTERVAL_OK);
+}
+
 /* IntervalBalanced: 
  * Given an "unbalanced" interval (of the form [m,n], where m!=n and m,n>0 or 
  * m<0<=n and |m|=n+1), it is converted to a "balanced" interval of the form 
@@ -528,23 +1495,17 @@ Interval ValueToInterval(int v)
  * arithmetic.
  * xtyp provides the arithmetic type for the assumed integer arithmetic.
  */
-Interval IntervalBalanced(Interval x, ArithType xtyp)
+INTERVAL_API Interval IntervalBalanced(Interval x, ArithType xtyp)
 {
   Interval z;
-  int n;
+  int status = IntervalBalancedChecked(&z, x, xtyp);
   
-  if ((xtyp == UNSIGNED_ARITH) && (IntervalIsPositive(x) == 1))
-  {
-    z.supr = ABS(pow(2,log2ceil(x.supr))) - 1;
-    z.infm = 0;
-  }
-  else if (xtyp == SIGNED_ARITH)
+  if (status == INTERVAL_ERR_DOMAIN)
   {
-    n = MAX(pow(2,log2ceil(ABS(x.supr))),pow(2,log2ceil(ABS(x.infm))));
-    z.supr = pow(2,log2ceil(n)) - 1;
-    z.infm = -pow(2,log2ceil(n));
+    fprintf(stderr, "Error: Result of log2 computation is MINUS_INFINITY.\n");
+    exit(1);
   }
-  else
+  else if (status != INTERVAL_OK)
   {
     fprintf(stderr, "Error: Unknown ArithType arithmetic representation.\n");
     exit(1);
@@ -558,13 +1519,15 @@ Interval IntervalBalanced(Interval x, ArithType xtyp)
  * [-2**(n-1),2**(n-1)+1] for signed integer arithmetic.
  * Returns 1 if the interval x is balanced; 0 otherwise. 
  */
-int IntervalIsBalanced(Interval x, ArithType xtyp)
+INTERVAL_API int IntervalIsBalanced(Interval x, ArithType xtyp)
 {
   int is_balanced = 0;
+  int64_t m;
   
   if (xtyp == UNSIGNED_ARITH)
   {
-    if ((x.infm == 0) && (x.supr == pow(2,IntervalToIntegerBitwidth(x, xtyp))-1))
+    m = (int64_t)1 << IntervalToIntegerBitwidth(x, xtyp);
+    if ((x.infm == 0) && (x.supr == m - 1))
     {
       is_balanced = 1;
     }
@@ -575,8 +1538,8 @@ int IntervalIsBalanced(Interval x, ArithType xtyp)
   }
   else if (xtyp == SIGNED_ARITH)
   {
-    if ((x.infm == -pow(2,IntervalToIntegerBitwidth(x, xtyp))) && 
-        (x.supr == pow(2,IntervalToIntegerBitwidth(x, xtyp))-1))
+    m = (int64_t)1 << IntervalToIntegerBitwidth(x, xtyp);
+    if ((x.infm == -m) && (x.supr == m - 1))
     {
       is_balanced = 1;
     }
@@ -601,7 +1564,7 @@ int IntervalIsBalanced(Interval x, ArithType xtyp)
  * NOTE: For non-exact arithmetic representations, the comparison operation 
  * should be carefully designed.
  */
-int IntervalIsSymmetric(Interval x)
+INTERVAL_API int IntervalIsSymmetric(Interval x)
 {
   int is_symmetric = 0;
   
@@ -620,72 +1583,102 @@ int IntervalIsSymmetric(Interval x)
  * integer. 
  * xtyp provides the arithmetic type for the assumed integer.
  */
-Interval IntegerBitwidthToInterval(int n, ArithType xtyp)
+INTERVAL_API Interval IntegerBitwidthToInterval(int n, ArithType xtyp)
 { 
-  // FIXME: pow vs ipow (06/05/2010)
   Interval z;
   if (xtyp == UNSIGNED_ARITH)
   {
-    z.supr = ipow(2,n) - 1;
+    z.supr = (int)(Pow2(n) - 1);
     z.infm = 0;
   }
   else
   {
-    z.supr = ipow(2,n-1) - 1;
-    z.infm = -ipow(2,n-1);
+    z.supr = (int)(Pow2(n-1) - 1);
+    z.infm = (int)(0U - Pow2(n-1));
   }
   
   return (z);
 }
 
-/* IntervalToIntegerBitwidth: 
- * Convert the given interval to the corresponding minimum bitwidth necessary 
- * for the representation of signed (2's complement) or unsigned integers. 
- * xtyp provides the arithmetic type for the assumed integer representation.
+/* IntervalToIntegerBitwidthChecked: 
+ * Non-aborting version of IntervalToIntegerBitwidth. The bitwidth is returned 
+ * in n (0 on error); INTERVAL_OK, INTERVAL_ERR_EMPTY or INTERVAL_ERR_ARITH_TYPE 
+ * is returned.
  */
-int IntervalToIntegerBitwidth(Interval x, ArithType xtyp)
+INTERVAL_API int IntervalToIntegerBitwidthChecked(int *n, Interval x, ArithType xtyp)
 {
-  int n;
-  int xrange;
+  unsigned int xrange;
   
-  // Calculate the value range of the interval.
+  *n = 0;
   if (IntervalIsEmpty(x) == 1)
   {
-    xrange = 0;
+    return (INTERVAL_ERR_EMPTY);
   }
-  else 
+  // Compute the bitwidth for unsigned and signed integer representation.
+  if ((xtyp != UNSIGNED_ARITH) && (xtyp != SIGNED_ARITH))
   {
-    xrange = x.supr - x.infm + 1;
+    return (INTERVAL_ERR_ARITH_TYPE);
   }
+  // Find the binary logarithm (integer ceiling) of the range of interval x,
+  // i.e. the bit length of (range - 1), which always fits in 32 bits.
+  xrange = (unsigned int)x.supr - (unsigned int)x.infm;
+  *n = (xrange == 0) ? 0 : 32 - Clz32(xrange);
+
+  return (INTERVAL_OK);  
+}
+
+/* IntervalToIntegerBitwidth: 
+ * Convert the given interval to the corresponding minimum bitwidth necessary 
+ * for the representation of signed (2's complement) or unsigned integers. 
+ * xtyp provides the arithmetic type for the assumed integer representation.
+ */
+INTERVAL_API int IntervalToIntegerBitwidth(Interval x, ArithType xtyp)
+{
+  int n;
+  int status = IntervalToIntegerBitwidthChecked(&n, x, xtyp);
   
-  if (xrange == 0)
+  if (status == INTERVAL_ERR_EMPTY)
   {
-    n = 0;
     fprintf(stderr, "Error: Unable to compute bitwidth for an empty interval.\n");
     exit(1);
   }
-  else
+  else if (status != INTERVAL_OK)
   {
-    // Compute the bitwidth for unsigned and signed integer representation.
-    if ((xtyp == UNSIGNED_ARITH) || (xtyp == SIGNED_ARITH))
-    {
-      // Find the binary logarithm (integer ceiling) of the range of interval x.
-      n = log2ceil(xrange);
-    }
-    else
-    {
-      fprintf(stderr, "Error: Integer representation should be SIGNED_ARITH or UNSIGNED_ARITH.\n");
-      exit(1);
-    }
+    fprintf(stderr, "Error: Integer representation should be SIGNED_ARITH or UNSIGNED_ARITH.\n");
+    exit(1);
   }
 
   return (n);  
 }
 
+/* IntervalStatusString: 
+ * Return a printable description of the given status code. For a mask of 
+ * several conditions, the description of the lowest set flag is returned.
+ */
+INTERVAL_API const char *IntervalStatusString(int status)
+{
+  if (status == INTERVAL_OK)
+    return ("No error");
+  else if (status & INTERVAL_ERR_DIV_ZERO)
+    return ("Division with zero");
+  else if (status & INTERVAL_ERR_EMPTY)
+    return ("Empty input interval");
+  else if (status & INTERVAL_ERR_DOMAIN)
+    return ("Input outside the domain of the operation");
+  else if (status & INTERVAL_ERR_ARITH_TYPE)
+    return ("Unknown ArithType arithmetic representation");
+  else if (status & INTERVAL_ERR_BITWIDTH)
+    return ("Bitwidth out of range");
+  else if (status & INTERVAL_ERR_OVERFLOW)
+    return ("Result overflows the int range");
+  else
+    return ("Invalid argument");
+}
+
 /* IntervalPrint: 
  * Print the specified interval to outfile. 
  */
-void IntervalPrint(FILE *outfile, Interval x)
+INTERVAL_API void IntervalPrint(FILE *outfile, Interval x)
 {
   fprintf(outfile, "[%d,%d]", x.infm, x.supr);
 //  fprintf(outfile, "[%dll,%dll]", x.infm, x.supr);
@@ -693,49 +1686,64 @@ void IntervalPrint(FILE *outfile, Interval x)
 
 /* utils.c: Functions ported from utils.c. */
 
+/* log2ceilChecked:
+ * Non-aborting version of log2ceil. The logarithm is returned in logval (0 on 
+ * error); INTERVAL_OK or INTERVAL_ERR_DOMAIN (inpval <= 0) is returned.
+ */
+INTERVAL_API int log2ceilChecked(int *logval, int inpval)
+{
+  *logval = 0;
+  if (inpval <= 0) {
+    return (INTERVAL_ERR_DOMAIN);
+  }
+  // inpval is positive: the bit length of (inpval - 1)
+  if (inpval > 1) {
+    *logval = 32 - Clz32((unsigned int)inpval - 1);
+  }
+  // exponent that gives (2^logval) >= inpval
+  return (INTERVAL_OK);
+}
+
 /* log2ceil:
  * Function to calculate the ceiling of the binary logarithm of a given positive 
  * integer n.
  */
-int log2ceil(int inpval)
+INTERVAL_API int log2ceil(int inpval)
 {
-  unsigned int max = 1; // exp=0 => max=2^0=1
-  unsigned int logval = 0;
+  int logval;
 
-  if (inpval < 0) {
-    fprintf(stderr, "Error: Result of log2 computation is NAN.\n");
-    exit(1);
-  }
-  else if (inpval == 0) {
-    fprintf(stderr, "Error: Result of log2 computation is MINUS_INFINITY.\n");
-    exit(1);
-  }
-  // inpval is positive
-  else {
-    // log computation loop
-    while (max < inpval) {
-      // increment exponent
-      logval = logval + 1;
-      //  max = 2^logval
-      max = max * 2;
+  if (log2ceilChecked(&logval, inpval) != INTERVAL_OK) {
+    if (inpval < 0) {
+      fprintf(stderr, "Error: Result of log2 computation is NAN.\n");
     }
+    else {
+      fprintf(stderr, "Error: Result of log2 computation is MINUS_INFINITY.\n");
+    }
+    exit(1);
   }
-  // exponent that gives (2^logval) >= inpval
   return (logval);
 }
 
 /* ipow:
- * Simple approach to compute an integer powering function.
+ * Compute an integer powering function. Powers of two are computed in constant 
+ * time by a shift; other bases use exponentiation by squaring. The result 
+ * wraps around modulo 2**32 on overflow.
  */
-int ipow(int base, int exponent)
+INTERVAL_API int ipow(int base, int exponent)
 {
-  int temp;
-  int i;
+  unsigned int temp = 1;
+  unsigned int b = (unsigned int)base;
   
-  temp = 1;  
-  for (i = 0; i < exponent; i++) {
-     temp *= base; 
+  if (base == 2) {
+    return ((int)Pow2(exponent));
+  }
+  while (exponent > 0) {
+    if (exponent & 1) {
+      temp *= b;
+    }
+    b *= b;
+    exponent >>= 1;
   }
-  return (temp);
+  return ((int)temp);
 }
 
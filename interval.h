@@ -3,8 +3,22 @@
  * Purpose : Interval ADT definitions and function prototypes.
  * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
  *                                  2016
- * Date    : 28-Oct-2014
- * Revision: 0.2.1 (14/10/28)
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.6 (26/10/16)
+ *           Added IntervalExpIntegerChecked.
+ *           0.3.5 (26/10/16)
+ *           Added the shift and bit-field operations.
+ *           0.3.4 (26/10/16)
+ *           Pointed to the wide intervals of "interval-wide.h".
+ *           0.3.3 (26/10/16)
+ *           Added extern "C" guards for C++.
+ *           0.3.2 (26/10/16)
+ *           Added IntervalStatus and the non-aborting (checked) API.
+ *           0.3.1 (26/10/16)
+ *           Added the overflow-safe (widened) arithmetic kernels.
+ *           0.3.0 (26/10/16)
+ *           Added the INTERVAL_INLINE header-only mode.
+ *           0.2.1 (14/10/28)
  *           Added names to prototype parameters.
  *           0.2.0 (14/09/20)
  *           Added code from genmacros.h and utils.h in order to be 
@@ -16,6 +30,22 @@
 #ifndef INTERVAL_H
 #define INTERVAL_H
 
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Defining INTERVAL_INLINE before including "interval.h" makes the whole 
+ * API static inline; "interval.c" is then included by this header and does 
+ * not need to be compiled and linked separately.
+ */
+#ifdef INTERVAL_INLINE
+#define INTERVAL_API static inline
+#else
+#define INTERVAL_API
+#endif
+
 /* genmacros.h: Arithmetic processing macros. */
 #define IS_ODD(x)         ((x) & 0x1)
 #define ABS(x)            ((x) >  0 ? (x) : (-x))
@@ -30,12 +60,13 @@
 #define CEILING(x)        ((x)==FLOOR(x) ? FLOOR(x) : SIGNUM(x)+FLOOR(x))
 
 /* Ported from utils.h: Function prototypes. */
-int   log2ceil(int);
-int   ipow(int, int);
+INTERVAL_API int   log2ceil(int);
+INTERVAL_API int   log2ceilChecked(int *, int);
+INTERVAL_API int   ipow(int, int);
 
 /* Struct definition of the interval entity. 
- * NOTE: The int should be replaced at a later point by an arbitrary-sized 
- * integer data type.
+ * NOTE: Intervals with 64-bit, 128-bit and arbitrary-precision bounds are 
+ * provided by "interval-wide.h".
  */
 typedef struct { 
   int supr;        /* Minimum (infimum) value bound of the interval. */
@@ -51,41 +82,97 @@ typedef enum {
   SIGNED_NEG_ARITH            /* Signed and guaranteed to be negative */
 } ArithType;
 
+/* IntervalStatus enumerates the error conditions reported by the non-aborting 
+ * (checked) API. The conditions are bit flags, so that the errors met over a 
+ * batch of operations can be accumulated in a mask.
+ */
+typedef enum {
+  INTERVAL_OK             = 0x00,    /* No error */
+  INTERVAL_ERR_DIV_ZERO   = 0x01,    /* Divisor interval contains zero */
+  INTERVAL_ERR_EMPTY      = 0x02,    /* Empty input interval */
+  INTERVAL_ERR_DOMAIN     = 0x04,    /* Input outside the operation domain */
+  INTERVAL_ERR_ARITH_TYPE = 0x08,    /* Unknown/unsupported ArithType */
+  INTERVAL_ERR_BITWIDTH   = 0x10,    /* Bitwidth out of range */
+  INTERVAL_ERR_OVERFLOW   = 0x20,    /* Result overflows the int range */
+  INTERVAL_ERR_INVALID    = 0x40     /* Invalid opcode or argument */
+} IntervalStatus;
+
 /* Interval ADT API */
-Interval INTERVAL(int u, int v);
-Interval IntervalCopy(Interval x);
-Interval IntervalEmpty(void);
-Interval IntervalUniverse(int bw, ArithType ztyp);
-Interval IntervalClamp(Interval x, int lo, int hi);
-Interval IntervalAdd(Interval x, Interval y);
-Interval IntervalSub(Interval x, Interval y);
-Interval IntervalNeg(Interval x);
-Interval IntervalMul(Interval x, Interval y, ArithType xtyp, ArithType ytyp);
-Interval IntervalDiv(Interval x, Interval y, ArithType xtyp, ArithType ytyp);
-Interval IntervalMod(Interval x, Interval y, ArithType xtyp);
-Interval IntervalMux(Interval x, Interval y);
-Interval IntervalSet(Interval x, Interval y);
-Interval IntervalAnd(Interval x, Interval y);
-Interval IntervalIor(Interval x, Interval y);
-Interval IntervalXor(Interval x, Interval y);
-Interval IntervalNot(Interval x);
-Interval IntervalExpInteger(Interval x, int n);
-Interval IntervalSqrt(Interval x);
-Interval IntervalAbs(Interval x);
-Interval IntervalMax(Interval x, Interval y);
-Interval IntervalMin(Interval x, Interval y);
-Interval IntervalUnion(Interval x, Interval y);
-Interval IntervalIntersection(Interval x, Interval y);
-int      ValueIsInInterval(Interval x, int v);
-int      IntervalIsEmpty(Interval x);
-int      IntervalIsPositive(Interval x);
-int      IntervalIsNegative(Interval x);
-Interval ValueToInterval(int v);
-Interval IntervalBalanced(Interval x, ArithType xtyp);
-int      IntervalIsBalanced(Interval x, ArithType xtyp);
-int      IntervalIsSymmetric(Interval x);
-Interval IntegerBitwidthToInterval(int n, ArithType xtyp);
-int      IntervalToIntegerBitwidth(Interval x, ArithType xtyp);
-void     IntervalPrint(FILE *outfile, Interval x);
+INTERVAL_API Interval INTERVAL(int u, int v);
+INTERVAL_API Interval IntervalCopy(Interval x);
+INTERVAL_API Interval IntervalEmpty(void);
+INTERVAL_API Interval IntervalUniverse(int bw, ArithType ztyp);
+INTERVAL_API Interval IntervalClamp(Interval x, int lo, int hi);
+INTERVAL_API Interval IntervalAdd(Interval x, Interval y);
+INTERVAL_API Interval IntervalSub(Interval x, Interval y);
+INTERVAL_API Interval IntervalNeg(Interval x);
+INTERVAL_API Interval IntervalMul(Interval x, Interval y, ArithType xtyp, ArithType ytyp);
+INTERVAL_API Interval IntervalAddWide(Interval x, Interval y, int *ovf);
+INTERVAL_API Interval IntervalSubWide(Interval x, Interval y, int *ovf);
+INTERVAL_API Interval IntervalNegWide(Interval x, int *ovf);
+INTERVAL_API Interval IntervalMulWide(Interval x, Interval y, ArithType xtyp, ArithType ytyp, int *ovf);
+INTERVAL_API Interval IntervalDiv(Interval x, Interval y, ArithType xtyp, ArithType ytyp);
+INTERVAL_API Interval IntervalMod(Interval x, Interval y, ArithType xtyp);
+INTERVAL_API Interval IntervalMux(Interval x, Interval y);
+INTERVAL_API Interval IntervalSet(Interval x, Interval y);
+INTERVAL_API Interval IntervalAnd(Interval x, Interval y);
+INTERVAL_API Interval IntervalIor(Interval x, Interval y);
+INTERVAL_API Interval IntervalXor(Interval x, Interval y);
+INTERVAL_API Interval IntervalNot(Interval x);
+INTERVAL_API Interval IntervalShl(Interval x, Interval y);
+INTERVAL_API Interval IntervalShr(Interval x, Interval y, ArithType xtyp);
+INTERVAL_API Interval IntervalSra(Interval x, Interval y);
+INTERVAL_API Interval IntervalTrunc(Interval x, int n, ArithType ztyp);
+INTERVAL_API Interval IntervalSext(Interval x, int n);
+INTERVAL_API Interval IntervalZext(Interval x, int n);
+INTERVAL_API Interval IntervalSlice(Interval x, int hi, int lo);
+INTERVAL_API Interval IntervalConcat(Interval x, Interval y, int n);
+INTERVAL_API Interval IntervalExpInteger(Interval x, int n);
+INTERVAL_API Interval IntervalSqrt(Interval x);
+INTERVAL_API Interval IntervalAbs(Interval x);
+INTERVAL_API Interval IntervalMax(Interval x, Interval y);
+INTERVAL_API Interval IntervalMin(Interval x, Interval y);
+INTERVAL_API Interval IntervalUnion(Interval x, Interval y);
+INTERVAL_API Interval IntervalIntersection(Interval x, Interval y);
+INTERVAL_API int      ValueIsInInterval(Interval x, int v);
+INTERVAL_API int      IntervalIsEmpty(Interval x);
+INTERVAL_API int      IntervalIsPositive(Interval x);
+INTERVAL_API int      IntervalIsNegative(Interval x);
+INTERVAL_API Interval ValueToInterval(int v);
+INTERVAL_API Interval IntervalBalanced(Interval x, ArithType xtyp);
+INTERVAL_API int      IntervalIsBalanced(Interval x, ArithType xtyp);
+INTERVAL_API int      IntervalIsSymmetric(Interval x);
+INTERVAL_API Interval IntegerBitwidthToInterval(int n, ArithType xtyp);
+INTERVAL_API int      IntervalToIntegerBitwidth(Interval x, ArithType xtyp);
+INTERVAL_API void     IntervalPrint(FILE *outfile, Interval x);
+
+/* Non-aborting (checked) Interval ADT API. The result is returned through the 
+ * first argument; the return value is an IntervalStatus code. On error, the 
+ * empty interval [1,0] (or zero) is returned as the result.
+ */
+INTERVAL_API int      IntervalUniverseChecked(Interval *z, int bw, ArithType ztyp);
+INTERVAL_API int      IntervalMulChecked(Interval *z, Interval x, Interval y, ArithType xtyp, ArithType ytyp);
+INTERVAL_API int      IntervalDivChecked(Interval *z, Interval x, Interval y, ArithType xtyp, ArithType ytyp);
+INTERVAL_API int      IntervalModChecked(Interval *z, Interval x, Interval y, ArithType xtyp);
+INTERVAL_API int      IntervalSetChecked(Interval *z, Interval x, Interval y);
+INTERVAL_API int      IntervalExpIntegerChecked(Interval *z, Interval x, int n);
+INTERVAL_API int      IntervalSqrtChecked(Interval *z, Interval x);
+INTERVAL_API int      IntervalShlChecked(Interval *z, Interval x, Interval y);
+INTERVAL_API int      IntervalShrChecked(Interval *z, Interval x, Interval y, ArithType xtyp);
+INTERVAL_API int      IntervalSraChecked(Interval *z, Interval x, Interval y);
+INTERVAL_API int      IntervalTruncChecked(Interval *z, Interval x, int n, ArithType ztyp);
+INTERVAL_API int      IntervalSliceChecked(Interval *z, Interval x, int hi, int lo);
+INTERVAL_API int      IntervalConcatChecked(Interval *z, Interval x, Interval y, int n);
+INTERVAL_API int      IntervalBalancedChecked(Interval *z, Interval x, ArithType xtyp);
+INTERVAL_API int      IntervalToIntegerBitwidthChecked(int *n, Interval x, ArithType xtyp);
+INTERVAL_API const char *IntervalStatusString(int status);
+
+#ifdef INTERVAL_INLINE
+#include "interval.c"
+#endif
+
+#ifdef __cplusplus
+}
+#endif
 
 #endif /* INTERVAL_H */
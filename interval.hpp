@@ -0,0 +1,687 @@
+/*
+ * Filename: interval.hpp
+ * Purpose : C++ interface to the interval ADT. interval::Interval<T, A> holds
+ *           the bounds as integers of type T and fixes the arithmetic
+ *           representation A at compile time, so that the ArithType dispatch
+ *           of IntervalMul, IntervalDiv, IntervalMod and IntervalBalanced is
+ *           resolved by the compiler and every operation is constexpr. The
+ *           results match the C API, except for negation, whose C version
+ *           swaps the bounds of the result; where
+ *           the C API aborts or reports an error (division by an interval
+ *           containing zero, unsupported representations), the empty
+ *           interval is returned, as by the checked (non-aborting) C API.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.1 (26/10/16)
+ *           Added And, Ior, Xor and Not.
+ *           0.3.0 (26/10/16)
+ *           Initial version.
+ */
+#ifndef INTERVAL_HPP
+#define INTERVAL_HPP
+
+#include <limits>
+#include <type_traits>
+#include "interval.h"
+
+#if __cplusplus < 201703L
+#error "interval.hpp requires C++17 or later."
+#endif
+
+namespace interval {
+
+/* IsSigned is true for the signed representations of ArithType. */
+template <ArithType A>
+constexpr bool IsSigned = (A == SIGNED_ARITH || A == SIGNED_POS_ARITH ||
+                           A == SIGNED_NEG_ARITH);
+
+/* JoinArith is the representation of the result of an operation on operands
+ * of representations A and B: signed if either operand is signed.
+ */
+template <ArithType A, ArithType B>
+constexpr ArithType JoinArith = (IsSigned<A> || IsSigned<B>) ? SIGNED_ARITH
+                                                             : UNSIGNED_ARITH;
+
+namespace detail {
+
+/* min2, max2, min4, max4:
+ * Branch-free (conditional move) minimum and maximum selections.
+ */
+template <typename T>
+constexpr T min2(T a, T b)
+{
+  return ((b < a) ? b : a);
+}
+
+template <typename T>
+constexpr T max2(T a, T b)
+{
+  return ((a < b) ? b : a);
+}
+
+template <typename T>
+constexpr T min4(T a, T b, T c, T d)
+{
+  return (min2(min2(a, b), min2(c, d)));
+}
+
+template <typename T>
+constexpr T max4(T a, T b, T c, T d)
+{
+  return (max2(max2(a, b), max2(c, d)));
+}
+
+/* bitlen:
+ * Return the number of significant bits of u (0 for 0).
+ */
+template <typename U>
+constexpr int bitlen(U u)
+{
+  int n = 0;
+
+  while (u != 0)
+  {
+    u >>= 1;
+    n++;
+  }
+  return (n);
+}
+
+/* isqrt:
+ * Return the integer square root (floor) of v >= 0.
+ */
+template <typename T>
+constexpr T isqrt(T v)
+{
+  using U = std::make_unsigned_t<T>;
+  U r = 0, b = (v == 0) ? U(0) : U(1) << ((bitlen(U(v)) - 1) & ~1), x = U(v);
+
+  for (; b != 0; b >>= 2)
+  {
+    if (x >= r + b)
+    {
+      x -= r + b;
+      r = (r >> 1) + b;
+    }
+    else
+    {
+      r >>= 1;
+    }
+  }
+  return (T(r));
+}
+
+/* ipow:
+ * Return v ** n for n >= 0, by exponentiation by squaring.
+ */
+template <typename T>
+constexpr T ipow(T v, int n)
+{
+  T z = 1;
+
+  while (n > 0)
+  {
+    if (n & 1)
+    {
+      z *= v;
+    }
+    n >>= 1;
+    if (n > 0)
+    {
+      v *= v;
+    }
+  }
+  return (z);
+}
+
+/* smear:
+ * Set every bit below the leading one of u, in a fixed number of shifts.
+ */
+template <typename U>
+constexpr U smear(U u)
+{
+  for (int k = 1; k < int(sizeof(U) * 8); k <<= 1)
+  {
+    u |= U(u >> k);
+  }
+  return (u);
+}
+
+/* min_or, max_or, min_and, max_and:
+ * Unsigned bounds of x IOR y and x AND y, for x in [a,b] and y in [c,d], as 
+ * by MinOr32, MaxOr32, MinAnd32 and MaxAnd32 in interval.c; low holds the 
+ * bits below the position where a bound is changed, if any.
+ */
+template <typename U>
+constexpr U min_or(U a, U b, U c, U d)
+{
+  U p = U(~a & c & smear(U(a ^ b))), q = U(a & ~c & smear(U(c ^ d)));
+  U s = smear(U(p | q)), low = U(s >> 1), m = U(s ^ low);
+
+  return (U(((p & m) ? U(a & ~low) : a) | ((q & m) ? U(c & ~low) : c)));
+}
+
+template <typename U>
+constexpr U max_or(U a, U b, U c, U d)
+{
+  U s = smear(U(b & d & (smear(U(a ^ b)) | smear(U(c ^ d)))));
+
+  return (U(b | d | (s >> 1)));
+}
+
+template <typename U>
+constexpr U min_and(U a, U b, U c, U d)
+{
+  U s = smear(U(~a & ~c & (smear(U(a ^ b)) | smear(U(c ^ d)))));
+
+  return (U(a & c & ~(s >> 1)));
+}
+
+template <typename U>
+constexpr U max_and(U a, U b, U c, U d)
+{
+  U p = U(b & ~d & smear(U(a ^ b))), q = U(~b & d & smear(U(c ^ d)));
+  U s = smear(U(p | q)), low = U(s >> 1), m = U(s ^ low);
+
+  return (U((b | ((p & m) ? low : U(0))) & (d | ((q & m) ? low : U(0)))));
+}
+
+/* bitwise:
+ * Store in [lo,hi] the bounds of x AND y (op = 0), x IOR y (op = 1) or 
+ * x XOR y (op = 2) for x in [a,b] and y in [c,d], as by IntervalBitwise in 
+ * interval.c: from the unsigned bounds for every pair of the negative and 
+ * non-negative parts of x and y. Returns false if x or y is empty.
+ */
+template <typename T>
+constexpr bool bitwise(T a, T b, T c, T d, int op, T &lo, T &hi)
+{
+  using U = std::make_unsigned_t<T>;
+  U xl[2] = {U(a), U(max2(a, T(0)))}, xh[2] = {U(min2(b, T(-1))), U(b)};
+  U yl[2] = {U(c), U(max2(c, T(0)))}, yh[2] = {U(min2(d, T(-1))), U(d)};
+  bool xv[2] = {a < 0, b >= 0}, yv[2] = {c < 0, d >= 0};
+  U l = 0, h = 0;
+
+  if (a > b || c > d)
+  {
+    return (false);
+  }
+  lo = std::numeric_limits<T>::max();
+  hi = std::numeric_limits<T>::min();
+  for (int i = 0; i < 2; i++)
+  {
+    for (int j = 0; j < 2; j++)
+    {
+      if (!xv[i] || !yv[j])
+      {
+        continue;
+      }
+      if (op == 0)
+      {
+        l = min_and(xl[i], xh[i], yl[j], yh[j]);
+        h = max_and(xl[i], xh[i], yl[j], yh[j]);
+      }
+      else if (op == 1)
+      {
+        l = min_or(xl[i], xh[i], yl[j], yh[j]);
+        h = max_or(xl[i], xh[i], yl[j], yh[j]);
+      }
+      else
+      {
+        l = U(min_and(xl[i], xh[i], U(~yh[j]), U(~yl[j])) |
+              min_and(U(~xh[i]), U(~xl[i]), yl[j], yh[j]));
+        h = max_or(U(0), max_and(xl[i], xh[i], U(~yh[j]), U(~yl[j])),
+                   U(0), max_and(U(~xh[i]), U(~xl[i]), yl[j], yh[j]));
+      }
+      lo = min2(lo, T(l));
+      hi = max2(hi, T(h));
+    }
+  }
+  return (true);
+}
+
+} /* namespace detail */
+
+/* Interval<T, A> is an interval [infm,supr] of integers of type T in the
+ * arithmetic representation A; [1,0] is the default empty interval.
+ */
+template <typename T, ArithType A = SIGNED_ARITH>
+struct Interval {
+  static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>,
+                "Interval bounds must be of an integer type.");
+  static_assert(A != UNKNOWN_ARITH_TYPE,
+                "Unknown ArithType arithmetic representation.");
+
+  using value_type = T;
+  static constexpr ArithType arith = A;
+
+  T infm;                     /* Minimum (infimum) value bound */
+  T supr;                     /* Maximum (supremum) value bound */
+
+  constexpr Interval() : infm(1), supr(0) {}
+  constexpr Interval(T u, T v) : infm(u), supr(v) {}
+  constexpr explicit Interval(::Interval x) : infm(T(x.infm)), supr(T(x.supr)) {}
+
+  /* Empty, Value, Universe:
+   * Return the empty interval, [v,v] and the range of bw-bit integers of
+   * representation A (empty for a bw outside [1, number of bits of T]).
+   */
+  static constexpr Interval Empty()
+  {
+    return (Interval());
+  }
+
+  static constexpr Interval Value(T v)
+  {
+    return (Interval(v, v));
+  }
+
+  static constexpr Interval Universe(int bw)
+  {
+    using U = std::make_unsigned_t<T>;
+    constexpr int bits = int(sizeof(T) * 8);
+    U m = 0;
+
+    if (bw <= 0 || bw > bits)
+    {
+      return (Empty());
+    }
+    // m has the low bw bits set.
+    m = U(~U(0)) >> (bits - bw);
+    if constexpr (A == UNSIGNED_ARITH)
+    {
+      return (Interval(T(0), T(m)));
+    }
+    else
+    {
+      return (Interval(T(~(m >> 1)), T(m >> 1)));
+    }
+  }
+
+  /* IsEmpty, Contains, IsPositive, IsNegative, IsSymmetric:
+   * Queries as by the corresponding C functions.
+   */
+  constexpr bool IsEmpty() const
+  {
+    return (infm > supr);
+  }
+
+  constexpr bool Contains(T v) const
+  {
+    return (infm <= v && v <= supr);
+  }
+
+  constexpr bool IsPositive() const
+  {
+    return (infm >= 0 && supr >= 0);
+  }
+
+  constexpr bool IsNegative() const
+  {
+    return (infm <= 0 && supr <= 0);
+  }
+
+  constexpr bool IsSymmetric() const
+  {
+    return (infm == -supr);
+  }
+
+  /* Bitwidth:
+   * Return the bitwidth of the interval as by IntervalToIntegerBitwidth (0
+   * for an empty interval).
+   */
+  constexpr int Bitwidth() const
+  {
+    using U = std::make_unsigned_t<T>;
+
+    return (IsEmpty() ? 0 : detail::bitlen(U(U(supr) - U(infm))));
+  }
+
+  /* Clamp:
+   * Return the interval saturated to [lo,hi].
+   */
+  constexpr Interval Clamp(T lo, T hi) const
+  {
+    return (Interval(detail::max2(infm, lo), detail::min2(supr, hi)));
+  }
+
+  /* ToC:
+   * Return the interval as a C Interval (the bounds are converted to int).
+   */
+  constexpr ::Interval ToC() const
+  {
+    ::Interval z = { int(supr), int(infm) };
+    return (z);
+  }
+
+  constexpr bool operator==(const Interval &y) const
+  {
+    return (infm == y.infm && supr == y.supr);
+  }
+
+  constexpr bool operator!=(const Interval &y) const
+  {
+    return (!(*this == y));
+  }
+};
+
+/* Add, Sub, Neg:
+ * Interval addition, subtraction and negation, as by IntervalAdd and
+ * IntervalSub; Neg returns [-supr,-infm].
+ */
+template <typename T, ArithType A, ArithType B>
+constexpr Interval<T, JoinArith<A, B>> Add(Interval<T, A> x, Interval<T, B> y)
+{
+  return (Interval<T, JoinArith<A, B>>(x.infm + y.infm, x.supr + y.supr));
+}
+
+template <typename T, ArithType A, ArithType B>
+constexpr Interval<T, JoinArith<A, B>> Sub(Interval<T, A> x, Interval<T, B> y)
+{
+  return (Interval<T, JoinArith<A, B>>(x.infm - y.supr, x.supr - y.infm));
+}
+
+template <typename T, ArithType A>
+constexpr Interval<T, A> Neg(Interval<T, A> x)
+{
+  return (Interval<T, A>(T(-x.supr), T(-x.infm)));
+}
+
+/* Mul:
+ * Interval multiplication, as by IntervalMul; the products to consider are
+ * selected at compile time from the representations of x and y.
+ */
+template <typename T, ArithType A, ArithType B>
+constexpr Interval<T, JoinArith<A, B>> Mul(Interval<T, A> x, Interval<T, B> y)
+{
+  using Z = Interval<T, JoinArith<A, B>>;
+
+  if constexpr (!IsSigned<A> && !IsSigned<B>)
+  {
+    return (Z(x.infm * y.infm, x.supr * y.supr));
+  }
+  else if constexpr (!IsSigned<A>)
+  {
+    return (Z(detail::min2(x.supr * y.infm, x.infm * y.infm),
+              detail::max2(x.supr * y.supr, x.infm * y.supr)));
+  }
+  else if constexpr (!IsSigned<B>)
+  {
+    return (Z(detail::min2(x.infm * y.supr, x.infm * y.infm),
+              detail::max2(x.supr * y.supr, x.supr * y.infm)));
+  }
+  else
+  {
+    return (Z(detail::min4(x.infm * y.infm, x.infm * y.supr, x.supr * y.infm, x.supr * y.supr),
+              detail::max4(x.infm * y.infm, x.infm * y.supr, x.supr * y.infm, x.supr * y.supr)));
+  }
+}
+
+/* Div:
+ * Interval division (quotient only), as by IntervalDiv; unsigned quotients
+ * are [x.infm/y.supr, x.supr/y.infm]. The empty interval is returned if y
+ * contains zero or if only one of x and y is signed (for which IntervalDiv
+ * reports an unknown representation).
+ */
+template <typename T, ArithType A, ArithType B>
+constexpr Interval<T, JoinArith<A, B>> Div(Interval<T, A> x, Interval<T, B> y)
+{
+  using Z = Interval<T, JoinArith<A, B>>;
+
+  if (y.Contains(T(0)))
+  {
+    return (Z::Empty());
+  }
+  if constexpr (!IsSigned<A> && !IsSigned<B>)
+  {
+    return (Z(x.infm / y.supr, x.supr / y.infm));
+  }
+  else if constexpr (IsSigned<A> && IsSigned<B>)
+  {
+    return (Z(detail::min4(x.infm / y.infm, x.infm / y.supr, x.supr / y.infm, x.supr / y.supr),
+              detail::max4(x.infm / y.infm, x.infm / y.supr, x.supr / y.infm, x.supr / y.supr)));
+  }
+  else
+  {
+    return (Z::Empty());
+  }
+}
+
+/* Mod:
+ * Interval modulus, as by IntervalMod for the representation A of x; empty
+ * for SIGNED_POS_ARITH and SIGNED_NEG_ARITH, which IntervalMod rejects.
+ */
+template <typename T, ArithType A, ArithType B>
+constexpr Interval<T, A> Mod(Interval<T, A> x, Interval<T, B> y)
+{
+  T ym = detail::max2(y.supr, T(-y.infm)) - 1;
+
+  if constexpr (A == UNSIGNED_ARITH)
+  {
+    return (Interval<T, A>(T(0), detail::max2(x.supr, ym)));
+  }
+  else if constexpr (A == SIGNED_ARITH)
+  {
+    T xm = detail::max2(x.supr, T(-x.infm));
+    return (Interval<T, A>(T(-detail::min2(xm, ym)), detail::max2(xm, ym)));
+  }
+  else
+  {
+    return (Interval<T, A>::Empty());
+  }
+}
+
+/* Abs, Max, Min, Mux, Union, Intersection:
+ * As by the corresponding C functions.
+ */
+template <typename T, ArithType A>
+constexpr Interval<T, A> Abs(Interval<T, A> x)
+{
+  return (Interval<T, A>(T(0), detail::max2(detail::max2(x.supr, T(-x.supr)),
+                                            detail::max2(x.infm, T(-x.infm)))));
+}
+
+template <typename T, ArithType A>
+constexpr Interval<T, A> Max(Interval<T, A> x, Interval<T, A> y)
+{
+  return (Interval<T, A>(detail::max2(x.infm, y.infm), detail::max2(x.supr, y.supr)));
+}
+
+template <typename T, ArithType A>
+constexpr Interval<T, A> Min(Interval<T, A> x, Interval<T, A> y)
+{
+  return (Interval<T, A>(detail::min2(x.infm, y.infm), detail::min2(x.supr, y.supr)));
+}
+
+template <typename T, ArithType A>
+constexpr Interval<T, A> Union(Interval<T, A> x, Interval<T, A> y)
+{
+  return (Interval<T, A>(detail::min2(x.infm, y.infm), detail::max2(x.supr, y.supr)));
+}
+
+template <typename T, ArithType A>
+constexpr Interval<T, A> Mux(Interval<T, A> x, Interval<T, A> y)
+{
+  return (Union(x, y));
+}
+
+template <typename T, ArithType A>
+constexpr Interval<T, A> Intersection(Interval<T, A> x, Interval<T, A> y)
+{
+  if (x.IsEmpty() || y.IsEmpty() || x.supr < y.infm || y.supr < x.infm)
+  {
+    return (Interval<T, A>::Empty());
+  }
+  return (Interval<T, A>(detail::max2(x.infm, y.infm), detail::min2(x.supr, y.supr)));
+}
+
+/* Sqrt:
+ * Interval square root, as by IntervalSqrt: [floor(sqrt(infm)),
+ * ceil(sqrt(supr))], computed exactly; empty if x has negative values.
+ */
+template <typename T, ArithType A>
+constexpr Interval<T, A> Sqrt(Interval<T, A> x)
+{
+  T r = 0;
+
+  if (x.infm < 0 || x.supr < 0)
+  {
+    return (Interval<T, A>::Empty());
+  }
+  r = detail::isqrt(x.supr);
+  return (Interval<T, A>(detail::isqrt(x.infm), T(r + (r * r != x.supr))));
+}
+
+/* Pow:
+ * Interval of x ** n for n >= 0 (n = 0 gives [1,1]). For an even n and an x
+ * containing both signs, the result is [0, max(infm ** n, supr ** n)].
+ */
+template <typename T, ArithType A>
+constexpr Interval<T, A> Pow(Interval<T, A> x, int n)
+{
+  T u = detail::ipow(x.infm, n), v = detail::ipow(x.supr, n);
+
+  if ((n & 1) || x.infm >= 0)
+  {
+    return (Interval<T, A>(u, v));
+  }
+  if (x.supr <= 0)
+  {
+    return (Interval<T, A>(v, u));
+  }
+  return (Interval<T, A>(T(0), detail::max2(u, v)));
+}
+
+/* Balanced:
+ * Return the enclosing balanced interval, as by IntervalBalanced: [0,2**n-1]
+ * for unsigned (positive) and [-2**n,2**n-1] for signed intervals, or the
+ * empty interval where IntervalBalanced reports an error.
+ */
+template <typename T, ArithType A>
+constexpr Interval<T, A> Balanced(Interval<T, A> x)
+{
+  using U = std::make_unsigned_t<T>;
+  int n = 0;
+
+  if constexpr (A == UNSIGNED_ARITH)
+  {
+    if (!x.IsPositive() || x.supr <= 0)
+    {
+      return (Interval<T, A>::Empty());
+    }
+    n = detail::bitlen(U(U(x.supr) - 1));
+    return (Interval<T, A>(T(0), T((U(1) << n) - 1)));
+  }
+  else if constexpr (A == SIGNED_ARITH)
+  {
+    T u = (x.infm > 0) ? x.infm : T(-x.infm), v = (x.supr > 0) ? x.supr : T(-x.supr);
+
+    // log2ceil rejects zero magnitudes (and the most negative value of T).
+    if (u <= 0 || v <= 0)
+    {
+      return (Interval<T, A>::Empty());
+    }
+    n = detail::max2(detail::bitlen(U(U(u) - 1)), detail::bitlen(U(U(v) - 1)));
+    return (Interval<T, A>(T(U(0) - (U(1) << n)), T((U(1) << n) - 1)));
+  }
+  else
+  {
+    return (Interval<T, A>::Empty());
+  }
+}
+
+/* And, Ior, Xor, Not:
+ * Tight bounds of the bitwise operations, as by IntervalAnd, IntervalIor, 
+ * IntervalXor and IntervalNot; And, Ior and Xor are empty if x or y is empty.
+ */
+template <typename T, ArithType A, ArithType B>
+constexpr Interval<T, JoinArith<A, B>> And(Interval<T, A> x, Interval<T, B> y)
+{
+  Interval<T, JoinArith<A, B>> z;
+
+  return (detail::bitwise(x.infm, x.supr, y.infm, y.supr, 0, z.infm, z.supr) ?
+          z : Interval<T, JoinArith<A, B>>::Empty());
+}
+
+template <typename T, ArithType A, ArithType B>
+constexpr Interval<T, JoinArith<A, B>> Ior(Interval<T, A> x, Interval<T, B> y)
+{
+  Interval<T, JoinArith<A, B>> z;
+
+  return (detail::bitwise(x.infm, x.supr, y.infm, y.supr, 1, z.infm, z.supr) ?
+          z : Interval<T, JoinArith<A, B>>::Empty());
+}
+
+template <typename T, ArithType A, ArithType B>
+constexpr Interval<T, JoinArith<A, B>> Xor(Interval<T, A> x, Interval<T, B> y)
+{
+  Interval<T, JoinArith<A, B>> z;
+
+  return (detail::bitwise(x.infm, x.supr, y.infm, y.supr, 2, z.infm, z.supr) ?
+          z : Interval<T, JoinArith<A, B>>::Empty());
+}
+
+template <typename T, ArithType A>
+constexpr Interval<T, A> Not(Interval<T, A> x)
+{
+  return (Interval<T, A>(T(~x.supr), T(~x.infm)));
+}
+
+/* Operators: arithmetic on intervals, | for the union (hull) and & for the
+ * intersection.
+ */
+template <typename T, ArithType A, ArithType B>
+constexpr auto operator+(Interval<T, A> x, Interval<T, B> y)
+{
+  return (Add(x, y));
+}
+
+template <typename T, ArithType A, ArithType B>
+constexpr auto operator-(Interval<T, A> x, Interval<T, B> y)
+{
+  return (Sub(x, y));
+}
+
+template <typename T, ArithType A>
+constexpr auto operator-(Interval<T, A> x)
+{
+  return (Neg(x));
+}
+
+template <typename T, ArithType A, ArithType B>
+constexpr auto operator*(Interval<T, A> x, Interval<T, B> y)
+{
+  return (Mul(x, y));
+}
+
+template <typename T, ArithType A, ArithType B>
+constexpr auto operator/(Interval<T, A> x, Interval<T, B> y)
+{
+  return (Div(x, y));
+}
+
+template <typename T, ArithType A, ArithType B>
+constexpr auto operator%(Interval<T, A> x, Interval<T, B> y)
+{
+  return (Mod(x, y));
+}
+
+template <typename T, ArithType A>
+constexpr auto operator|(Interval<T, A> x, Interval<T, A> y)
+{
+  return (Union(x, y));
+}
+
+template <typename T, ArithType A>
+constexpr auto operator&(Interval<T, A> x, Interval<T, A> y)
+{
+  return (Intersection(x, y));
+}
+
+/* Shorthands for 32-bit intervals. */
+using Signed = Interval<int, SIGNED_ARITH>;
+using Unsigned = Interval<int, UNSIGNED_ARITH>;
+
+} /* namespace interval */
+
+#endif /* INTERVAL_HPP */
@@ -0,0 +1,167 @@
+/*
+ * Filename: test-interval-hpp.cpp
+ * Purpose : Test the C++ interface to the interval ADT against the C API,
+ *           at compile time and at run time.
+ * Author  : Nikolaos Kavvadias (C) 2009, 2010, 2011, 2012, 2013, 2014, 2015
+ *                                  2016
+ * Date    : 16-Oct-2026
+ * Revision: 0.3.1 (26/10/16)
+ *           Added the bitwise operations.
+ *           0.3.0 (26/10/16)
+ *           Initial version.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "interval.hpp"
+
+#define TEST_N 100000
+
+using interval::Signed;
+using interval::Unsigned;
+
+// Ranges of constant expressions, computed by the compiler
+static_assert((Signed(-3, 5) * Signed(2, 4)) == Signed(-12, 20), "Mul");
+static_assert((Signed(-8, 7) / Signed(1, 2)) == Signed(-8, 7), "Div");
+static_assert((Unsigned(25, 178) / Unsigned(2, 5)) == Unsigned(5, 89), "Div");
+static_assert((Signed(-8, 7) / Signed(-1, 2)).IsEmpty(), "Div by zero");
+static_assert((Signed(-9, 4) % Signed(1, 5)) == Signed(-4, 9), "Mod");
+static_assert(interval::Balanced(Unsigned(3, 100)) == Unsigned(0, 127), "Balanced");
+static_assert(interval::Balanced(Signed(-100, 5)) == Signed(-128, 127), "Balanced");
+static_assert(interval::Sqrt(Signed(10, 17)) == Signed(3, 5), "Sqrt");
+static_assert(interval::Sqrt(Signed(0, 2000000000)) == Signed(0, 44722), "Sqrt");
+static_assert(interval::Sqrt(Signed(1 << 30, 2147483647)) == Signed(32768, 46341), "Sqrt");
+static_assert(interval::Sqrt(interval::Interval<long long>(0, 9223372036854775807LL)) ==
+              interval::Interval<long long>(0, 3037000500LL), "Sqrt");
+static_assert(interval::Pow(Signed(-3, 2), 2) == Signed(0, 9), "Pow");
+static_assert(Signed::Universe(32) == Signed(-2147483647 - 1, 2147483647), "Universe");
+static_assert(interval::Interval<long long, UNSIGNED_ARITH>::Universe(48).supr ==
+              (1LL << 48) - 1, "Universe");
+static_assert(Signed(-48, 42).Bitwidth() == 7, "Bitwidth");
+static_assert((-Signed(2, 5)) == Signed(-5, -2), "Neg");
+static_assert((Signed(0, 3) | Signed(7, 9)) == Signed(0, 9), "Union");
+static_assert((Signed(0, 3) & Signed(7, 9)).IsEmpty(), "Intersection");
+static_assert(interval::And(Signed(-48, 42), Signed(16, 31)) == Signed(0, 31), "And");
+static_assert(interval::Ior(Signed(-48, 42), Signed(16, 31)) == Signed(-48, 63), "Ior");
+static_assert(interval::Xor(Signed(-48, 42), Signed(16, 31)) == Signed(-64, 63), "Xor");
+static_assert(interval::Not(Signed(-48, 42)) == Signed(-43, 47), "Not");
+static_assert(interval::And(Unsigned(0, 255), Unsigned(256, 511)) == Unsigned(0, 255), "And");
+static_assert(interval::Ior(interval::Interval<long long>(1LL << 40, 1LL << 41),
+                            interval::Interval<long long>(1, 3)) ==
+              interval::Interval<long long>((1LL << 40) + 1, (1LL << 41) + 3), "Ior");
+
+/* differs:
+ * Return 1 if the C++ interval z differs from the C interval r.
+ */
+template <typename T, ArithType A>
+static int differs(interval::Interval<T, A> z, Interval r)
+{
+  return (z.infm != r.infm || z.supr != r.supr);
+}
+
+/* rnd:
+ * Return a random interval within [lo,hi].
+ */
+static Interval rnd(int lo, int hi)
+{
+  unsigned int w = (unsigned int)hi - (unsigned int)lo + 1;
+  int u = (int)((unsigned int)lo + (unsigned int)rand() % w);
+  int v = (int)((unsigned int)lo + (unsigned int)rand() % w);
+
+  return (INTERVAL(MIN(u, v), MAX(u, v)));
+}
+
+/* test_binary:
+ * Compare the arithmetic operations on representations A and B with the C
+ * API over random intervals within [lo,hi]. Returns the number of mismatches.
+ */
+template <ArithType A, ArithType B>
+static int test_binary(int lo, int hi)
+{
+  interval::Interval<int, A> xx;
+  interval::Interval<int, B> yy;
+  Interval x, y, r;
+  int i, mismatches = 0;
+
+  for (i = 0; i < TEST_N; i++)
+  {
+    x = rnd(lo, hi);
+    y = rnd(lo, hi);
+    xx = interval::Interval<int, A>(x);
+    yy = interval::Interval<int, B>(y);
+    mismatches += differs(xx + yy, IntervalAdd(x, y));
+    mismatches += differs(xx - yy, IntervalSub(x, y));
+    mismatches += differs(xx * yy, IntervalMul(x, y, A, B));
+    IntervalDivChecked(&r, x, y, A, B);
+    mismatches += differs(xx / yy, r);
+    IntervalModChecked(&r, x, y, A);
+    mismatches += differs(xx % yy, r);
+  }
+  return (mismatches);
+}
+
+/* test_unary:
+ * Compare the other operations on representation A with the C API over
+ * random intervals within [lo,hi]. Returns the number of mismatches.
+ */
+template <ArithType A>
+static int test_unary(int lo, int hi)
+{
+  interval::Interval<int, A> xx, yy;
+  Interval x, y, r;
+  int i, mismatches = 0;
+
+  for (i = 0; i < TEST_N; i++)
+  {
+    x = rnd(lo, hi);
+    y = rnd(lo, hi);
+    xx = interval::Interval<int, A>(x);
+    yy = interval::Interval<int, A>(y);
+    mismatches += differs(interval::Abs(xx), IntervalAbs(x));
+    mismatches += differs(interval::Max(xx, yy), IntervalMax(x, y));
+    mismatches += differs(interval::Min(xx, yy), IntervalMin(x, y));
+    mismatches += differs(xx | yy, IntervalUnion(x, y));
+    mismatches += differs(xx & yy, IntervalIntersection(x, y));
+    mismatches += differs(-xx, INTERVAL(-x.supr, -x.infm));
+    mismatches += differs(interval::And(xx, yy), IntervalAnd(x, y));
+    mismatches += differs(interval::Ior(xx, yy), IntervalIor(x, y));
+    mismatches += differs(interval::Xor(xx, yy), IntervalXor(x, y));
+    mismatches += differs(interval::Not(xx), IntervalNot(x));
+    IntervalBalancedChecked(&r, x, A);
+    mismatches += differs(interval::Balanced(xx), r);
+    IntervalSqrtChecked(&r, x);
+    mismatches += differs(interval::Sqrt(xx), r);
+    mismatches += (xx.Bitwidth() != IntervalToIntegerBitwidth(x, SIGNED_ARITH));
+    mismatches += (xx.Contains(y.infm) != ValueIsInInterval(x, y.infm));
+    mismatches += differs(interval::Interval<int, A>::Universe(1 + i % 32),
+                          IntegerBitwidthToInterval(1 + i % 32, A));
+  }
+  return (mismatches);
+}
+
+/* main:
+ */
+int main(void)
+{
+  srand(19);
+  printf("Testing interval.hpp (unsigned * unsigned): %d mismatches\n",
+    test_binary<UNSIGNED_ARITH, UNSIGNED_ARITH>(1, 40000));
+  printf("Testing interval.hpp (unsigned * signed): %d mismatches\n",
+    test_binary<UNSIGNED_ARITH, SIGNED_ARITH>(1, 40000));
+  printf("Testing interval.hpp (signed * unsigned): %d mismatches\n",
+    test_binary<SIGNED_ARITH, UNSIGNED_ARITH>(1, 40000));
+  printf("Testing interval.hpp (signed * signed): %d mismatches\n",
+    test_binary<SIGNED_ARITH, SIGNED_ARITH>(-40000, 40000));
+  printf("Testing interval.hpp (signed_pos * signed): %d mismatches\n",
+    test_binary<SIGNED_POS_ARITH, SIGNED_ARITH>(-40000, 40000));
+  printf("Testing interval.hpp (unsigned operations): %d mismatches\n",
+    test_unary<UNSIGNED_ARITH>(0, 1 << 30));
+  printf("Testing interval.hpp (signed operations): %d mismatches\n",
+    test_unary<SIGNED_ARITH>(-(1 << 30), 1 << 30));
+  printf("Testing interval.hpp (unsigned operations, large bounds): %d mismatches\n",
+    test_unary<UNSIGNED_ARITH>(1 << 30, 2147483647));
+  printf("Testing interval.hpp (signed operations, large bounds): %d mismatches\n",
+    test_unary<SIGNED_ARITH>(0, 2147483647));
+
+  return 0;
+}
@@ -13,7 +13,153 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
+#include <pthread.h>
+#include <sys/resource.h>
 #include "interval.h"
+#include "interval-batch.h"
+#include "interval-dag.h"
+#include "interval-fixpoint.h"
+#include "interval-parallel.h"
+#include "interval-cache.h"
+#include "interval-arena.h"
+#include "interval-multi.h"
+#include "interval-index.h"
+#include "interval-trace.h"
+#include "interval-atomic.h"
+#include "interval-probe.h"
+#include "interval-wide.h"
+#include "interval-bits.h"
+#include "interval-poly.h"
+
+#define BATCH_N 1000
+#define ATOMIC_THREADS 8
+#define ATOMIC_N 100000
+
+/* AtomicTest is the state of a thread of the atomic accumulator test. */
+typedef struct {
+  IntervalAtomic *a, *b;
+  IntervalAtomicSplit *s;
+  unsigned int seed;
+} AtomicTest;
+
+/* atomic_test_value:
+ * Return the next value of the pseudo-random sequence of state x.
+ */
+static int atomic_test_value(unsigned int *x)
+{
+  *x = *x * 1103515245u + 12345u;
+  return ((int)(*x >> 12) - (1 << 19));
+}
+
+/* atomic_test_fn:
+ * Join ATOMIC_N pseudo-random values into the accumulators of a test thread,
+ * one by one and in blocks of 100.
+ */
+static void *atomic_test_fn(void *arg)
+{
+  AtomicTest *t = (AtomicTest *)arg;
+  unsigned int x = t->seed;
+  int i, v[100];
+
+  for (i = 0; i < ATOMIC_N; i++)
+  {
+    v[i % 100] = atomic_test_value(&x);
+    IntervalAtomicJoinValue(t->a, v[i % 100]);
+    IntervalAtomicSplitJoin(t->s, ValueToInterval(v[i % 100]));
+    if (i % 100 == 99)
+    {
+      IntervalAtomicJoinBatch(t->b, 100, v);
+    }
+  }
+  return (NULL);
+}
+
+/* probe_test_fn:
+ * Record ATOMIC_N pseudo-random values into probes 0 to 2 of the profiler
+ * from a test thread; probe 3 records nothing.
+ */
+static void *probe_test_fn(void *arg)
+{
+  unsigned int x = *(unsigned int *)arg;
+  int i;
+
+  for (i = 0; i < ATOMIC_N; i++)
+  {
+    INTERVAL_PROBE(i % 3, atomic_test_value(&x));
+  }
+  return (NULL);
+}
+
+/* probe_pool_fn:
+ * Record into probe 3 from a thread that outlives a shutdown of the
+ * profiler, as a pooled worker does: once before it, and into probe 0 once
+ * the profiler is set up again, waiting at barrier arg in between.
+ */
+static void *probe_pool_fn(void *arg)
+{
+  INTERVAL_PROBE(3, 7);
+  pthread_barrier_wait((pthread_barrier_t *)arg);
+  pthread_barrier_wait((pthread_barrier_t *)arg);
+  INTERVAL_PROBE(0, 5);
+  return (NULL);
+}
+
+/* wide_test_value:
+ * Return the next 64-bit value of the pseudo-random sequence of state x, of
+ * random magnitude, including the extreme values.
+ */
+static int64_t wide_test_value(unsigned int *x)
+{
+  uint64_t u;
+  int k;
+
+  *x = *x * 1103515245u + 12345u;
+  u = (uint64_t)*x << 32;
+  *x = *x * 1103515245u + 12345u;
+  u |= *x;
+  *x = *x * 1103515245u + 12345u;
+  k = (int)((*x >> 16) % 66);
+  if (k >= 64)
+  {
+    return ((k == 64) ? INT64_MAX : INT64_MIN);
+  }
+  return ((int64_t)u >> k);
+}
+
+/* wide_test_interval:
+ * Return a random (non-empty) 64-bit interval of state x.
+ */
+static Interval64 wide_test_interval(unsigned int *x)
+{
+  int64_t u = wide_test_value(x), v = wide_test_value(x);
+
+  return (INTERVAL64(MIN(u, v), MAX(u, v)));
+}
+
+/* bits_test_random:
+ * Return a random IntervalBits of state x, with a range within [-40,40] and
+ * random known bits among the 7 least significant bits and the sign bit.
+ */
+static IntervalBits bits_test_random(unsigned int *x)
+{
+  IntervalBits z;
+  unsigned int m, k;
+  int u, v;
+
+  *x = *x * 1103515245u + 12345u;
+  u = (int)((*x >> 16) % 81) - 40;
+  *x = *x * 1103515245u + 12345u;
+  v = (int)((*x >> 16) % 81) - 40;
+  *x = *x * 1103515245u + 12345u;
+  m = *x;
+  *x = *x * 1103515245u + 12345u;
+  k = (*x ^ (*x >> 9)) & 0x8000007Fu;
+  z.r = INTERVAL(MIN(u, v), MAX(u, v));
+  z.zeros = ~m & k;
+  z.ones = m & k;
+  return (z);
+}
 
 /* main:
  */
@@ -21,6 +167,55 @@ int main (void)
 { 
   Interval a, b, c, d, e, f;
   int i, n;
+  int xi[BATCH_N], xs[BATCH_N], yi[BATCH_N], ys[BATCH_N];
+  int zi[BATCH_N], zs[BATCH_N], bw[BATCH_N];
+  int wi[BATCH_N], ws[BATCH_N], si[BATCH_N], ss[BATCH_N];
+  int pi[BATCH_N], ps[BATCH_N], qi[BATCH_N], qs[BATCH_N];
+  int op, isa, mismatches, ovf;
+  Interval ref[BATCH_N];
+  IntervalDag *g;
+  IntervalFixpoint *fp;
+  IntervalPool *pool;
+  IntervalCache *cache;
+  IntervalArena *arena;
+  Interval *arr[BATCH_N];
+  size_t reserved;
+  IntervalMulti ma, mb, mz, mr;
+  int j, v, nout, first;
+  const int *pa, *pb;
+  IntervalIndex *ix;
+  IntervalTrace *tr;
+  IntervalAtomic aa, ab;
+  IntervalAtomicSplit as;
+  AtomicTest at[ATOMIC_THREADS];
+  pthread_t threads[ATOMIC_THREADS];
+  pthread_barrier_t barrier;
+  unsigned int seed, seeds[ATOMIC_THREADS];
+  FILE *tf, *pf;
+  struct rusage ru;
+  long rss;
+  Interval64 w, wx, wy, wz;
+#ifdef INTERVAL_HAVE_INT128
+  Interval128 vx, vy, vz;
+  IntervalBig ba, bb, bz;
+  char str[256];
+#endif
+  IntervalBits kx, ky, kz;
+  int ns, nf;
+  int pc[INTERVAL_POLY_MAX_DEGREE + 2];
+  static const int p2[3] = { 2, -3, 1 };
+  int phi, cnd, inc;
+  static const IntervalOpcode dag_ops[] = {
+    INTERVAL_OP_ADD, INTERVAL_OP_SUB, INTERVAL_OP_ABS, INTERVAL_OP_MAX, 
+    INTERVAL_OP_MIN, INTERVAL_OP_MUX, INTERVAL_OP_UNION, INTERVAL_OP_NEG, 
+    INTERVAL_OP_DIV
+  };
+  static const IntervalOpcode multi_ops[] = {
+    INTERVAL_OP_ADD, INTERVAL_OP_SUB, INTERVAL_OP_MUL, INTERVAL_OP_ABS,
+    INTERVAL_OP_MAX, INTERVAL_OP_MIN, INTERVAL_OP_DIV, INTERVAL_OP_UNION,
+    INTERVAL_OP_INTERSECTION, INTERVAL_OP_NEG
+  };
+  ArithType mtyp;
   
   // Construct the input intervals
   a = INTERVAL(0, 1);
@@ -73,6 +268,48 @@ int main (void)
   IntervalPrint(stdout, e);
   printf("\n");
  
+  f = INTERVAL(-70000, 65535);
+  e = IntervalMulWide(f, f, SIGNED_ARITH, SIGNED_ARITH, &ovf);
+  printf("Testing IntervalMulWide: ");
+  IntervalPrint(stdout, f);
+  printf(" * ");
+  IntervalPrint(stdout, f);
+  printf(" = ");
+  IntervalPrint(stdout, e);
+  printf(" (overflow: %d)\n", ovf);
+
+  e = IntervalMulWide(b, d, SIGNED_ARITH, SIGNED_ARITH, &ovf);
+  printf("Testing IntervalMulWide: ");
+  IntervalPrint(stdout, b);
+  printf(" * ");
+  IntervalPrint(stdout, d);
+  printf(" = ");
+  IntervalPrint(stdout, e);
+  printf(" (overflow: %d)\n", ovf);
+
+  f = INTERVAL(2147483000, 2147483647);
+  e = IntervalAddWide(f, b, &ovf);
+  printf("Testing IntervalAddWide: ");
+  IntervalPrint(stdout, f);
+  printf(" + ");
+  IntervalPrint(stdout, b);
+  printf(" = ");
+  IntervalPrint(stdout, e);
+  printf(" (overflow: %d)\n", ovf);
+
+  f = INTERVAL(-2147483647 - 1, 5);
+  e = IntervalNegWide(f, &ovf);
+  printf("Testing IntervalNegWide: -");
+  IntervalPrint(stdout, f);
+  printf(" = ");
+  IntervalPrint(stdout, e);
+  printf(" (overflow: %d)", ovf);
+  e = IntervalNegWide(INTERVAL(1, 5), &ovf);
+  mismatches = (e.infm != -5) + (e.supr != -1) + (ovf != 0);
+  e = IntervalMulWide(b, d, UNKNOWN_ARITH_TYPE, SIGNED_ARITH, &ovf);
+  mismatches += !IntervalIsEmpty(e) + (ovf != 1);
+  printf(", %d mismatches\n", mismatches);
+
   f = INTERVAL(25, 178);
   e = IntervalDiv(f, b, UNSIGNED_ARITH, UNSIGNED_ARITH);
   printf("Testing IntervalDiv for UNSIGNEDs: ");
@@ -205,5 +442,1287 @@ int main (void)
   IntervalPrint(stdout, e);
   printf("\n");
   
+  // Test the bitwise operations on all pairs of intervals within [-9,9] 
+  // against the exact range of the results
+  mismatches = 0;
+  for (i = 0; i < 19 * 19 * 19 * 19; i++)
+  {
+    a = INTERVAL(i % 19 - 9, i / 19 % 19 - 9);
+    b = INTERVAL(i / 361 % 19 - 9, i / 6859 - 9);
+    if (IntervalIsEmpty(a) || IntervalIsEmpty(b))
+    {
+      continue;
+    }
+    for (op = 0; op < 3; op++)
+    {
+      e = INTERVAL(INT_MAX, INT_MIN);
+      for (j = a.infm; j <= a.supr; j++)
+      {
+        for (v = b.infm; v <= b.supr; v++)
+        {
+          n = (op == 0) ? (j & v) : (op == 1) ? (j | v) : (j ^ v);
+          e = INTERVAL(MIN(e.infm, n), MAX(e.supr, n));
+        }
+      }
+      f = (op == 0) ? IntervalAnd(a, b) : (op == 1) ? IntervalIor(a, b) : IntervalXor(a, b);
+      mismatches += (e.infm != f.infm) + (e.supr != f.supr);
+    }
+  }
+  a = INTERVAL(-48, 42);
+  b = INTERVAL(16, 31);
+  printf("Testing IntervalAnd/IntervalIor/IntervalXor/IntervalNot: ");
+  IntervalPrint(stdout, a);
+  printf(" AND ");
+  IntervalPrint(stdout, b);
+  printf(" = ");
+  IntervalPrint(stdout, IntervalAnd(a, b));
+  printf(", IOR = ");
+  IntervalPrint(stdout, IntervalIor(a, b));
+  printf(", XOR = ");
+  IntervalPrint(stdout, IntervalXor(a, b));
+  printf(", NOT ");
+  IntervalPrint(stdout, a);
+  printf(" = ");
+  IntervalPrint(stdout, IntervalNot(a));
+  printf(", %d mismatches\n", mismatches);
+  
+  // Test the shift and bit-field operations on all intervals within [-9,9] 
+  // (and shift amounts within [0,4]) against the exact range of the results
+  mismatches = 0;
+  for (i = 0; i < 19 * 19 * 5 * 5; i++)
+  {
+    a = INTERVAL(i % 19 - 9, i / 19 % 19 - 9);
+    b = INTERVAL(i / 361 % 5, i / 1805);
+    if (IntervalIsEmpty(a) || IntervalIsEmpty(b))
+    {
+      continue;
+    }
+    for (op = 0; op < 7; op++)
+    {
+      e = INTERVAL(INT_MAX, INT_MIN);
+      for (j = a.infm; j <= a.supr; j++)
+      {
+        for (v = b.infm; v <= b.supr; v++)
+        {
+          switch (op)
+          {
+            case 0:  n = j * (1 << v); break;
+            case 1:  n = (int)((unsigned int)j >> v); break;
+            case 2:  n = (j < 0) ? ~(~j >> v) : (j >> v); break;
+            case 3:  n = ((j + 64) & ((1 << (v + 1)) - 1)); break;
+            case 4:  n = ((j + 64) & ((1 << (v + 1)) - 1)) - 
+                         (((j >> v) & 1) << (v + 1)); break;
+            case 5:  n = ((j + 64) >> (v / 2)) & ((1 << (v - v / 2 + 1)) - 1); break;
+            default: n = j * (1 << (v + 1)) + (b.infm & ((1 << (v + 1)) - 1)); break;
+          }
+          e = INTERVAL(MIN(e.infm, n), MAX(e.supr, n));
+        }
+      }
+      // The bit-field operations take a constant width of b.infm + 1 bits
+      if (op >= 3 && b.infm != b.supr)
+      {
+        continue;
+      }
+      switch (op)
+      {
+        case 0:  f = IntervalShl(a, b); break;
+        case 1:  f = IntervalShr(a, b, SIGNED_ARITH); break;
+        case 2:  f = IntervalSra(a, b); break;
+        case 3:  f = IntervalZext(a, b.infm + 1); break;
+        case 4:  f = IntervalSext(a, b.infm + 1); break;
+        case 5:  f = IntervalSlice(a, b.infm, b.infm / 2); break;
+        default: f = IntervalConcat(a, ValueToInterval(b.infm), b.infm + 1); break;
+      }
+      mismatches += (e.infm != f.infm) + (e.supr != f.supr);
+    }
+  }
+  mismatches += (IntervalShlChecked(&e, INTERVAL(1, 1 << 30), INTERVAL(1, 1)) != 
+                 INTERVAL_ERR_OVERFLOW) + 
+    (IntervalSraChecked(&e, INTERVAL(1, 2), INTERVAL(-1, 3)) != INTERVAL_ERR_DOMAIN) + 
+    (IntervalShrChecked(&e, INTERVAL(-1, 2), INTERVAL(1, 1), UNSIGNED_ARITH) != 
+     INTERVAL_ERR_DOMAIN) + 
+    (IntervalTruncChecked(&e, INTERVAL(1, 2), 32, UNSIGNED_ARITH) != INTERVAL_ERR_BITWIDTH) + 
+    (IntervalSliceChecked(&e, INTERVAL(1, 2), 31, 0) != INTERVAL_ERR_BITWIDTH) + 
+    (IntervalConcatChecked(&e, INTERVAL(1, 1 << 20), INTERVAL(0, 3), 11) != 
+     INTERVAL_ERR_OVERFLOW);
+  a = INTERVAL(-48, 42);
+  printf("Testing IntervalShl/IntervalShr/IntervalSra/IntervalTrunc: ");
+  IntervalPrint(stdout, a);
+  printf(" << [1,3] = ");
+  IntervalPrint(stdout, IntervalShl(a, INTERVAL(1, 3)));
+  printf(", >>> 28 = ");
+  IntervalPrint(stdout, IntervalShr(a, ValueToInterval(28), SIGNED_ARITH));
+  printf(", >> [1,3] = ");
+  IntervalPrint(stdout, IntervalSra(a, INTERVAL(1, 3)));
+  printf(", [5:2] = ");
+  IntervalPrint(stdout, IntervalSlice(a, 5, 2));
+  printf(", zext 8 = ");
+  IntervalPrint(stdout, IntervalZext(a, 8));
+  printf(", %d mismatches\n", mismatches);
+  
+  // Test IntervalExpInteger on all intervals within [-12,12] and exponents 
+  // within [0,8] against the exact range of the powers, and IntervalSqrt on 
+  // all intervals within [0,300] and near the top of the int range
+  mismatches = 0;
+  for (i = 0; i < 25 * 25 * 9; i++)
+  {
+    a = INTERVAL(i % 25 - 12, i / 25 % 25 - 12);
+    n = i / 625;
+    if (IntervalIsEmpty(a))
+    {
+      continue;
+    }
+    e = INTERVAL(INT_MAX, INT_MIN);
+    for (j = a.infm; j <= a.supr; j++)
+    {
+      for (v = 1, op = 0; op < n; op++)
+      {
+        v *= j;
+      }
+      e = INTERVAL(MIN(e.infm, v), MAX(e.supr, v));
+    }
+    f = IntervalExpInteger(a, n);
+    mismatches += (e.infm != f.infm) + (e.supr != f.supr);
+  }
+  for (i = 0; i < 301 * 301 + 2000; i++)
+  {
+    a = (i < 301 * 301) ? INTERVAL(i % 301, i / 301) : 
+        INTERVAL(INT_MAX - 2 * (i - 301 * 301), INT_MAX - (i - 301 * 301));
+    if (IntervalIsEmpty(a))
+    {
+      continue;
+    }
+    f = IntervalSqrt(a);
+    mismatches += ((long long)f.infm * f.infm > a.infm) + 
+      ((long long)(f.infm + 1) * (f.infm + 1) <= a.infm) + 
+      ((long long)f.supr * f.supr < a.supr) + 
+      (f.supr > 0 && (long long)(f.supr - 1) * (f.supr - 1) >= a.supr);
+  }
+  mismatches += (IntervalExpIntegerChecked(&e, INTERVAL(-46340, 46340), 2) != INTERVAL_OK) + 
+    (e.infm != 0 || e.supr != 46340 * 46340) + 
+    (IntervalExpIntegerChecked(&e, INTERVAL(-46341, 0), 2) != INTERVAL_ERR_OVERFLOW) + 
+    (IntervalExpIntegerChecked(&e, INTERVAL(-2, 1), 31) != INTERVAL_OK) + 
+    (e.infm != INT_MIN || e.supr != 1) + 
+    (IntervalExpIntegerChecked(&e, INTERVAL(-1, 2), 31) != INTERVAL_ERR_OVERFLOW) + 
+    (IntervalExpIntegerChecked(&e, INTERVAL(-1, 1), -1) != INTERVAL_ERR_DOMAIN) + 
+    (IntervalSqrtChecked(&e, INTERVAL(-1, 4)) != INTERVAL_ERR_DOMAIN);
+  a = INTERVAL(-3, 2);
+  printf("Testing IntervalExpInteger/IntervalSqrt: ");
+  IntervalPrint(stdout, a);
+  printf(" ** 2 = ");
+  IntervalPrint(stdout, IntervalExpInteger(a, 2));
+  printf(", ** 3 = ");
+  IntervalPrint(stdout, IntervalExpInteger(a, 3));
+  printf(", sqrt ");
+  IntervalPrint(stdout, IntervalUniverse(31, UNSIGNED_ARITH));
+  printf(" = ");
+  IntervalPrint(stdout, IntervalSqrt(IntervalUniverse(31, UNSIGNED_ARITH)));
+  printf(", %d mismatches\n", mismatches);
+  
+  // Test the batch API against the scalar API
+  srand(1);
+  for (i = 0; i < BATCH_N; i++)
+  {
+    xi[i] = rand() % 2001 - 1000;
+    xs[i] = xi[i] + rand() % 1000;
+    yi[i] = rand() % 2001 - 1000;
+    ys[i] = yi[i] + rand() % 1000;
+    // Shift operands of random magnitude and shift amounts, mostly constant 
+    // and within [0,31], with some empty and out of range intervals
+    j = (rand() - RAND_MAX / 2) >> (rand() % 31);
+    v = (rand() - RAND_MAX / 2) >> (rand() % 31);
+    wi[i] = (i % 50 == 7) ? 1 : MIN(j, v);
+    ws[i] = (i % 50 == 7) ? 0 : MAX(j, v);
+    si[i] = rand() % 32;
+    ss[i] = (i % 3 == 0) ? si[i] : si[i] + rand() % (32 - si[i]);
+    si[i] = (i % 37 == 5) ? -1 : si[i];
+    ss[i] = (i % 41 == 3) ? 32 : ss[i];
+    // Operands of the powers within [-32,31], and non-negative square root 
+    // operands with some negative ones
+    qi[i] = wi[i] >> 26;
+    qs[i] = ws[i] >> 26;
+    pi[i] = (i % 97 == 3) ? -1 : MIN(j & INT_MAX, v & INT_MAX);
+    ps[i] = (i % 50 == 7) ? 0 : MAX(j & INT_MAX, v & INT_MAX);
+  }
+  for (isa = INTERVAL_ISA_SCALAR; isa <= INTERVAL_ISA_AVX512; isa++)
+  {
+    if (IntervalBatchSetIsa((IntervalIsa)isa) != isa)
+    {
+      continue;
+    }
+    mismatches = 0;
+    for (op = INTERVAL_OP_ADD; op <= INTERVAL_OP_NOT; op++)
+    {
+      if (op >= INTERVAL_OP_DIV && op <= INTERVAL_OP_SQRT)
+      {
+        continue;
+      }
+      IntervalBatchEval((IntervalOpcode)op, BATCH_N, xi, xs, yi, ys, zi, zs, 
+        SIGNED_ARITH, SIGNED_ARITH);
+      for (i = 0; i < BATCH_N; i++)
+      {
+        a = INTERVAL(xi[i], xs[i]);
+        b = INTERVAL(yi[i], ys[i]);
+        switch (op)
+        {
+          case INTERVAL_OP_ADD:          e = IntervalAdd(a, b); break;
+          case INTERVAL_OP_SUB:          e = IntervalSub(a, b); break;
+          case INTERVAL_OP_NEG:          e = IntervalNeg(a); break;
+          case INTERVAL_OP_MUL:          
+            e = IntervalMul(a, b, SIGNED_ARITH, SIGNED_ARITH); break;
+          case INTERVAL_OP_ABS:          e = IntervalAbs(a); break;
+          case INTERVAL_OP_MAX:          e = IntervalMax(a, b); break;
+          case INTERVAL_OP_MIN:          e = IntervalMin(a, b); break;
+          case INTERVAL_OP_MUX:          e = IntervalMux(a, b); break;
+          case INTERVAL_OP_UNION:        e = IntervalUnion(a, b); break;
+          case INTERVAL_OP_INTERSECTION: e = IntervalIntersection(a, b); break;
+          case INTERVAL_OP_AND:          e = IntervalAnd(a, b); break;
+          case INTERVAL_OP_IOR:          e = IntervalIor(a, b); break;
+          case INTERVAL_OP_XOR:          e = IntervalXor(a, b); break;
+          case INTERVAL_OP_NOT:          e = IntervalNot(a); break;
+        }
+        if (e.infm != zi[i] || e.supr != zs[i])
+        {
+          mismatches++;
+        }
+      }
+    }
+    printf("Testing IntervalBatchEval (%s): %d mismatches\n", 
+      IntervalBatchIsaName((IntervalIsa)isa), mismatches);
+
+    mismatches = 0;
+    for (i = 0; i < BATCH_N; i++)
+    {
+      zi[i] = xi[i] * (1 << (i % 21));
+      zs[i] = zi[i] + (xs[i] - xi[i]) * (1 << (i % 21));
+    }
+    zi[0] = -2147483647 - 1;
+    zs[0] = 2147483647;
+    IntervalToIntegerBitwidthBatch(BATCH_N, zi, zs, SIGNED_ARITH, bw);
+    for (i = 0; i < BATCH_N; i++)
+    {
+      if (bw[i] != IntervalToIntegerBitwidth(INTERVAL(zi[i], zs[i]), SIGNED_ARITH))
+      {
+        mismatches++;
+      }
+    }
+    printf("Testing IntervalToIntegerBitwidthBatch (%s): %d mismatches\n", 
+      IntervalBatchIsaName((IntervalIsa)isa), mismatches);
+
+    // Check the sampled values xi against [-500,700], the empty and the 
+    // universal interval, for all sizes up to 40 (tails) and the whole array
+    mismatches = 0;
+    for (op = 0; op < 3; op++)
+    {
+      a = (op == 0) ? INTERVAL(-500, 700) :
+          (op == 1) ? IntervalEmpty() : IntervalUniverse(32, SIGNED_ARITH);
+      for (n = 0; n <= BATCH_N; n += (n < 40) ? 1 : BATCH_N - 40)
+      {
+        ovf = IntervalViolationsMinMaxBatch(a, n, xi, &v, &e);
+        mismatches += (IntervalViolationsBatch(a, n, xi, &j) != ovf || j != v);
+        mismatches += (ValueIsInIntervalBatch(a, n, xi, bw) != n - ovf);
+        nout = 0;
+        first = -1;
+        f = IntervalEmpty();
+        for (i = 0; i < n; i++)
+        {
+          mismatches += (bw[i] != ValueIsInInterval(a, xi[i]));
+          if (ValueIsInInterval(a, xi[i]) == 0)
+          {
+            first = (nout++ == 0) ? i : first;
+          }
+          f = (i == 0) ? ValueToInterval(xi[i]) : IntervalUnion(f, ValueToInterval(xi[i]));
+        }
+        mismatches += (ovf != nout || v != first);
+        mismatches += (e.infm != f.infm || e.supr != f.supr);
+      }
+    }
+    printf("Testing IntervalViolationsBatch (%s): %d mismatches\n", 
+      IntervalBatchIsaName((IntervalIsa)isa), mismatches);
+
+    // Check the shift and bit-field batches, including the status of each 
+    // element, for all widths
+    mismatches = 0;
+    for (op = INTERVAL_OP_SHL; op <= INTERVAL_OP_SRA + 4 * 32; op++)
+    {
+      memset(bw, 0, sizeof(bw));
+      j = (op - INTERVAL_OP_SRA - 1) % 32 + 1;
+      switch ((op <= INTERVAL_OP_SRA) ? 0 : (op - INTERVAL_OP_SRA - 1) / 32 + 1)
+      {
+        case 0:
+          IntervalBatchEvalChecked((IntervalOpcode)op, BATCH_N, wi, ws, si, ss, 
+            zi, zs, SIGNED_ARITH, UNKNOWN_ARITH_TYPE, bw);
+          break;
+        case 1:
+          IntervalTruncBatch(BATCH_N, wi, ws, j, SIGNED_ARITH, zi, zs, bw);
+          break;
+        case 2:
+          IntervalTruncBatch(BATCH_N, wi, ws, j, UNSIGNED_ARITH, zi, zs, bw);
+          break;
+        case 3:
+          IntervalSliceBatch(BATCH_N, wi, ws, j - 1, j / 3, zi, zs, bw);
+          break;
+        default:
+          IntervalConcatBatch(BATCH_N, xi, xs, wi, ws, j, zi, zs, bw);
+          break;
+      }
+      for (i = 0; i < BATCH_N; i++)
+      {
+        a = INTERVAL(wi[i], ws[i]);
+        b = INTERVAL(si[i], ss[i]);
+        switch ((op <= INTERVAL_OP_SRA) ? op : (op - INTERVAL_OP_SRA - 1) / 32 + 1)
+        {
+          case INTERVAL_OP_SHL: n = IntervalShlChecked(&e, a, b); break;
+          case INTERVAL_OP_SHR: n = IntervalShrChecked(&e, a, b, SIGNED_ARITH); break;
+          case INTERVAL_OP_SRA: n = IntervalSraChecked(&e, a, b); break;
+          case 1: n = IntervalTruncChecked(&e, a, j, SIGNED_ARITH); break;
+          case 2: n = IntervalTruncChecked(&e, a, j, UNSIGNED_ARITH); break;
+          case 3: n = IntervalSliceChecked(&e, a, j - 1, j / 3); break;
+          default: 
+            n = IntervalConcatChecked(&e, INTERVAL(xi[i], xs[i]), a, j); break;
+        }
+        mismatches += (n != bw[i]) || (e.infm != zi[i]) || (e.supr != zs[i]);
+      }
+    }
+    printf("Testing IntervalShlBatch/IntervalTruncBatch/IntervalSliceBatch/"
+      "IntervalConcatBatch (%s): %d mismatches\n", 
+      IntervalBatchIsaName((IntervalIsa)isa), mismatches);
+
+    // Check the power and square root batches, including the status of each 
+    // element, for all exponents up to 31 and operands of various magnitudes
+    mismatches = 0;
+    for (j = -2; j <= 3 * 32; j++)
+    {
+      memset(bw, 0, sizeof(bw));
+      pa = (j < 0) ? ((j == -1) ? pi : wi) : (j < 32) ? qi : (j < 64) ? xi : wi;
+      pb = (j < 0) ? ((j == -1) ? ps : ws) : (j < 32) ? qs : (j < 64) ? xs : ws;
+      if (j < 0)
+      {
+        IntervalSqrtBatch(BATCH_N, pa, pb, zi, zs, bw);
+      }
+      else
+      {
+        IntervalExpIntegerBatch(BATCH_N, pa, pb, j % 32, zi, zs, bw);
+      }
+      for (i = 0; i < BATCH_N; i++)
+      {
+        a = INTERVAL(pa[i], pb[i]);
+        n = (j < 0) ? IntervalSqrtChecked(&e, a) : IntervalExpIntegerChecked(&e, a, j % 32);
+        mismatches += (n != bw[i]) || (e.infm != zi[i]) || (e.supr != zs[i]);
+      }
+    }
+    printf("Testing IntervalExpIntegerBatch/IntervalSqrtBatch (%s): %d mismatches\n", 
+      IntervalBatchIsaName((IntervalIsa)isa), mismatches);
+
+    // Check the polynomial batch, including the status of each element, for 
+    // random polynomials over operands of various magnitudes
+    mismatches = 0;
+    for (j = 0; j < 4 * 6 * 3; j++)
+    {
+      memset(bw, 0, sizeof(bw));
+      pa = (j % 4 == 0) ? qi : (j % 4 == 1) ? xi : (j % 4 == 2) ? wi : pi;
+      pb = (j % 4 == 0) ? qs : (j % 4 == 1) ? xs : (j % 4 == 2) ? ws : ps;
+      n = (j / 4) % 6;
+      for (v = 0; v <= n; v++)
+      {
+        pc[v] = (j * 7 + v * 13) % 11 - 5;
+      }
+      ns = (j / 24 == 0) ? 0 : (j / 24 == 1) ? 1 : INTERVAL_POLY_SEGMENTS;
+      IntervalPolyBatch(BATCH_N, pa, pb, pc, n, ns, zi, zs, bw);
+      for (i = 0; i < BATCH_N; i++)
+      {
+        nf = IntervalPolyChecked(&e, INTERVAL(pa[i], pb[i]), pc, n, ns);
+        mismatches += (nf != bw[i]) || (e.infm != zi[i]) || (e.supr != zs[i]);
+      }
+    }
+    printf("Testing IntervalPolyBatch (%s): %d mismatches\n", 
+      IntervalBatchIsaName((IntervalIsa)isa), mismatches);
+  }
+
+  // Test the non-aborting batch API: the [-3,4] divisor only flags its lane
+  xi[0] = 25; xs[0] = 178; yi[0] = 2;  ys[0] = 5;
+  xi[1] = 25; xs[1] = 178; yi[1] = -3; ys[1] = 4;
+  xi[2] = -8; xs[2] = 7;   yi[2] = 1;  ys[2] = 2;
+  xi[3] = 25; xs[3] = 178; yi[3] = 1;  ys[3] = 0;
+  xi[4] = INT_MIN; xs[4] = 5; yi[4] = -1; ys[4] = -1;
+  for (i = 0; i < 5; i++)
+  {
+    bw[i] = INTERVAL_OK;
+  }
+  n = IntervalDivBatch(5, xi, xs, yi, ys, zi, zs, SIGNED_ARITH, SIGNED_ARITH, bw);
+  for (i = 0; i < 5; i++)
+  {
+    printf("Testing IntervalDivBatch: ");
+    IntervalPrint(stdout, INTERVAL(xi[i], xs[i]));
+    printf(" / ");
+    IntervalPrint(stdout, INTERVAL(yi[i], ys[i]));
+    printf(" = ");
+    IntervalPrint(stdout, INTERVAL(zi[i], zs[i]));
+    printf(" (%s)\n", IntervalStatusString(bw[i]));
+  }
+  printf("Testing IntervalDivBatch: batch status = %s\n", IntervalStatusString(n));
+
+  a = INTERVAL(0, 1);
+  b = INTERVAL(-3, 4);
+  IntervalMulBatch(1, &a.infm, &a.supr, &b.infm, &b.supr, &e.infm, &e.supr,
+    UNSIGNED_ARITH, SIGNED_ARITH);
+  printf("Testing IntervalMulBatch: ");
+  IntervalPrint(stdout, a);
+  printf(" * ");
+  IntervalPrint(stdout, b);
+  printf(" = ");
+  IntervalPrint(stdout, e);
+  printf("\n");
+  
+  // Test the DAG engine: (a+b)*d, mux with c, and c/d whose failure 
+  // propagates to its user, including divisions by the failed c/d and by a 
+  // disjoint intersection
+  g = IntervalDagCreate(0);
+  IntervalDagAddInput(g, INTERVAL(0, 1), SIGNED_ARITH);
+  IntervalDagAddInput(g, INTERVAL(2, 5), SIGNED_ARITH);
+  IntervalDagAddInput(g, INTERVAL(7, 7), SIGNED_ARITH);
+  IntervalDagAddInput(g, INTERVAL(-8, 7), SIGNED_ARITH);
+  IntervalDagAddNode(g, INTERVAL_OP_ADD, 0, 1, SIGNED_ARITH, SIGNED_ARITH);
+  IntervalDagAddNode(g, INTERVAL_OP_MUL, 4, 3, SIGNED_ARITH, SIGNED_ARITH);
+  IntervalDagAddNode(g, INTERVAL_OP_MUX, 5, 2, SIGNED_ARITH, SIGNED_ARITH);
+  IntervalDagAddNode(g, INTERVAL_OP_DIV, 2, 3, SIGNED_ARITH, SIGNED_ARITH);
+  IntervalDagAddNode(g, INTERVAL_OP_ADD, 7, 0, SIGNED_ARITH, SIGNED_ARITH);
+  IntervalDagAddNode(g, INTERVAL_OP_DIV, 2, 7, SIGNED_ARITH, SIGNED_ARITH);
+  IntervalDagAddNode(g, INTERVAL_OP_INTERSECTION, 0, 2, SIGNED_ARITH, SIGNED_ARITH);
+  IntervalDagAddNode(g, INTERVAL_OP_DIV, 1, 10, SIGNED_ARITH, SIGNED_ARITH);
+  n = IntervalDagEval(g);
+  for (i = 0; i < g->n; i++)
+  {
+    printf("Testing IntervalDagEval: node %d = ", i);
+    IntervalPrint(stdout, IntervalDagResult(g, i));
+    printf(", bitwidth = %d (%s)\n", IntervalDagBitwidth(g, i), 
+      IntervalStatusString(IntervalDagStatus(g, i)));
+  }
+  printf("Testing IntervalDagEval: %d levels, %d groups, status = %s\n", 
+    g->nlevels, g->ngroups, IntervalStatusString(n));
+  IntervalDagDestroy(g);
+  
+  // Test the DAG engine against node-by-node evaluation on a random DAG; 
+  // unsigned divisions are by input 0 and of non-negative values only
+  srand(2);
+  g = IntervalDagCreate(BATCH_N);
+  for (i = 0; i < BATCH_N; i++)
+  {
+    if (i < 64)
+    {
+      ref[i] = INTERVAL(rand() % 201 - 100, 0);
+      ref[i].supr = ref[i].infm + rand() % 100;
+      if (i == 0)
+      {
+        ref[i] = INTERVAL(1, 1 + rand() % 7);
+      }
+      IntervalDagAddInput(g, ref[i], SIGNED_ARITH);
+      bw[i] = IntervalToIntegerBitwidth(ref[i], SIGNED_ARITH);
+      continue;
+    }
+    op = dag_ops[rand() % (sizeof(dag_ops) / sizeof(dag_ops[0]))];
+    n = rand() % i;
+    ovf = rand() % i;
+    if (n < 64 && ovf < 64)
+    {
+      op = INTERVAL_OP_MUL;
+    }
+    if (op == INTERVAL_OP_DIV)
+    {
+      ovf = 0;
+      op = (ref[n].infm < 0) ? INTERVAL_OP_NEG : op;
+    }
+    a = ref[n];
+    b = ref[ovf];
+    switch (op)
+    {
+      case INTERVAL_OP_DIV:
+        IntervalDivChecked(&ref[i], a, b, UNSIGNED_ARITH, UNSIGNED_ARITH); break;
+      case INTERVAL_OP_NEG:   ref[i] = INTERVAL(-a.supr, -a.infm); break;
+      case INTERVAL_OP_ADD:   ref[i] = IntervalAdd(a, b); break;
+      case INTERVAL_OP_SUB:   ref[i] = IntervalSub(a, b); break;
+      case INTERVAL_OP_MUL:   
+        ref[i] = IntervalMul(a, b, SIGNED_ARITH, SIGNED_ARITH); break;
+      case INTERVAL_OP_ABS:   ref[i] = IntervalAbs(a); break;
+      case INTERVAL_OP_MAX:   ref[i] = IntervalMax(a, b); break;
+      case INTERVAL_OP_MIN:   ref[i] = IntervalMin(a, b); break;
+      case INTERVAL_OP_MUX:   ref[i] = IntervalMux(a, b); break;
+      case INTERVAL_OP_UNION: ref[i] = IntervalUnion(a, b); break;
+    }
+    j = (op == INTERVAL_OP_DIV) ? UNSIGNED_ARITH : SIGNED_ARITH;
+    IntervalDagAddNode(g, (IntervalOpcode)op, n, ovf, (ArithType)j, (ArithType)j);
+    bw[i] = IntervalToIntegerBitwidth(ref[i], (ArithType)j);
+  }
+  mismatches = 0;
+  IntervalDagEval(g);
+  for (i = 0; i < BATCH_N; i++)
+  {
+    e = IntervalDagResult(g, i);
+    if (e.infm != ref[i].infm || e.supr != ref[i].supr ||
+        IntervalDagBitwidth(g, i) != bw[i] || IntervalDagStatus(g, i) != INTERVAL_OK)
+    {
+      mismatches++;
+    }
+  }
+  printf("Testing IntervalDagEval (%d nodes, %d levels, %d groups): %d mismatches\n", 
+    g->n, g->nlevels, g->ngroups, mismatches);
+  
+  // Test incremental re-evaluation against full evaluation, changing one 
+  // input at a time
+  mismatches = 0;
+  ovf = 0;
+  for (op = 0; op < 20; op++)
+  {
+    i = rand() % 64;
+    a = IntervalDagResult(g, i);
+    IntervalDagSetInput(g, i, INTERVAL(a.infm - op % 3, a.supr + op % 2));
+    IntervalDagUpdate(g, &n);
+    ovf += n;
+    IntervalDagResults(g, ref, bw);
+    IntervalDagEval(g);
+    for (i = 0; i < BATCH_N; i++)
+    {
+      e = IntervalDagResult(g, i);
+      if (e.infm != ref[i].infm || e.supr != ref[i].supr || 
+          bw[i] != IntervalDagBitwidth(g, i))
+      {
+        mismatches++;
+      }
+    }
+  }
+  printf("Testing IntervalDagUpdate (20 updates, %d nodes recomputed): %d mismatches\n", 
+    ovf, mismatches);
+  
+  // Test parallel evaluation against serial evaluation, for 1 to 8 threads 
+  // and tasks of 16 slots
+  IntervalDagEval(g);
+  IntervalDagResults(g, ref, bw);
+  for (n = 1; n <= 8; n *= 2)
+  {
+    pool = IntervalPoolCreate(n, 16);
+    mismatches = 0;
+    IntervalDagEvalParallel(g, pool);
+    for (i = 0; i < BATCH_N; i++)
+    {
+      e = IntervalDagResult(g, i);
+      if (e.infm != ref[i].infm || e.supr != ref[i].supr || 
+          bw[i] != IntervalDagBitwidth(g, i))
+      {
+        mismatches++;
+      }
+    }
+    printf("Testing IntervalDagEvalParallel (%d threads): %d mismatches\n", 
+      IntervalPoolThreads(pool), mismatches);
+    IntervalPoolDestroy(pool);
+  }
+  IntervalDagDestroy(g);
+  
+  // Test the operation cache on 16 distinct operand pairs, repeated
+  cache = IntervalCacheCreate(8);
+  mismatches = 0;
+  for (i = 0; i < BATCH_N; i++)
+  {
+    a = INTERVAL(xi[i % 16], xs[i % 16]);
+    b = INTERVAL(1 + i % 16, 20 + i % 16);
+    e = IntervalMulCached(cache, a, b, SIGNED_ARITH, SIGNED_ARITH);
+    f = IntervalMul(a, b, SIGNED_ARITH, SIGNED_ARITH);
+    mismatches += (e.infm != f.infm || e.supr != f.supr);
+    e = IntervalDivCached(cache, a, b, SIGNED_ARITH, SIGNED_ARITH);
+    f = IntervalDiv(a, b, SIGNED_ARITH, SIGNED_ARITH);
+    mismatches += (e.infm != f.infm || e.supr != f.supr);
+    e = IntervalModCached(cache, a, b, SIGNED_ARITH);
+    f = IntervalMod(a, b, SIGNED_ARITH);
+    mismatches += (e.infm != f.infm || e.supr != f.supr);
+    e = IntervalExpIntegerCached(cache, b, 2);
+    f = IntervalExpInteger(b, 2);
+    mismatches += (e.infm != f.infm || e.supr != f.supr);
+    e = IntervalBalancedCached(cache, b, SIGNED_ARITH);
+    f = IntervalBalanced(b, SIGNED_ARITH);
+    mismatches += (e.infm != f.infm || e.supr != f.supr);
+  }
+  printf("Testing IntervalCache: %lu hits, %lu misses, %d mismatches\n", 
+    cache->hits, cache->misses, mismatches);
+  IntervalCacheDestroy(cache);
+  
+  // Test the arena on interval arrays of 1 to 40 entries, one larger than a 
+  // chunk and single intervals; after a reset, the same allocations must 
+  // reuse the chunks of the first round
+  arena = IntervalArenaCreate(1024);
+  reserved = 0;
+  for (op = 0; op < 2; op++)
+  {
+    IntervalArenaReset(arena);
+    mismatches = 0;
+    for (i = 0; i < BATCH_N; i++)
+    {
+      n = (i == BATCH_N / 2) ? BATCH_N : 1 + i % 40;
+      arr[i] = IntervalArenaAllocIntervals(arena, n);
+      mismatches += ((size_t)arr[i] % INTERVAL_ARENA_ALIGN != 0);
+      while (n-- > 0)
+      {
+        arr[i][n] = INTERVAL(i, i + n);
+      }
+      e = *IntervalArenaNewInterval(arena, INTERVAL(-i, i));
+      mismatches += (e.infm != -i || e.supr != i);
+    }
+    for (i = 0; i < BATCH_N; i++)
+    {
+      n = (i == BATCH_N / 2) ? BATCH_N : 1 + i % 40;
+      while (n-- > 0)
+      {
+        mismatches += (arr[i][n].infm != i || arr[i][n].supr != i + n);
+      }
+    }
+    if (op == 0)
+    {
+      reserved = arena->capacity;
+    }
+  }
+  mismatches += (arena->capacity != reserved);
+  printf("Testing IntervalArena: %lu bytes used, %lu reserved, %d mismatches\n", 
+    (unsigned long)arena->used, (unsigned long)arena->capacity, mismatches);
+  IntervalArenaDestroy(arena);
+  
+  // Test the multi-interval type: a mux of widely separated values scaled by 
+  // [2,3], against the hull, and a division by a set excluding zero
+  IntervalMultiInit(&ma, 0);
+  IntervalMultiInit(&mb, 0);
+  IntervalMultiInit(&mz, 0);
+  IntervalMultiFromInterval(&ma, INTERVAL(0, 1));
+  IntervalMultiFromInterval(&mb, INTERVAL(1000, 1001));
+  IntervalMultiEval(INTERVAL_OP_MUX, &mz, &ma, &mb, SIGNED_ARITH, SIGNED_ARITH);
+  IntervalMultiFromInterval(&mb, INTERVAL(2, 3));
+  n = IntervalMultiEval(INTERVAL_OP_MUL, &mz, &mz, &mb, SIGNED_ARITH, SIGNED_ARITH);
+  printf("Testing IntervalMultiEval: ({[0,1]} mux {[1000,1001]}) * {[2,3]} = ");
+  IntervalMultiPrint(stdout, &mz);
+  printf(" (%s), hull = ", IntervalStatusString(n));
+  IntervalPrint(stdout, IntervalMul(IntervalMux(INTERVAL(0, 1), INTERVAL(1000, 1001)),
+    INTERVAL(2, 3), SIGNED_ARITH, SIGNED_ARITH));
+  printf("\n");
+  IntervalMultiFromInterval(&ma, INTERVAL(100, 100));
+  IntervalMultiFromInterval(&mb, INTERVAL(-5, -1));
+  IntervalMultiInsert(&mb, INTERVAL(1, 5));
+  n = IntervalMultiEval(INTERVAL_OP_DIV, &mz, &ma, &mb, SIGNED_ARITH, SIGNED_ARITH);
+  printf("Testing IntervalMultiEval: {[100,100]} / ");
+  IntervalMultiPrint(stdout, &mb);
+  printf(" = ");
+  IntervalMultiPrint(stdout, &mz);
+  printf(" (%s)\n", IntervalStatusString(n));
+  
+  // Test the multi-interval operations on random sets against pair-by-pair 
+  // evaluation, or against membership for union and intersection; every 
+  // other division is unsigned, on non-negative sets
+  IntervalMultiFree(&mz);
+  IntervalMultiInit(&mz, 64);
+  IntervalMultiInit(&mr, 64);
+  srand(3);
+  mismatches = 0;
+  for (i = 0; i < 1000; i++)
+  {
+    op = multi_ops[i % 10];
+    mtyp = (op == INTERVAL_OP_DIV && (i / 10) % 2) ? UNSIGNED_ARITH : SIGNED_ARITH;
+    IntervalMultiFromInterval(&ma, IntervalEmpty());
+    IntervalMultiFromInterval(&mb, IntervalEmpty());
+    for (n = 1 + rand() % 6; n > 0; n--)
+    {
+      v = rand() % 201 - ((mtyp == UNSIGNED_ARITH) ? 0 : 100);
+      IntervalMultiInsert(&ma, INTERVAL(v, v + rand() % 10));
+      v = rand() % 201 - ((mtyp == UNSIGNED_ARITH) ? 0 : 100);
+      IntervalMultiInsert(&mb, INTERVAL(v, v + rand() % 10));
+    }
+    IntervalMultiEval(op, &mz, &ma, &mb, mtyp, mtyp);
+    for (j = 1; j < IntervalMultiCount(&mz); j++)
+    {
+      mismatches += (IntervalMultiGet(&mz, j).infm <= IntervalMultiGet(&mz, j-1).supr + 1);
+    }
+    if (op == INTERVAL_OP_UNION || op == INTERVAL_OP_INTERSECTION)
+    {
+      for (v = -300; v <= 300; v++)
+      {
+        n = (op == INTERVAL_OP_UNION) ?
+          (ValueIsInIntervalMulti(&ma, v) || ValueIsInIntervalMulti(&mb, v)) :
+          (ValueIsInIntervalMulti(&ma, v) && ValueIsInIntervalMulti(&mb, v));
+        mismatches += (ValueIsInIntervalMulti(&mz, v) != n);
+      }
+      continue;
+    }
+    IntervalMultiFromInterval(&mr, IntervalEmpty());
+    for (n = 0; n < IntervalMultiCount(&ma); n++)
+    {
+      for (j = 0; j < IntervalMultiCount(&mb); j++)
+      {
+        a = IntervalMultiGet(&ma, n);
+        b = IntervalMultiGet(&mb, j);
+        IntervalBatchEvalChecked(op, 1, &a.infm, &a.supr, &b.infm, &b.supr, 
+          &e.infm, &e.supr, mtyp, mtyp, NULL);
+        IntervalMultiInsert(&mr, (op == INTERVAL_OP_NEG) ? INTERVAL(-a.supr, -a.infm) : e);
+      }
+    }
+    mismatches += (IntervalMultiCount(&mz) != IntervalMultiCount(&mr));
+    for (j = 0; j < IntervalMultiCount(&mz) && j < IntervalMultiCount(&mr); j++)
+    {
+      e = IntervalMultiGet(&mz, j);
+      f = IntervalMultiGet(&mr, j);
+      mismatches += (e.infm != f.infm || e.supr != f.supr);
+    }
+  }
+  printf("Testing IntervalMultiEval: %d mismatches\n", mismatches);
+  
+  // Test the member cap: the squares 0 to 361 in a 4-member set keep their 
+  // hull, the smallest gaps being merged
+  IntervalMultiFree(&ma);
+  IntervalMultiInit(&ma, 4);
+  for (i = 0; i < 20; i++)
+  {
+    IntervalMultiInsert(&ma, INTERVAL(i * i, i * i));
+  }
+  mismatches = (IntervalMultiCount(&ma) != 4 || IntervalMultiGet(&ma, 1).infm != 289);
+  for (i = 0; i < 20; i++)
+  {
+    mismatches += (ValueIsInIntervalMulti(&ma, i * i) == 0);
+  }
+  printf("Testing IntervalMultiInsert (cap 4): ");
+  IntervalMultiPrint(stdout, &ma);
+  printf(", %d mismatches\n", mismatches);
+  IntervalMultiFree(&ma);
+  IntervalMultiFree(&mb);
+  IntervalMultiFree(&mz);
+  IntervalMultiFree(&mr);
+  
+  // Test the stabbing-query index on random intervals, including empty ones 
+  // and one reaching INT_MAX, against a linear scan with ValueIsInInterval
+  srand(4);
+  for (i = 0; i < BATCH_N; i++)
+  {
+    ref[i] = INTERVAL(rand() % 200001 - 100000, 0);
+    ref[i].supr = ref[i].infm + rand() % 400;
+    xi[i] = rand() % 240001 - 120000;
+  }
+  ref[0] = INTERVAL(2147483647 - 9, 2147483647);
+  ref[1] = IntervalEmpty();
+  xi[0] = 2147483647;
+  xi[1] = -2147483647 - 1;
+  ix = IntervalIndexCreate(ref, BATCH_N);
+  IntervalIndexAnyBatch(ix, BATCH_N, xi, zi);
+  IntervalIndexStabBatch(ix, BATCH_N, xi, zs);
+  mismatches = 0;
+  for (i = 0; i < BATCH_N; i++)
+  {
+    n = 0;
+    for (j = 0; j < BATCH_N; j++)
+    {
+      n += ValueIsInInterval(ref[j], xi[i]);
+    }
+    ovf = IntervalIndexStab(ix, xi[i], bw, BATCH_N);
+    mismatches += (ovf != n) + (zs[i] != n) + (zi[i] != (n > 0)) + 
+      (IntervalIndexAny(ix, xi[i]) != (n > 0));
+    for (j = 0; j < ovf; j++)
+    {
+      mismatches += (ValueIsInInterval(ref[bw[j]], xi[i]) == 0);
+    }
+  }
+  printf("Testing IntervalIndex: %d intervals, %d union members, %d mismatches\n", 
+    ix->n, ix->m, mismatches);
+  IntervalIndexDestroy(ix);
+  
+  // Test the trace reducer on a trace of 37 signals (large enough for two 
+  // threads) with an incomplete last frame, and on a single-signal trace, 
+  // mapped and read, against the union of the values of every signal
+  for (ns = 37; ns > 0; ns = (ns == 37) ? 1 : 0)
+  {
+    nf = (ns == 1) ? 5000 : 60000;
+    srand(ns);
+    tf = fopen("test-interval.trc", "wb");
+    IntervalTraceWriteHeader(tf, ns);
+    for (i = 0; i < nf; i++)
+    {
+      for (j = 0; j < ns; j++)
+      {
+        v = (rand() % 20001 - 10000) * (j + 1);
+        v = (j == 5 && i == nf / 2) ? -2147483647 - 1 : v;
+        fwrite(&v, sizeof(int), 1, tf);
+        ref[j] = (i == 0) ? ValueToInterval(v) : IntervalUnion(ref[j], ValueToInterval(v));
+      }
+    }
+    fwrite(xi, sizeof(int), ns - 1, tf);
+    fclose(tf);
+    for (op = 0; op < 4; op++)
+    {
+      tr = IntervalTraceReduce("test-interval.trc", (op >> 1) ? 0 : 4, 
+             SIGNED_ARITH, (op & 1) ? INTERVAL_TRACE_READ : 0);
+      mismatches = (tr == NULL || tr->nsignals != ns || tr->nframes != nf);
+      for (j = 0; mismatches == 0 && j < ns; j++)
+      {
+        a = IntervalTraceRange(tr, j);
+        mismatches += (a.infm != ref[j].infm) + (a.supr != ref[j].supr) +
+          (tr->bw[j] != IntervalToIntegerBitwidth(ref[j], SIGNED_ARITH));
+      }
+      printf("Testing IntervalTraceReduce (%d signals, %s): %d mismatches\n", 
+        ns, (op & 1) ? "read" : "mmap", mismatches);
+      IntervalTraceDestroy(tr);
+    }
+  }
+  // The peak resident set must not grow with the trace: reduce traces of 32 
+  // and 128 MB of BATCH_N signals, mapped and read, with 4 threads that 
+  // should keep at most a few buffers of INTERVAL_TRACE_BUFFER bytes each
+  for (n = 32; n <= 128; n *= 4)
+  {
+    nf = (int)(((long long)n << 20) / sizeof(xi));
+    tf = fopen("test-interval.trc", "wb");
+    IntervalTraceWriteHeader(tf, BATCH_N);
+    for (i = 0; i < nf; i++)
+    {
+      fwrite(xi, sizeof(int), BATCH_N, tf);
+    }
+    fclose(tf);
+    for (op = 0; op < 2; op++)
+    {
+      getrusage(RUSAGE_SELF, &ru);
+      rss = ru.ru_maxrss;
+      tr = IntervalTraceReduce("test-interval.trc", 4, SIGNED_ARITH, 
+             (op & 1) ? INTERVAL_TRACE_READ : 0);
+      getrusage(RUSAGE_SELF, &ru);
+      mismatches = (tr == NULL || tr->nframes != nf);
+      for (j = 0; mismatches == 0 && j < BATCH_N; j++)
+      {
+        mismatches += (tr->infm[j] != xi[j]) + (tr->supr[j] != xi[j]);
+      }
+      mismatches += (ru.ru_maxrss - rss > 8 * (INTERVAL_TRACE_BUFFER >> 10));
+      printf("Testing IntervalTraceReduce (%d MB, %s): peak RSS growth %ld kB, " 
+        "%d mismatches\n", n, (op & 1) ? "read" : "mmap", ru.ru_maxrss - rss, 
+        mismatches);
+      IntervalTraceDestroy(tr);
+    }
+  }
+  tf = fopen("test-interval.trc", "wb");
+  IntervalTraceWriteHeader(tf, 3);
+  fclose(tf);
+  tr = IntervalTraceReduce("test-interval.trc", 0, SIGNED_ARITH, 0);
+  mismatches = (tr == NULL || tr->nframes != 0 || tr->bw[2] != 0 || 
+    IntervalIsEmpty(IntervalTraceRange(tr, 2)) == 0);
+  IntervalTraceDestroy(tr);
+  remove("test-interval.trc");
+  mismatches += (IntervalTraceReduce("test-interval.trc", 0, SIGNED_ARITH, 0) != NULL);
+  printf("Testing IntervalTraceReduce (empty and missing trace): %d mismatches\n", 
+    mismatches);
+  
+  // Test the atomic accumulators with threads joining values concurrently, 
+  // against the sequential union of the same values
+  IntervalAtomicInit(&aa, IntervalEmpty());
+  IntervalAtomicInit(&ab, IntervalEmpty());
+  IntervalAtomicSplitInit(&as, IntervalEmpty());
+  mismatches = (IntervalIsEmpty(IntervalAtomicLoad(&aa)) == 0) + 
+    (IntervalIsEmpty(IntervalAtomicSplitLoad(&as)) == 0);
+  a = IntervalEmpty();
+  for (i = 0; i < ATOMIC_THREADS; i++)
+  {
+    at[i].a = &aa;
+    at[i].b = &ab;
+    at[i].s = &as;
+    at[i].seed = seed = 7 * i + 1;
+    for (j = 0; j < ATOMIC_N; j++)
+    {
+      v = atomic_test_value(&seed);
+      a = (i + j == 0) ? ValueToInterval(v) : IntervalUnion(a, ValueToInterval(v));
+    }
+    pthread_create(&threads[i], NULL, atomic_test_fn, &at[i]);
+  }
+  for (i = 0; i < ATOMIC_THREADS; i++)
+  {
+    pthread_join(threads[i], NULL);
+  }
+  b = IntervalAtomicLoad(&aa);
+  c = IntervalAtomicLoad(&ab);
+  d = IntervalAtomicSplitLoad(&as);
+  mismatches += (b.infm != a.infm) + (b.supr != a.supr) + (c.infm != a.infm) + 
+    (c.supr != a.supr) + (d.infm != a.infm) + (d.supr != a.supr) +
+    IntervalAtomicJoin(&aa, INTERVAL(a.infm + 1, a.supr)) +
+    IntervalAtomicJoin(&aa, IntervalEmpty()) +
+    (IntervalAtomicJoin(&aa, INTERVAL(a.infm, a.supr + 1)) != 1) +
+    (IntervalAtomicSplitJoinValue(&as, a.infm - 1) != 1);
+  printf("Testing IntervalAtomicJoin: %d threads, [%d,%d], %d mismatches\n", 
+    ATOMIC_THREADS, a.infm, a.supr, mismatches);
+  
+  // Test the profiler with threads recording values concurrently, against 
+  // the sequential union of the same values, and through a dump and load
+  IntervalProbeInit(4);
+  for (j = 0; j < 4; j++)
+  {
+    ref[j] = IntervalEmpty();
+  }
+  for (i = 0; i < ATOMIC_THREADS; i++)
+  {
+    seeds[i] = seed = 11 * i + 3;
+    for (j = 0; j < ATOMIC_N; j++)
+    {
+      v = atomic_test_value(&seed);
+      ref[j % 3] = (i == 0 && j < 3) ? ValueToInterval(v) : 
+        IntervalUnion(ref[j % 3], ValueToInterval(v));
+    }
+    pthread_create(&threads[i], NULL, probe_test_fn, &seeds[i]);
+  }
+  INTERVAL_PROBE(2, 1 << 20);
+  ref[2].supr = 1 << 20;
+  for (i = 0; i < ATOMIC_THREADS; i++)
+  {
+    pthread_join(threads[i], NULL);
+  }
+  mismatches = (IntervalProbeMerge(&ref[4], 8) != 4);
+  pf = tmpfile();
+  IntervalProbeDump(pf, &ref[4], 4);
+  rewind(pf);
+  mismatches += (IntervalProbeLoad(pf, &ref[8], 3) != 4);
+  fclose(pf);
+  for (j = 0; j < 4; j++)
+  {
+    mismatches += (ref[4 + j].infm != ref[j].infm) + (ref[4 + j].supr != ref[j].supr) +
+      (j < 3 && (ref[8 + j].infm != ref[j].infm || ref[8 + j].supr != ref[j].supr));
+  }
+  IntervalProbeReset();
+  IntervalProbeMerge(&ref[4], 4);
+  mismatches += (IntervalIsEmpty(ref[4]) == 0) + (IntervalProbeInit(4) == INTERVAL_OK);
+  printf("Testing IntervalProbeMerge: %d threads, %d probes, bitwidth = %d, %d mismatches\n", 
+    ATOMIC_THREADS + 1, IntervalProbeCount(), IntervalToIntegerBitwidth(ref[0], SIGNED_ARITH), 
+    mismatches);
+  IntervalProbeShutdown();
+  
+  // A thread that recorded probes before a shutdown must attach a new 
+  // buffer, not write into the freed one, once the profiler is set up again
+  IntervalProbeInit(4);
+  pthread_barrier_init(&barrier, NULL, 2);
+  pthread_create(&threads[0], NULL, probe_pool_fn, &barrier);
+  pthread_barrier_wait(&barrier);
+  IntervalProbeShutdown();
+  IntervalProbeInit(1);
+  pthread_barrier_wait(&barrier);
+  pthread_join(threads[0], NULL);
+  pthread_barrier_destroy(&barrier);
+  mismatches = (IntervalProbeMerge(&ref[0], 4) != 1) + 
+    (ref[0].infm != 5) + (ref[0].supr != 5);
+  printf("Testing IntervalProbeShutdown: probe of a thread across a shutdown = ");
+  IntervalPrint(stdout, ref[0]);
+  printf(", %d mismatches\n", mismatches);
+  IntervalProbeShutdown();
+  
+#ifdef INTERVAL_HAVE_INT128
+  // Test the 64-bit and arbitrary-precision intervals against the 128-bit 
+  // ones on random bounds of any magnitude: 64-bit results must be the 
+  // 128-bit ones saturated, with an overflow reported alike
+  IntervalBigInit(&ba);
+  IntervalBigInit(&bb);
+  IntervalBigInit(&bz);
+  mismatches = 0;
+  seed = 5;
+  for (i = 0; i < 100000; i++)
+  {
+    wx = wide_test_interval(&seed);
+    wy = wide_test_interval(&seed);
+    vx = Interval128FromInterval64(wx);
+    vy = Interval128FromInterval64(wy);
+    IntervalBigFromInterval128(&ba, vx);
+    IntervalBigFromInterval128(&bb, vy);
+    for (op = 0; op < 5; op++)
+    {
+      switch (op)
+      {
+        case 0:
+          n = Interval64Add(&wz, wx, wy) ^ Interval128Add(&vz, vx, vy);
+          IntervalBigAdd(&bz, &ba, &bb);
+          break;
+        case 1:
+          n = Interval64Sub(&wz, wx, wy) ^ Interval128Sub(&vz, vx, vy);
+          IntervalBigSub(&bz, &ba, &bb);
+          break;
+        case 2:
+          n = Interval64Mul(&wz, wx, wy) ^ Interval128Mul(&vz, vx, vy);
+          IntervalBigMul(&bz, &ba, &bb);
+          break;
+        case 3:
+          n = Interval64Neg(&wz, wx) ^ Interval128Neg(&vz, vx);
+          IntervalBigNeg(&bz, &ba);
+          break;
+        default:
+          n = Interval64Div(&wz, wx, wy) ^ Interval128Div(&vz, vx, vy);
+          IntervalBigFromInterval128(&bz, vz);
+          break;
+      }
+      n ^= Interval128ToInterval64(&w, vz);
+      mismatches += (n != INTERVAL_OK) + (w.infm != wz.infm) + (w.supr != wz.supr) + 
+        (IntervalBigToInterval128(&vy, &bz) != INTERVAL_OK) + 
+        (vy.infm != vz.infm) + (vy.supr != vz.supr);
+      vy = Interval128FromInterval64(wy);
+    }
+    IntervalBigUnion(&bz, &ba, &bb);
+    IntervalBigToInterval128(&vz, &bz);
+    mismatches += (vz.infm != MIN(wx.infm, wy.infm)) + (vz.supr != MAX(wx.supr, wy.supr));
+    w = Interval64Intersection(wx, wy);
+    IntervalBigIntersection(&bz, &ba, &bb);
+    IntervalBigToInterval64(&wz, &bz);
+    mismatches += (Interval64IsEmpty(w) != IntervalBigIsEmpty(&bz)) + 
+      (!Interval64IsEmpty(w) && (w.infm != wz.infm || w.supr != wz.supr)) +
+      (ValueIsInInterval64(wx, wy.infm) != ValueIsInIntervalBig(&ba, wy.infm));
+    Interval64ToIntegerBitwidth(&n, wx, SIGNED_ARITH);
+    Interval128ToIntegerBitwidth(&j, vx, SIGNED_ARITH);
+    IntervalBigToIntegerBitwidth(&v, &ba, SIGNED_ARITH);
+    mismatches += (n != j) + (n != v);
+  }
+  for (n = 1; n <= 128; n++)
+  {
+    for (op = 0; op < 2; op++)
+    {
+      j = Interval128Universe(&vx, n, op ? SIGNED_ARITH : UNSIGNED_ARITH);
+      IntervalBigUniverse(&bz, n, op ? SIGNED_ARITH : UNSIGNED_ARITH);
+      IntervalBigToInterval128(&vz, &bz);
+      mismatches += (j == INTERVAL_OK) && (vz.infm != vx.infm || vz.supr != vx.supr);
+      if (n <= 64 && (Interval64Universe(&w, n, op ? SIGNED_ARITH : UNSIGNED_ARITH) == 
+                      INTERVAL_OK))
+      {
+        mismatches += (w.infm != vx.infm) + (w.supr != vx.supr);
+      }
+    }
+  }
+  mismatches += (Interval64Div(&wz, INTERVAL64(5, 9), INTERVAL64(1, 0)) != 
+                 INTERVAL_ERR_EMPTY) + !Interval64IsEmpty(wz) + 
+    (Interval64Div(&wz, INTERVAL64(1, 0), INTERVAL64(2, 3)) != INTERVAL_ERR_EMPTY) + 
+    (Interval128Div(&vz, INTERVAL128(5, 9), INTERVAL128(1, 0)) != INTERVAL_ERR_EMPTY) + 
+    !Interval128IsEmpty(vz);
+  printf("Testing Interval64 and IntervalBig against Interval128: %d mismatches\n", 
+    mismatches);
+  
+  // Test arbitrary-precision bounds beyond 128 bits: (2**101 - 1 + 1)**2 
+  // and its negation
+  IntervalBigUniverse(&ba, 101, UNSIGNED_ARITH);
+  IntervalBigSet(&bb, 1, 1);
+  IntervalBigAdd(&bz, &ba, &bb);
+  IntervalBigMul(&bz, &bz, &bz);
+  printf("Testing IntervalBigMul: (");
+  IntervalBigPrint(stdout, &ba);
+  printf(" + [1,1])**2 = ");
+  IntervalBigPrint(stdout, &bz);
+  pf = tmpfile();
+  IntervalBigNeg(&ba, &bz);
+  IntervalBigPrint(pf, &ba);
+  rewind(pf);
+  mismatches = (fgets(str, sizeof(str), pf) == NULL) || strcmp(str, "[-642775217703596110216784836"
+    "9364650410088811975131171341205504,-1]") != 0;
+  fclose(pf);
+  IntervalBigToIntegerBitwidth(&n, &bz, UNSIGNED_ARITH);
+  IntervalBigSub(&ba, &bz, &ba);
+  IntervalBigToIntegerBitwidth(&j, &ba, UNSIGNED_ARITH);
+  mismatches += (n != 202) + (j != 203) + 
+    (IntervalBigToInterval128(&vz, &bz) != INTERVAL_ERR_OVERFLOW) + 
+    ValueIsInIntervalBig(&ba, 0) + !ValueIsInIntervalBig(&bz, INT64_MAX);
+  printf(", bitwidth = %d, %d mismatches\n", n, mismatches);
+  IntervalBigFree(&ba);
+  IntervalBigFree(&bb);
+  IntervalBigFree(&bz);
+#endif
+  
+  // Test the refinement of intervals by known bits against the exact range 
+  // of the matching values, and the known-bits operations on all pairs of 
+  // values of random operands
+  seed = 22;
+  mismatches = 0;
+  for (i = 0; i < 20000; i++)
+  {
+    kx = bits_test_random(&seed);
+    e = INTERVAL(INT_MAX, INT_MIN);
+    for (j = kx.r.infm; j <= kx.r.supr; j++)
+    {
+      if (ValueIsInIntervalBits(kx, j))
+      {
+        e = INTERVAL(MIN(e.infm, j), MAX(e.supr, j));
+      }
+    }
+    kz = IntervalBitsRefine(kx);
+    mismatches += (IntervalBitsIsEmpty(kz) != IntervalIsEmpty(e)) + 
+      (!IntervalIsEmpty(e) && (kz.r.infm != e.infm || kz.r.supr != e.supr ||
+       !ValueIsInIntervalBits(kz, e.infm) || !ValueIsInIntervalBits(kz, e.supr)));
+  }
+  for (i = 0; i < 2000; i++)
+  {
+    kx = IntervalBitsRefine(bits_test_random(&seed));
+    ky = IntervalBitsRefine(bits_test_random(&seed));
+    if (IntervalBitsIsEmpty(kx) || IntervalBitsIsEmpty(ky))
+    {
+      continue;
+    }
+    n = (int)(seed >> 16) % 32;
+    for (op = 0; op < 8; op++)
+    {
+      switch (op)
+      {
+        case 0: kz = IntervalBitsAdd(kx, ky); break;
+        case 1: kz = IntervalBitsSub(kx, ky); break;
+        case 2: kz = IntervalBitsAnd(kx, ky); break;
+        case 3: kz = IntervalBitsIor(kx, ky); break;
+        case 4: kz = IntervalBitsXor(kx, ky); break;
+        case 5: kz = IntervalBitsNot(kx); break;
+        case 6: kz = IntervalBitsShl(kx, n); break;
+        default: kz = IntervalBitsSra(IntervalBitsShr(kx, n), n); break;
+      }
+      for (j = kx.r.infm; j <= kx.r.supr; j++)
+      {
+        for (v = ky.r.infm; v <= ky.r.supr; v++)
+        {
+          if (!ValueIsInIntervalBits(kx, j) || !ValueIsInIntervalBits(ky, v))
+          {
+            continue;
+          }
+          switch (op)
+          {
+            case 0: nf = j + v; break;
+            case 1: nf = j - v; break;
+            case 2: nf = j & v; break;
+            case 3: nf = j | v; break;
+            case 4: nf = j ^ v; break;
+            case 5: nf = ~j; break;
+            case 6: nf = (int)((unsigned int)j << n); break;
+            default: nf = (int)((unsigned int)j >> n) >> n; break;
+          }
+          mismatches += !ValueIsInIntervalBits(kz, nf) + 
+            !ValueIsInIntervalBits(IntervalBitsRefine(kz), nf);
+        }
+      }
+    }
+  }
+  printf("Testing IntervalBitsRefine and the known-bits operations: %d mismatches\n", 
+    mismatches);
+  
+  // Test the reduced product on ((x << 4) + 3) & 12 for x in [0,15], where 
+  // the interval alone gives [0,12]
+  kx = IntervalBitsFromInterval(INTERVAL(0, 15));
+  kz = IntervalBitsAnd(IntervalBitsAdd(IntervalBitsShl(kx, 4), 
+         IntervalBitsFromInterval(INTERVAL(3, 3))), 
+         IntervalBitsFromInterval(INTERVAL(12, 12)));
+  n = IntervalToIntegerBitwidth(kz.r, UNSIGNED_ARITH);
+  kz = IntervalBitsRefine(kz);
+  printf("Testing IntervalBitsRefine: ((");
+  IntervalBitsPrint(stdout, kx);
+  printf(" << 4) + 3) & 12 = ");
+  IntervalBitsPrint(stdout, kz);
+  printf(", bitwidth = %d (interval only: %d)\n", 
+    IntervalToIntegerBitwidth(kz.r, UNSIGNED_ARITH), n);
+  kx = IntervalBitsFromMasks(0x7, 0);
+  kx.r = INTERVAL(5, 100);
+  printf("Testing IntervalBitsRefine: [5,100] & ~7 = ");
+  IntervalBitsPrint(stdout, IntervalBitsRefine(kx));
+  printf("\n");
+  
+  // Test the polynomial range on random polynomials of degree up to 5 over 
+  // random intervals within [-20,20]: the Horner range must contain the 
+  // exact one, and the split range must lie in between, reaching it with 
+  // enough segments
+  srand(5);
+  mismatches = 0;
+  for (i = 0; i < 20000; i++)
+  {
+    n = i % 6;
+    for (j = 0; j <= n; j++)
+    {
+      pc[j] = rand() % 11 - 5;
+    }
+    v = rand() % 41 - 20;
+    a = INTERVAL(v, v + rand() % (21 - v));
+    for (j = a.infm; j <= a.supr; j++)
+    {
+      for (nf = pc[n], ns = n - 1; ns >= 0; ns--)
+      {
+        nf = nf * j + pc[ns];
+      }
+      f = (j == a.infm) ? ValueToInterval(nf) : IntervalUnion(f, ValueToInterval(nf));
+    }
+    e = IntervalPoly(a, pc, n, 0);
+    b = IntervalPoly(a, pc, n, INTERVAL_POLY_SEGMENTS);
+    mismatches += (e.infm > b.infm) || (b.infm > f.infm) || 
+      (f.supr > b.supr) || (b.supr > e.supr);
+    b = IntervalPoly(a, pc, n, 64);
+    mismatches += (b.infm != f.infm) || (b.supr != f.supr);
+  }
+  // Invalid polynomials, overflow and an empty argument
+  mismatches += (IntervalPolyChecked(&e, a, pc, INTERVAL_POLY_MAX_DEGREE + 1, 0) 
+    != INTERVAL_ERR_INVALID) || !IntervalIsEmpty(e);
+  mismatches += (IntervalPolyChecked(&e, a, NULL, 0, 0) != INTERVAL_ERR_INVALID);
+  mismatches += (IntervalPolyChecked(&e, INTERVAL(0, 50000), p2, 2, 0) 
+    != INTERVAL_ERR_OVERFLOW) || !IntervalIsEmpty(e);
+  mismatches += (IntervalPolyChecked(&e, INTERVAL(1, 0), p2, 2, 16) 
+    != INTERVAL_OK) || !IntervalIsEmpty(e);
+  printf("Testing IntervalPoly: x**2 - 3x + 2 over [-1,4] = ");
+  IntervalPrint(stdout, IntervalPoly(INTERVAL(-1, 4), p2, 2, 0));
+  printf(" (Horner), ");
+  IntervalPrint(stdout, IntervalPoly(INTERVAL(-1, 4), p2, 2, INTERVAL_POLY_SEGMENTS));
+  printf(" (split), %d mismatches\n", mismatches);
+  
+  // Test the fixed-point solver on: for (i = 0; i < 100; i++) with and 
+  // without widening, and on the same loop computing s += i
+  for (op = 0; op < 3; op++)
+  {
+    fp = IntervalFixpointCreate(0);
+    if (op == 1)
+    {
+      fp->widen_delay = 1 << 30;
+    }
+    phi = IntervalFixpointAddPhi(fp);
+    IntervalFixpointAddPhiOperand(fp, phi, 
+      IntervalFixpointAddInput(fp, INTERVAL(0, 0), SIGNED_ARITH));
+    cnd = IntervalFixpointAddNode(fp, INTERVAL_OP_INTERSECTION, phi, 
+            IntervalFixpointAddInput(fp, INTERVAL(-2147483647 - 1, 99), SIGNED_ARITH), 
+            SIGNED_ARITH, SIGNED_ARITH);
+    inc = IntervalFixpointAddNode(fp, INTERVAL_OP_ADD, cnd,
+            IntervalFixpointAddInput(fp, INTERVAL(1, 1), SIGNED_ARITH), 
+            SIGNED_ARITH, SIGNED_ARITH);
+    IntervalFixpointAddPhiOperand(fp, phi, inc);
+    if (op == 2)
+    {
+      i = IntervalFixpointAddPhi(fp);
+      IntervalFixpointAddPhiOperand(fp, i, 
+        IntervalFixpointAddInput(fp, INTERVAL(0, 0), SIGNED_ARITH));
+      IntervalFixpointAddPhiOperand(fp, i, 
+        IntervalFixpointAddNode(fp, INTERVAL_OP_ADD, i, cnd, SIGNED_ARITH, SIGNED_ARITH));
+    }
+    n = IntervalFixpointSolve(fp, &ovf);
+    printf("Testing IntervalFixpointSolve (%s): i = ", 
+      (op == 1) ? "no widening" : "widening");
+    IntervalPrint(stdout, IntervalFixpointResult(fp, phi));
+    printf(", i < 100: ");
+    IntervalPrint(stdout, IntervalFixpointResult(fp, cnd));
+    printf(", i + 1 = ");
+    IntervalPrint(stdout, IntervalFixpointResult(fp, inc));
+    if (op == 2)
+    {
+      printf(", s = ");
+      IntervalPrint(stdout, IntervalFixpointResult(fp, i));
+    }
+    printf(" (%d evaluations, %s)\n", ovf, IntervalStatusString(n));
+    IntervalFixpointDestroy(fp);
+  }
+  
+  // Test the fixed-point solver on a negated value
+  fp = IntervalFixpointCreate(0);
+  i = IntervalFixpointAddInput(fp, INTERVAL(1, 5), SIGNED_ARITH);
+  cnd = IntervalFixpointAddNode(fp, INTERVAL_OP_NEG, i, -1, SIGNED_ARITH, SIGNED_ARITH);
+  n = IntervalFixpointSolve(fp, &ovf);
+  e = IntervalFixpointResult(fp, cnd);
+  printf("Testing IntervalFixpointSolve (negation): -[1,5] = ");
+  IntervalPrint(stdout, e);
+  printf(" (%s)\n", IntervalStatusString(n));
+  IntervalFixpointDestroy(fp);
+  
+  // Invalid ArithTypes are rejected when adding nodes, and an unknown one is 
+  // reported by the solver instead of aborting
+  fp = IntervalFixpointCreate(0);
+  i = IntervalFixpointAddInput(fp, INTERVAL(-3, 4), SIGNED_ARITH);
+  mismatches = (IntervalFixpointAddInput(fp, INTERVAL(0, 0), (ArithType)7) != -1) + 
+    (IntervalFixpointAddNode(fp, INTERVAL_OP_MUL, i, i, SIGNED_ARITH, (ArithType)7) != -1) + 
+    (IntervalFixpointAddNode(fp, INTERVAL_OP_MUL, i, i, (ArithType)-2, SIGNED_ARITH) != -1);
+  cnd = IntervalFixpointAddNode(fp, INTERVAL_OP_MUL, i, i, UNKNOWN_ARITH_TYPE, 
+          SIGNED_ARITH);
+  n = IntervalFixpointSolve(fp, &ovf);
+  mismatches += (cnd < 0) + ((n & INTERVAL_ERR_ARITH_TYPE) == 0) + 
+    !IntervalIsEmpty(IntervalFixpointResult(fp, cnd));
+  printf("Testing IntervalFixpointSolve (invalid ArithType): %s, %d mismatches\n", 
+    IntervalStatusString(n), mismatches);
+  IntervalFixpointDestroy(fp);
+  
   return 0;
 }